@@ -28,24 +28,35 @@
 #include "uniquestr.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <limits.h>
 #include <string.h>
-#include <math.h>
 
 #include "mem.h"
 
-typedef struct string_link_tag string_link_t;
+typedef struct string_entry_tag string_entry_t;
 
-struct string_link_tag
+struct string_entry_tag
 {
-    unsigned int hash;
+    uint32_t hash;
+    uint32_t length;
     const char *string;
-    string_link_t *next;
 };
 
-enum { HASH_LENGTH = 76003 };
+enum
+{
+    INITIAL_TABLE_SIZE = 1 << 16, // Must be a power of 2
+    STRING_PAGE_SIZE = 1 << 16,
+};
+
+// Open addressing with linear probing. Grows when it is 3/4 full
+static string_entry_t *hash_table = NULL;
+static uint32_t table_size = 0;
+static uint32_t num_strings = 0;
+
+static char *current_page = NULL;
+static size_t current_page_free = 0;
 
-static string_link_t *hash_table[HASH_LENGTH];
 static unsigned long long int bytes_used = 0;
 
 unsigned long long int char_trie_used_memory(void)
@@ -53,113 +64,162 @@ unsigned long long int char_trie_used_memory(void)
     return bytes_used;
 }
 
-static unsigned int hash_string(const char *string)
+// FNV-1a followed by a final mix of the bits so the lower bits, which are
+// the ones used to index the table, depend on the whole string
+static uint32_t hash_string(const char *string, uint32_t length)
 {
-    unsigned int hash = 0;
-    const char *p;
+    uint64_t hash = 14695981039346656037ULL;
+    uint32_t i;
 
-    for (p = string; *p; p++)
-        hash = ((hash << 5) + hash) ^ *p;
+    for (i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)string[i];
+        hash *= 1099511628211ULL;
+    }
 
-    return hash;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+
+    return (uint32_t)hash;
 }
 
-const char *uniquestr(const char *string)
+static char *allocate_string(const char *string, uint32_t length)
 {
-    if (string == NULL)
-        return NULL;
-
-    unsigned int hash = hash_string(string);
-    unsigned int hash_index = hash % (sizeof(hash_table) / sizeof(hash_table[0]));
-    string_link_t *p, *p_prev = 0, *new_link;
+    size_t size = length + 1;
 
-    for (p = hash_table[hash_index]; p; p_prev = p, p = p->next)
+    char *p;
+    if (size > STRING_PAGE_SIZE / 4)
     {
-        if (p->hash == hash && !strcmp(p->string, string))
+        // Big strings do not waste the current page
+        p = xmalloc(size);
+    }
+    else
+    {
+        if (size > current_page_free)
         {
-            if (p != hash_table[hash_index])
-            {
-                p_prev->next = p->next;
-                p->next = hash_table[hash_index];
-                hash_table[hash_index] = p;
-            }
-
-            return p->string;
+            current_page = xmalloc(STRING_PAGE_SIZE);
+            current_page_free = STRING_PAGE_SIZE;
         }
+        p = current_page;
+        current_page += size;
+        current_page_free -= size;
     }
+    bytes_used += size;
 
-    bytes_used += sizeof(string_link_t) + strlen(string) + 1;
-
-    new_link = NEW(string_link_t);
-    new_link->string = xstrdup(string); 
-    new_link->hash = hash; 
-    new_link->next = hash_table[hash_index];
-    hash_table[hash_index] = new_link; 
+    memcpy(p, string, length);
+    p[length] = '\0';
 
-    return new_link->string;
+    return p;
 }
 
-void uniquestr_stats(void)
+static void grow_table(void)
 {
-    unsigned long long bucket_length[HASH_LENGTH];
-    unsigned long long number_of_strings = 0;
-    unsigned long long number_of_bytes = 0;
+    string_entry_t *old_table = hash_table;
+    uint32_t old_size = table_size;
 
-    int i, j;
-    for (i = 0; i < HASH_LENGTH; i++)
-    {
-        string_link_t *p = hash_table[i];
+    table_size = (old_size == 0) ? INITIAL_TABLE_SIZE : 2 * old_size;
+    hash_table = NEW_VEC0(string_entry_t, table_size);
+    bytes_used += (unsigned long long)(table_size - old_size) * sizeof(string_entry_t);
 
-        j = 0;
-        while (p != NULL)
-        {
-            // fprintf(stderr, "%d.%d |%s|\n", i, j, p->string);
-            number_of_strings++;
-            number_of_bytes += strlen(p->string) + 1; // +1 for NULL
+    uint32_t mask = table_size - 1;
+    uint32_t i;
+    for (i = 0; i < old_size; i++)
+    {
+        if (old_table[i].string == NULL)
+            continue;
 
-            p = p->next;
-            j++;
-        }
+        uint32_t index = old_table[i].hash & mask;
+        while (hash_table[index].string != NULL)
+            index = (index + 1) & mask;
 
-        bucket_length[i] = j;
+        hash_table[index] = old_table[i];
     }
 
-    unsigned long long max_bucket = 0;
-    unsigned long long min_bucket = ULLONG_MAX;
-    unsigned long long sum_buckets = 0;
-    unsigned long long num_empty_buckets = 0;
+    DELETE(old_table);
+}
 
-    for (i = 0; i < HASH_LENGTH; i++)
+const char *uniquestr_n(const char *string, size_t length)
+{
+    if (string == NULL)
+        return NULL;
+
+    if (4 * (num_strings + 1) > 3 * table_size)
+        grow_table();
+
+    uint32_t hash = hash_string(string, length);
+    uint32_t mask = table_size - 1;
+    uint32_t index = hash & mask;
+
+    for (;;)
     {
-        if (bucket_length[i] >= max_bucket)
-            max_bucket = bucket_length[i];
-        if (bucket_length[i] <= min_bucket)
-            min_bucket = bucket_length[i];
+        string_entry_t *entry = &hash_table[index];
+        if (entry->string == NULL)
+            break;
 
-        sum_buckets += bucket_length[i];
+        if (entry->hash == hash
+                && entry->length == length
+                && memcmp(entry->string, string, length) == 0)
+            return entry->string;
 
-        num_empty_buckets += (bucket_length[i] == 0);
+        index = (index + 1) & mask;
     }
 
-    float avg_bucket = 0.0f;
-    avg_bucket = ((float)sum_buckets / (float)HASH_LENGTH);
+    string_entry_t *new_entry = &hash_table[index];
+    new_entry->hash = hash;
+    new_entry->length = length;
+    new_entry->string = allocate_string(string, length);
+    num_strings++;
 
-    float stddev_bucket = 0.0f;
-    for (i = 0; i < HASH_LENGTH; i++)
+    return new_entry->string;
+}
+
+const char *uniquestr(const char *string)
+{
+    if (string == NULL)
+        return NULL;
+
+    return uniquestr_n(string, strlen(string));
+}
+
+void uniquestr_stats(void)
+{
+    unsigned long long number_of_bytes = 0;
+    unsigned long long sum_probes = 0;
+    unsigned long long max_probe = 0;
+
+    uint32_t mask = table_size - 1;
+    uint32_t i;
+    for (i = 0; i < table_size; i++)
     {
-        stddev_bucket += fabsf(bucket_length[i] - avg_bucket);
+        const string_entry_t *entry = &hash_table[i];
+        if (entry->string == NULL)
+            continue;
+
+        number_of_bytes += entry->length + 1; // +1 for NULL
+
+        // Number of entries visited when looking up this string
+        unsigned long long probe = ((i - (entry->hash & mask)) & mask) + 1;
+        sum_probes += probe;
+        if (probe > max_probe)
+            max_probe = probe;
     }
-    stddev_bucket = sqrtf(stddev_bucket / (float)(HASH_LENGTH - 1));
+
+    float load_factor = 0.0f;
+    float avg_probe = 0.0f;
+    if (table_size != 0)
+        load_factor = (float)num_strings / (float)table_size;
+    if (num_strings != 0)
+        avg_probe = (float)sum_probes / (float)num_strings;
 
     fprintf(stderr, "String table statistics\n");
     fprintf(stderr, "=======================\n\n");
 
-    fprintf(stderr, "Size of hash: %d\n", HASH_LENGTH);
-    fprintf(stderr, "Number of strings: %llu\n", number_of_strings);
+    fprintf(stderr, "Size of hash: %u\n", table_size);
+    fprintf(stderr, "Number of strings: %u\n", num_strings);
     fprintf(stderr, "Number of bytes taken by the strings: %llu\n", number_of_bytes);
-    fprintf(stderr, "Number of empty buckets: %llu\n", num_empty_buckets);
-    fprintf(stderr, "Minimum bucket length: %llu\n", min_bucket);
-    fprintf(stderr, "Maximum bucket length: %llu\n", max_bucket);
-    fprintf(stderr, "Average bucket length: %.2f\n", avg_bucket);
-    fprintf(stderr, "StdDev  bucket length: %.2f\n", stddev_bucket);
+    fprintf(stderr, "Total memory used: %llu\n", bytes_used);
+    fprintf(stderr, "Load factor: %.2f\n", load_factor);
+    fprintf(stderr, "Average probe length: %.2f\n", avg_probe);
+    fprintf(stderr, "Maximum probe length: %llu\n", max_probe);
 }
@@ -0,0 +1,585 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+// Open addressing hash table shared by dhash_ptr and dhash_str.
+//
+// This file is not a regular header: it is included once by dhash_ptr.c and
+// dhash_str.c after defining
+//
+//   DHASH(x)             name of the entity x, e.g. dhash_ptr_ ## x
+//   DHASH_HASH(key)      32-bit hash of a key
+//   DHASH_EQUAL(k1, k2)  nonzero if both keys are the same key
+//
+// Tables start using a few slots stored in the table itself, which is enough
+// for most scopes. Beyond that items live in a power of two Robin Hood table.
+// When that table grows, the old one is kept and its items are moved a few at
+// a time on every insertion or removal so no single operation pays for the
+// whole rehash.
+//
+// Walking a table does not move its items. Insertions of new keys and
+// removals done by the walk function are deferred until the outermost walk
+// ends, so the walk function can freely query and modify the table.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem.h"
+
+enum
+{
+    // Items stored inside the table before allocating any slot
+    DHASH_SMALL_SIZE = 4,
+    // Smallest open addressing table, must be a power of two
+    DHASH_MIN_CAPACITY = 16,
+    // Slots of the old table moved on every insertion or removal
+    DHASH_MIGRATION_STEP = 8,
+};
+
+typedef
+struct DHASH(slot_tag)
+{
+    // NULL if the slot is empty
+    const char* key;
+    // NULL if the key was removed while walking the table
+    DHASH(info_t) info;
+    uint32_t hash;
+} DHASH(slot_t);
+
+struct DHASH(tag)
+{
+    int num_items;
+
+    // Items stored inline while capacity is zero
+    int num_small;
+    DHASH(slot_t) small_slots[DHASH_SMALL_SIZE];
+
+    int capacity;
+    DHASH(slot_t)* slots;
+
+    // Table whose items are still being moved into slots
+    int old_capacity;
+    int old_cursor;
+    DHASH(slot_t)* old_slots;
+
+    // Nesting of dhash_*_walk
+    int walking;
+    int num_deferred_removals;
+    int num_pending;
+    DHASH(slot_t)* pending;
+};
+
+// Moved slots of the old table are marked with this key so lookups keep
+// probing past them
+static const char DHASH(moved_key)[1];
+#define DHASH_MOVED (DHASH(moved_key))
+
+static int DHASH(capacity_for)(int num_items)
+{
+    int capacity = DHASH_MIN_CAPACITY;
+    // Keep the load factor below 3/4
+    while ((capacity / 4) * 3 < num_items)
+        capacity *= 2;
+    return capacity;
+}
+
+static uint32_t DHASH(distance)(uint32_t index, uint32_t hash, uint32_t mask)
+{
+    return (index - (hash & mask)) & mask;
+}
+
+static DHASH(slot_t)* DHASH(table_find)(DHASH(slot_t)* slots, int capacity,
+        const char* key, uint32_t hash)
+{
+    uint32_t mask = capacity - 1;
+    uint32_t index = hash & mask;
+    uint32_t dist = 0;
+
+    for (;;)
+    {
+        DHASH(slot_t)* s = &slots[index];
+        if (s->key == NULL
+                || DHASH(distance)(index, s->hash, mask) < dist)
+            return NULL;
+
+        if (s->hash == hash
+                && s->key != DHASH_MOVED
+                && DHASH_EQUAL(s->key, key))
+            return s;
+
+        index = (index + 1) & mask;
+        dist++;
+    }
+}
+
+// The key must not be in the table
+static void DHASH(table_insert)(DHASH(slot_t)* slots, int capacity,
+        DHASH(slot_t) item)
+{
+    uint32_t mask = capacity - 1;
+    uint32_t index = item.hash & mask;
+    uint32_t dist = 0;
+
+    for (;;)
+    {
+        DHASH(slot_t)* s = &slots[index];
+        if (s->key == NULL)
+        {
+            *s = item;
+            return;
+        }
+
+        // Robin Hood: the item farther from its home slot keeps this one
+        uint32_t s_dist = DHASH(distance)(index, s->hash, mask);
+        if (s_dist < dist)
+        {
+            DHASH(slot_t) tmp = *s;
+            *s = item;
+            item = tmp;
+            dist = s_dist;
+        }
+
+        index = (index + 1) & mask;
+        dist++;
+    }
+}
+
+static void DHASH(table_remove)(DHASH(slot_t)* slots, int capacity,
+        DHASH(slot_t)* s)
+{
+    uint32_t mask = capacity - 1;
+    uint32_t index = s - slots;
+
+    // Backward shift the following items so no tombstone is needed
+    for (;;)
+    {
+        uint32_t next = (index + 1) & mask;
+        if (slots[next].key == NULL
+                || DHASH(distance)(next, slots[next].hash, mask) == 0)
+            break;
+
+        slots[index] = slots[next];
+        index = next;
+    }
+    slots[index].key = NULL;
+    slots[index].info = NULL;
+}
+
+static void DHASH(migrate)(DHASH(t)* dhash, int num_slots)
+{
+    if (dhash->old_slots == NULL)
+        return;
+
+    while (num_slots > 0
+            && dhash->old_cursor < dhash->old_capacity)
+    {
+        DHASH(slot_t)* s = &dhash->old_slots[dhash->old_cursor];
+        if (s->key != NULL
+                && s->key != DHASH_MOVED)
+        {
+            DHASH(table_insert)(dhash->slots, dhash->capacity, *s);
+            s->key = DHASH_MOVED;
+        }
+        dhash->old_cursor++;
+        num_slots--;
+    }
+
+    if (dhash->old_cursor == dhash->old_capacity)
+    {
+        DELETE(dhash->old_slots);
+        dhash->old_slots = NULL;
+        dhash->old_capacity = 0;
+        dhash->old_cursor = 0;
+    }
+}
+
+static void DHASH(finish_migration)(DHASH(t)* dhash)
+{
+    DHASH(migrate)(dhash, dhash->old_capacity);
+}
+
+static void DHASH(grow)(DHASH(t)* dhash, int new_capacity)
+{
+    if (new_capacity <= dhash->capacity)
+        return;
+
+    if (dhash->capacity == 0)
+    {
+        // Move the inline items, there are just a few of them
+        dhash->capacity = new_capacity;
+        dhash->slots = NEW_VEC0(DHASH(slot_t), new_capacity);
+
+        int i;
+        for (i = 0; i < dhash->num_small; i++)
+        {
+            DHASH(table_insert)(dhash->slots, dhash->capacity, dhash->small_slots[i]);
+        }
+        dhash->num_small = 0;
+        return;
+    }
+
+    // The new table can hold everything, so the previous migration must have
+    // ended before this one starts
+    DHASH(finish_migration)(dhash);
+
+    dhash->old_slots = dhash->slots;
+    dhash->old_capacity = dhash->capacity;
+    dhash->old_cursor = 0;
+
+    dhash->capacity = new_capacity;
+    dhash->slots = NEW_VEC0(DHASH(slot_t), new_capacity);
+}
+
+// Returns the slot of the key wherever it is stored, except pending
+// insertions
+static DHASH(slot_t)* DHASH(find)(DHASH(t)* dhash, const char* key, uint32_t hash)
+{
+    if (dhash->capacity == 0)
+    {
+        int i;
+        for (i = 0; i < dhash->num_small; i++)
+        {
+            DHASH(slot_t)* s = &dhash->small_slots[i];
+            if (s->hash == hash
+                    && DHASH_EQUAL(s->key, key))
+                return s;
+        }
+        return NULL;
+    }
+
+    DHASH(slot_t)* s = DHASH(table_find)(dhash->slots, dhash->capacity, key, hash);
+    if (s == NULL
+            && dhash->old_slots != NULL)
+    {
+        s = DHASH(table_find)(dhash->old_slots, dhash->old_capacity, key, hash);
+    }
+    return s;
+}
+
+static DHASH(slot_t)* DHASH(find_pending)(DHASH(t)* dhash, const char* key, uint32_t hash)
+{
+    int i;
+    for (i = 0; i < dhash->num_pending; i++)
+    {
+        DHASH(slot_t)* s = &dhash->pending[i];
+        if (s->hash == hash
+                && DHASH_EQUAL(s->key, key))
+            return s;
+    }
+    return NULL;
+}
+
+static void DHASH(do_insert)(DHASH(t)* dhash, const char* key, uint32_t hash,
+        DHASH(info_t) info)
+{
+    DHASH(migrate)(dhash, DHASH_MIGRATION_STEP);
+
+    DHASH(slot_t)* s = DHASH(find)(dhash, key, hash);
+    if (s != NULL)
+    {
+        // Update
+        if (s->info == NULL)
+        {
+            // Removed while walking
+            dhash->num_deferred_removals--;
+            dhash->num_items++;
+        }
+        s->info = info;
+        return;
+    }
+
+    DHASH(slot_t) item = { key, info, hash };
+
+    if (dhash->walking > 0)
+    {
+        s = DHASH(find_pending)(dhash, key, hash);
+        if (s != NULL)
+        {
+            s->info = info;
+            return;
+        }
+
+        dhash->num_pending++;
+        dhash->pending = NEW_REALLOC(DHASH(slot_t), dhash->pending, dhash->num_pending);
+        dhash->pending[dhash->num_pending - 1] = item;
+        dhash->num_items++;
+        return;
+    }
+
+    if (dhash->capacity == 0
+            && dhash->num_small < DHASH_SMALL_SIZE)
+    {
+        dhash->small_slots[dhash->num_small] = item;
+        dhash->num_small++;
+        dhash->num_items++;
+        return;
+    }
+
+    if (dhash->capacity == 0)
+    {
+        DHASH(grow)(dhash, DHASH_MIN_CAPACITY);
+    }
+    else if ((dhash->capacity / 4) * 3 < dhash->num_items + 1)
+    {
+        DHASH(grow)(dhash, 2 * dhash->capacity);
+    }
+
+    DHASH(table_insert)(dhash->slots, dhash->capacity, item);
+    dhash->num_items++;
+}
+
+static void DHASH(do_remove)(DHASH(t)* dhash, DHASH(slot_t)* s)
+{
+    if (dhash->capacity == 0)
+    {
+        int i = s - dhash->small_slots;
+        memmove(&dhash->small_slots[i], &dhash->small_slots[i + 1],
+                (dhash->num_small - i - 1) * sizeof(dhash->small_slots[0]));
+        dhash->num_small--;
+    }
+    else if (dhash->slots <= s
+            && s < dhash->slots + dhash->capacity)
+    {
+        DHASH(table_remove)(dhash->slots, dhash->capacity, s);
+    }
+    else
+    {
+        // Items are never inserted in the old table, so we only have to
+        // hide it
+        s->key = DHASH_MOVED;
+    }
+}
+
+// Applies the mutations done while walking the table
+static void DHASH(end_walk)(DHASH(t)* dhash)
+{
+    if (dhash->num_deferred_removals > 0)
+    {
+        // There cannot be an old table here as walking finishes migrations
+        DHASH(slot_t)* slots = dhash->capacity == 0 ? dhash->small_slots : dhash->slots;
+        int num_slots = dhash->capacity == 0 ? dhash->num_small : dhash->capacity;
+
+        // Removing shifts the slots, so gather the keys first
+        DHASH(slot_t)* removed = NEW_VEC(DHASH(slot_t), dhash->num_deferred_removals);
+        int num_removed = 0;
+        int i;
+        for (i = 0; i < num_slots; i++)
+        {
+            if (slots[i].key != NULL
+                    && slots[i].info == NULL)
+            {
+                removed[num_removed] = slots[i];
+                num_removed++;
+            }
+        }
+
+        for (i = 0; i < num_removed; i++)
+        {
+            DHASH(slot_t)* s = DHASH(find)(dhash, removed[i].key, removed[i].hash);
+            DHASH(do_remove)(dhash, s);
+        }
+        DELETE(removed);
+
+        dhash->num_deferred_removals = 0;
+    }
+
+    if (dhash->num_pending > 0)
+    {
+        DHASH(slot_t)* pending = dhash->pending;
+        int num_pending = dhash->num_pending;
+
+        dhash->pending = NULL;
+        dhash->num_pending = 0;
+        // do_insert counts them again
+        dhash->num_items -= num_pending;
+
+        int i;
+        for (i = 0; i < num_pending; i++)
+        {
+            DHASH(do_insert)(dhash, pending[i].key, pending[i].hash, pending[i].info);
+        }
+        DELETE(pending);
+    }
+}
+
+DHASH(t)* DHASH(new)(int initial_size)
+{
+    if (initial_size < 0) abort();
+
+    DHASH(t)* result = NEW0(DHASH(t));
+
+    // Small tables use the inline slots first
+    if (initial_size > DHASH_SMALL_SIZE)
+    {
+        DHASH(grow)(result, DHASH(capacity_for)(initial_size));
+    }
+
+    return result;
+}
+
+DHASH(t)* DHASH(new_from_arrays)(int num_items,
+        const char** keys,
+        DHASH(info_t)* infos)
+{
+    DHASH(t)* result = DHASH(new)(num_items);
+
+    int i;
+    for (i = 0; i < num_items; i++)
+    {
+        DHASH(insert)(result, keys[i], infos[i]);
+    }
+
+    return result;
+}
+
+void DHASH(reserve)(DHASH(t)* dhash, int num_items)
+{
+    if (num_items <= DHASH_SMALL_SIZE
+            || dhash->walking > 0)
+        return;
+
+    int capacity = DHASH(capacity_for)(num_items);
+    if (capacity <= dhash->capacity)
+        return;
+
+    DHASH(grow)(dhash, capacity);
+    // This is an explicit request so do not spread it over later insertions
+    DHASH(finish_migration)(dhash);
+}
+
+void DHASH(destroy)(DHASH(t)* dhash)
+{
+    DELETE(dhash->slots);
+    DELETE(dhash->old_slots);
+    DELETE(dhash->pending);
+    DELETE(dhash);
+}
+
+int DHASH(num_items)(DHASH(t)* dhash)
+{
+    return dhash->num_items;
+}
+
+void* DHASH(query)(DHASH(t)* dhash, const char* key)
+{
+    if (key == NULL) abort();
+
+    uint32_t hash = DHASH_HASH(key);
+
+    DHASH(slot_t)* s = DHASH(find)(dhash, key, hash);
+    if (s == NULL
+            && dhash->num_pending > 0)
+    {
+        s = DHASH(find_pending)(dhash, key, hash);
+    }
+
+    if (s == NULL)
+        return NULL;
+
+    return s->info;
+}
+
+void DHASH(insert)(DHASH(t)* dhash, const char* key, DHASH(info_t) info)
+{
+    if (key == NULL) abort();
+    if (info == NULL) abort();
+
+    DHASH(do_insert)(dhash, key, DHASH_HASH(key), info);
+}
+
+void DHASH(remove)(DHASH(t)* dhash, const char* key)
+{
+    if (key == NULL) abort();
+
+    uint32_t hash = DHASH_HASH(key);
+
+    if (dhash->walking > 0)
+    {
+        DHASH(slot_t)* s = DHASH(find)(dhash, key, hash);
+        if (s != NULL)
+        {
+            if (s->info != NULL)
+            {
+                s->info = NULL;
+                dhash->num_deferred_removals++;
+                dhash->num_items--;
+            }
+            return;
+        }
+
+        s = DHASH(find_pending)(dhash, key, hash);
+        if (s != NULL)
+        {
+            *s = dhash->pending[dhash->num_pending - 1];
+            dhash->num_pending--;
+            dhash->num_items--;
+        }
+        return;
+    }
+
+    DHASH(migrate)(dhash, DHASH_MIGRATION_STEP);
+
+    DHASH(slot_t)* s = DHASH(find)(dhash, key, hash);
+    if (s == NULL)
+        // Not found
+        return;
+
+    DHASH(do_remove)(dhash, s);
+    dhash->num_items--;
+}
+
+void DHASH(walk)(DHASH(t)* dhash, DHASH(walk_fn) walk_fn, void *walk_info)
+{
+    if (dhash->walking == 0)
+    {
+        DHASH(finish_migration)(dhash);
+    }
+
+    dhash->walking++;
+
+    DHASH(slot_t)* slots = dhash->capacity == 0 ? dhash->small_slots : dhash->slots;
+    int num_slots = dhash->capacity == 0 ? dhash->num_small : dhash->capacity;
+
+    int i;
+    for (i = 0; i < num_slots; i++)
+    {
+        // Skip empty slots and keys removed during the walk
+        if (slots[i].key != NULL
+                && slots[i].info != NULL)
+        {
+            walk_fn(slots[i].key, slots[i].info, walk_info);
+        }
+    }
+
+    dhash->walking--;
+
+    if (dhash->walking == 0)
+    {
+        DHASH(end_walk)(dhash);
+    }
+}
+
+#undef DHASH_MOVED
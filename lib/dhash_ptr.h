@@ -38,14 +38,24 @@ typedef void* dhash_ptr_info_t;
 
 typedef struct dhash_ptr_tag dhash_ptr_t;
 
+// initial_size is the number of items expected, the table grows as needed
 dhash_ptr_t* dhash_ptr_new(int initial_size);
+// Builds a table with the num_items pairs keys[i], infos[i]
+dhash_ptr_t* dhash_ptr_new_from_arrays(int num_items,
+        const char** keys,
+        dhash_ptr_info_t* infos);
 void dhash_ptr_destroy(dhash_ptr_t*);
+// Makes room for num_items so inserting them does not grow the table
+void dhash_ptr_reserve(dhash_ptr_t*, int num_items);
+int dhash_ptr_num_items(dhash_ptr_t*);
 void* dhash_ptr_query(dhash_ptr_t*, const char* key);
 void dhash_ptr_insert(dhash_ptr_t*, const char* key, dhash_ptr_info_t info);
 void dhash_ptr_remove(dhash_ptr_t*, const char* key);
 
 typedef void dhash_ptr_walk_fn(const char* key, void* info, void *walk_info);
 
+// walk_fn may query, insert and remove keys of the table being walked.
+// New keys are not walked
 void dhash_ptr_walk(dhash_ptr_t*, dhash_ptr_walk_fn walk_fn, void* walk_info);
 
 #ifdef __cplusplus
@@ -38,14 +38,24 @@ typedef void* dhash_str_info_t;
 
 typedef struct dhash_str_tag dhash_str_t;
 
+// initial_size is the number of items expected, the table grows as needed
 dhash_str_t* dhash_str_new(int initial_size);
+// Builds a table with the num_items pairs keys[i], infos[i]
+dhash_str_t* dhash_str_new_from_arrays(int num_items,
+        const char** keys,
+        dhash_str_info_t* infos);
 void dhash_str_destroy(dhash_str_t*);
+// Makes room for num_items so inserting them does not grow the table
+void dhash_str_reserve(dhash_str_t*, int num_items);
+int dhash_str_num_items(dhash_str_t*);
 void* dhash_str_query(dhash_str_t*, const char* key);
 void dhash_str_insert(dhash_str_t*, const char* key, dhash_str_info_t info);
 void dhash_str_remove(dhash_str_t*, const char* key);
 
 typedef void dhash_str_walk_fn(const char* key, void* info, void *walk_info);
 
+// walk_fn may query, insert and remove keys of the table being walked.
+// New keys are not walked
 void dhash_str_walk(dhash_str_t*, dhash_str_walk_fn walk_fn, void* walk_info);
 
 #ifdef __cplusplus
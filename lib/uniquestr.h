@@ -31,6 +31,7 @@
 #define UNIQUESTR_H
 
 #include "libutils-common.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +39,8 @@ extern "C" {
 
 #define uniqstr uniquestr
 LIBUTILS_EXTERN const char *uniquestr(const char*);
+// Like uniquestr but the string does not have to be NULL-terminated
+LIBUTILS_EXTERN const char *uniquestr_n(const char*, size_t length);
 
 #define UNIQUESTR_LITERAL(literal) \
   ({ static const char* _cached_uniquestr = NULL; \
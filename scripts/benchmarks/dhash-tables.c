@@ -0,0 +1,445 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+// Standalone driver for the dhash tables of lib, built by dhash-tables.sh.
+//
+//   dhash-tables check [steps]
+//   dhash-tables bench [keys] [lookups]
+//
+// check cross-checks dhash_ptr and dhash_str against a reference array with
+// random insertions, removals and queries, plus walks whose walk function
+// mutates the table. bench times many tiny tables and one large table.
+// Only the API older versions of lib already had is used, so the same
+// driver can time two source trees.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "dhash_ptr.h"
+#include "dhash_str.h"
+
+#define NUM_KEYS 20000
+
+static int num_errors = 0;
+
+#define CHECK(cond, ...) \
+    do { \
+        if (!(cond)) \
+        { \
+            fprintf(stderr, "%s:%d: check '%s' failed: ", __FILE__, __LINE__, #cond); \
+            fprintf(stderr, __VA_ARGS__); \
+            fprintf(stderr, "\n"); \
+            if (++num_errors > 10) \
+                exit(EXIT_FAILURE); \
+        } \
+    } while (0)
+
+// Deterministic so failures can be reproduced
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+// Key k is &ptr_keys[k] for dhash_ptr and str_keys[k] for dhash_str.
+// Queries on dhash_str go through str_query_keys[k], a different copy of
+// the same string, so the table must compare contents
+static char ptr_keys[NUM_KEYS];
+static char* str_keys[NUM_KEYS];
+static char* str_query_keys[NUM_KEYS];
+
+static void init_keys(void)
+{
+    int k;
+    for (k = 0; k < NUM_KEYS; k++)
+    {
+        char buffer[64];
+        // Varying lengths so every tail length of the hash is used
+        snprintf(buffer, sizeof(buffer), "key_%d%.*s", k, k % 7, "_______");
+        str_keys[k] = strdup(buffer);
+        str_query_keys[k] = strdup(buffer);
+    }
+}
+
+typedef struct table_tag
+{
+    const char* name;
+    void* table;
+    void* (*new_)(int);
+    void (*destroy)(void*);
+    void* (*query)(void*, int k);
+    void (*insert)(void*, int k, void* info);
+    void (*remove)(void*, int k);
+    void (*walk)(void*, void (*fn)(int k, void* info, void* walk_info), void* walk_info);
+} table_t;
+
+// Adapters so the checks are written once for both kinds of table
+static void* ptr_new(int n) { return dhash_ptr_new(n); }
+static void ptr_destroy(void* t) { dhash_ptr_destroy((dhash_ptr_t*)t); }
+static void* ptr_query(void* t, int k) { return dhash_ptr_query((dhash_ptr_t*)t, &ptr_keys[k]); }
+static void ptr_insert(void* t, int k, void* info) { dhash_ptr_insert((dhash_ptr_t*)t, &ptr_keys[k], info); }
+static void ptr_remove(void* t, int k) { dhash_ptr_remove((dhash_ptr_t*)t, &ptr_keys[k]); }
+
+static void* str_new(int n) { return dhash_str_new(n); }
+static void str_destroy(void* t) { dhash_str_destroy((dhash_str_t*)t); }
+static void* str_query(void* t, int k) { return dhash_str_query((dhash_str_t*)t, str_query_keys[k]); }
+static void str_insert(void* t, int k, void* info) { dhash_str_insert((dhash_str_t*)t, str_keys[k], info); }
+static void str_remove(void* t, int k) { dhash_str_remove((dhash_str_t*)t, str_query_keys[k]); }
+
+typedef struct walk_adapter_tag
+{
+    void (*fn)(int k, void* info, void* walk_info);
+    void* walk_info;
+} walk_adapter_t;
+
+static void ptr_walk_adapter(const char* key, void* info, void* walk_info)
+{
+    walk_adapter_t* adapter = (walk_adapter_t*)walk_info;
+    adapter->fn((int)(key - ptr_keys), info, adapter->walk_info);
+}
+
+static void ptr_walk(void* t, void (*fn)(int, void*, void*), void* walk_info)
+{
+    walk_adapter_t adapter = { fn, walk_info };
+    dhash_ptr_walk((dhash_ptr_t*)t, ptr_walk_adapter, &adapter);
+}
+
+static void str_walk_adapter(const char* key, void* info, void* walk_info)
+{
+    walk_adapter_t* adapter = (walk_adapter_t*)walk_info;
+    // The table keeps the pointer it was given on insertion
+    int k = atoi(key + strlen("key_"));
+    CHECK(key == str_keys[k], "walked key '%s' is not the inserted pointer", key);
+    adapter->fn(k, info, adapter->walk_info);
+}
+
+static void str_walk(void* t, void (*fn)(int, void*, void*), void* walk_info)
+{
+    walk_adapter_t adapter = { fn, walk_info };
+    dhash_str_walk((dhash_str_t*)t, str_walk_adapter, &adapter);
+}
+
+static table_t ptr_table = { "dhash_ptr", NULL,
+    ptr_new, ptr_destroy, ptr_query, ptr_insert, ptr_remove, ptr_walk };
+static table_t str_table = { "dhash_str", NULL,
+    str_new, str_destroy, str_query, str_insert, str_remove, str_walk };
+
+// Infos are odd integers so they are never NULL
+static void* ref[NUM_KEYS];
+static uintptr_t next_info = 1;
+
+static void* new_info(void)
+{
+    void* result = (void*)next_info;
+    next_info += 2;
+    return result;
+}
+
+static void check_contents(table_t* t, const char* when)
+{
+    int k;
+    for (k = 0; k < NUM_KEYS; k++)
+    {
+        void* info = t->query(t->table, k);
+        CHECK(info == ref[k], "%s: %s: key %d has info %p instead of %p",
+                t->name, when, k, info, ref[k]);
+    }
+}
+
+enum { UNTOUCHED = 0, REMOVED, INSERTED };
+
+typedef struct walk_state_tag
+{
+    table_t* t;
+    char present_at_start[NUM_KEYS];
+    char touched[NUM_KEYS];
+    int visited[NUM_KEYS];
+    int num_nested;
+} walk_state_t;
+
+static void nested_walk_fn(int k, void* info, void* walk_info)
+{
+    walk_state_t* state = (walk_state_t*)walk_info;
+    // Removals are already hidden, insertions are not walked yet
+    CHECK(ref[k] != NULL && state->touched[k] != INSERTED,
+            "%s: nested walk visited key %d", state->t->name, k);
+    CHECK(info == ref[k], "%s: nested walk found info %p instead of %p for key %d",
+            state->t->name, info, ref[k], k);
+}
+
+static void walk_fn(int k, void* info, void* walk_info)
+{
+    walk_state_t* state = (walk_state_t*)walk_info;
+    table_t* t = state->t;
+
+    CHECK(state->present_at_start[k], "%s: walked key %d that was not in the table", t->name, k);
+    CHECK(state->touched[k] != REMOVED, "%s: walked key %d after removing it", t->name, k);
+    CHECK(state->touched[k] != INSERTED, "%s: walked key %d inserted by the walk", t->name, k);
+    CHECK(info == ref[k], "%s: walk found info %p instead of %p for key %d", t->name, info, ref[k], k);
+    state->visited[k]++;
+
+    switch (rng() % 8)
+    {
+        case 0:
+            {
+                // Remove another key present at the start, maybe not walked yet
+                int other = rng() % NUM_KEYS;
+                if (ref[other] != NULL && state->touched[other] == UNTOUCHED)
+                {
+                    t->remove(t->table, other);
+                    ref[other] = NULL;
+                    state->touched[other] = REMOVED;
+                }
+                break;
+            }
+        case 1:
+            {
+                // Insert a key that was not there
+                int other = rng() % NUM_KEYS;
+                if (ref[other] == NULL && state->touched[other] == UNTOUCHED)
+                {
+                    ref[other] = new_info();
+                    t->insert(t->table, other, ref[other]);
+                    state->touched[other] = INSERTED;
+                }
+                break;
+            }
+        case 2:
+            {
+                // Replace the info of the current key
+                ref[k] = new_info();
+                t->insert(t->table, k, ref[k]);
+                break;
+            }
+        case 3:
+            {
+                int other = rng() % NUM_KEYS;
+                void* found = t->query(t->table, other);
+                CHECK(found == ref[other], "%s: query during a walk found %p instead of %p for key %d",
+                        t->name, found, ref[other], other);
+                break;
+            }
+        case 4:
+            {
+                if (state->num_nested < 2)
+                {
+                    state->num_nested++;
+                    t->walk(t->table, nested_walk_fn, state);
+                }
+                break;
+            }
+        default:
+            break;
+    }
+}
+
+static void check_walk(table_t* t)
+{
+    static walk_state_t state;
+    int k;
+
+    memset(&state, 0, sizeof(state));
+    state.t = t;
+    for (k = 0; k < NUM_KEYS; k++)
+        state.present_at_start[k] = (ref[k] != NULL);
+
+    t->walk(t->table, walk_fn, &state);
+
+    for (k = 0; k < NUM_KEYS; k++)
+    {
+        int expected = state.present_at_start[k] && state.touched[k] != REMOVED;
+        // A key removed after being walked has been walked once
+        if (state.touched[k] == REMOVED && state.visited[k] == 1)
+            expected = 1;
+        CHECK(state.visited[k] == expected, "%s: key %d walked %d times instead of %d",
+                t->name, k, state.visited[k], expected);
+    }
+
+    check_contents(t, "after a walk");
+}
+
+static void check_table(table_t* t, int steps)
+{
+    int i, range = 16;
+
+    memset(ref, 0, sizeof(ref));
+    t->table = t->new_(0);
+
+    for (i = 0; i < steps; i++)
+    {
+        // Grow the range of keys used and then shrink it back so the table
+        // grows, migrates and empties again
+        int phase = i % 400000;
+        range = phase < 200000
+            ? 16 + (int)((long)(NUM_KEYS - 16) * phase / 200000)
+            : 16 + (int)((long)(NUM_KEYS - 16) * (400000 - phase) / 200000);
+        int k = rng() % range;
+        int op = rng() % 10;
+
+        if (phase >= 200000 && op < 5)
+            op += 5;
+
+        if (op < 4)
+        {
+            ref[k] = new_info();
+            t->insert(t->table, k, ref[k]);
+        }
+        else if (op < 6)
+        {
+            void* found = t->query(t->table, k);
+            CHECK(found == ref[k], "%s: step %d: key %d has info %p instead of %p",
+                    t->name, i, k, found, ref[k]);
+        }
+        else
+        {
+            t->remove(t->table, k);
+            ref[k] = NULL;
+        }
+
+        if (i % 50000 == 49999)
+            check_walk(t);
+        if (i % 100000 == 99999)
+            check_contents(t, "periodic check");
+    }
+
+    check_contents(t, "final check");
+    t->destroy(t->table);
+    t->table = NULL;
+
+    // Bulk build and tear down of many small tables
+    for (i = 0; i < 20000; i++)
+    {
+        int n = i % 9, j;
+        void* table = t->new_(n);
+        for (j = 0; j < n; j++)
+            t->insert(table, j, (void*)(uintptr_t)(2 * j + 1));
+        for (j = 0; j < n; j += 2)
+            t->remove(table, j);
+        for (j = 0; j < 9; j++)
+        {
+            void* expected = (j < n && j % 2 == 1) ? (void*)(uintptr_t)(2 * j + 1) : NULL;
+            void* found = t->query(table, j);
+            CHECK(found == expected, "%s: small table of %d: key %d has info %p instead of %p",
+                    t->name, n, j, found, expected);
+        }
+        t->destroy(table);
+    }
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench(int num_keys, int num_lookups)
+{
+    double start;
+    long found = 0;
+    int i, j;
+
+    // Like scopes: most tables hold a few names and are queried a few times
+    start = now();
+    char* small_keys = malloc(8);
+    for (i = 0; i < 200000; i++)
+    {
+        dhash_ptr_t* table = dhash_ptr_new(5);
+        for (j = 0; j < 3; j++)
+            dhash_ptr_insert(table, &small_keys[j], &small_keys[j]);
+        for (j = 0; j < 20; j++)
+            found += (dhash_ptr_query(table, &small_keys[j % 8]) != NULL);
+        dhash_ptr_destroy(table);
+    }
+    printf("tiny tables: 200000 tables, 20 lookups each: %.3fs\n", now() - start);
+
+    char* keys = malloc(num_keys);
+    char** names = malloc(num_keys * sizeof(*names));
+    for (i = 0; i < num_keys; i++)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "name_%d", i);
+        names[i] = strdup(buffer);
+    }
+
+    start = now();
+    dhash_ptr_t* ptr = dhash_ptr_new(0);
+    for (i = 0; i < num_keys; i++)
+        dhash_ptr_insert(ptr, &keys[i], &keys[i]);
+    for (i = 0; i < num_lookups; i++)
+        found += (dhash_ptr_query(ptr, &keys[rng() % num_keys]) != NULL);
+    for (i = 0; i < num_keys; i += 2)
+        dhash_ptr_remove(ptr, &keys[i]);
+    dhash_ptr_destroy(ptr);
+    printf("dhash_ptr: %d keys, %d lookups: %.3fs\n", num_keys, num_lookups, now() - start);
+
+    start = now();
+    dhash_str_t* str = dhash_str_new(0);
+    for (i = 0; i < num_keys; i++)
+        dhash_str_insert(str, names[i], names[i]);
+    for (i = 0; i < num_lookups; i++)
+        found += (dhash_str_query(str, names[rng() % num_keys]) != NULL);
+    for (i = 0; i < num_keys; i += 2)
+        dhash_str_remove(str, names[i]);
+    dhash_str_destroy(str);
+    printf("dhash_str: %d keys, %d lookups: %.3fs\n", num_keys, num_lookups, now() - start);
+
+    // Keep the lookups from being optimized away
+    if (found == 0)
+        printf("nothing found\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc >= 2 && strcmp(argv[1], "check") == 0)
+    {
+        int steps = argc >= 3 ? atoi(argv[2]) : 2000000;
+        init_keys();
+        check_table(&ptr_table, steps);
+        check_table(&str_table, steps);
+        if (num_errors != 0)
+            return EXIT_FAILURE;
+        printf("dhash_ptr and dhash_str agree with the reference after %d steps each\n", steps);
+        return EXIT_SUCCESS;
+    }
+    else if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+    {
+        bench(argc >= 3 ? atoi(argv[2]) : 1000000,
+                argc >= 4 ? atoi(argv[3]) : 5000000);
+        return EXIT_SUCCESS;
+    }
+
+    fprintf(stderr, "usage: %s check [steps] | bench [keys] [lookups]\n", argv[0]);
+    return EXIT_FAILURE;
+}
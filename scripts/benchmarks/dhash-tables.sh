@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+
+# Checks and times the dhash tables of lib with dhash-tables.c, a standalone
+# driver that does not need a configured build tree.
+#
+#   dhash-tables.sh <srcdir-after> [srcdir-before] [keys] [lookups] [steps]
+#
+# The dhash tables of <srcdir-after> are cross-checked against a reference
+# array for <steps> random operations (default 2000000), including walks that
+# mutate the table. Then the tables of each source tree are timed with
+# <keys> keys (default 1000000) and <lookups> lookups (default 5000000).
+# [srcdir-before] is only timed and may be "-" to skip it.
+
+set -e
+
+if [ $# -lt 1 ];
+then
+    echo "usage: $0 <srcdir-after> [srcdir-before] [keys] [lookups] [steps]" 1>&2
+    exit 1
+fi
+
+SRCDIR_AFTER=$1
+SRCDIR_BEFORE=${2:--}
+KEYS=${3:-1000000}
+LOOKUPS=${4:-5000000}
+STEPS=${5:-2000000}
+CC=${CC:-gcc}
+
+DRIVER=$(cd "$(dirname "$0")" && pwd)/dhash-tables.c
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+build()
+{
+    local srcdir=$1
+    local output=$2
+    ${CC} -O2 -I "${srcdir}/lib" -o "${output}" "${DRIVER}" \
+        "${srcdir}/lib/dhash_ptr.c" "${srcdir}/lib/dhash_str.c" "${srcdir}/lib/mem.c"
+}
+
+build "${SRCDIR_AFTER}" "${WORKDIR}/after"
+"${WORKDIR}/after" check "${STEPS}"
+
+if [ "${SRCDIR_BEFORE}" != "-" ];
+then
+    build "${SRCDIR_BEFORE}" "${WORKDIR}/before"
+    echo "before (${SRCDIR_BEFORE}):"
+    "${WORKDIR}/before" bench "${KEYS}" "${LOOKUPS}"
+fi
+
+echo "after (${SRCDIR_AFTER}):"
+"${WORKDIR}/after" bench "${KEYS}" "${LOOKUPS}"
@@ -0,0 +1,85 @@
+#!/usr/bin/env bash
+
+# Compares the time spent lowering a task-heavy input with two builds of
+# Mercurium, e.g. before and after a change in the Nanos6 lowering.
+#
+#   nanos6-lowering.sh <mcc-before> <mcc-after> [functions] [runs]
+#
+# The input has <functions> functions (default 2000), each one with a
+# taskloop, two tasks and four atomic updates. The taskloop loop control and
+# the atomic updates are the code built with Nodecl::Builder instead of being
+# parsed. Each compiler is run <runs> times (default 5)
+# with -y so only the frontend and the phases are measured, and the best
+# wall time is reported. Both compilers must find the Nanos6 headers.
+
+set -e
+
+if [ $# -lt 2 ];
+then
+    echo "usage: $0 <mcc-before> <mcc-after> [functions] [runs]" 1>&2
+    exit 1
+fi
+
+MCC_BEFORE=$1
+MCC_AFTER=$2
+FUNCTIONS=${3:-2000}
+RUNS=${4:-5}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+INPUT=${WORKDIR}/nanos6-lowering.c
+
+{
+    echo "void g(int *v, int n);"
+    for ((i = 0; i < FUNCTIONS; i++));
+    do
+        cat <<EOC
+void f${i}(int *v, int n, long *counter)
+{
+    int i;
+    #pragma oss taskloop grainsize(16) firstprivate(n) shared(v)
+    for (i = 0; i < n; i++)
+    {
+        v[i] += i * ${i};
+        #pragma oss atomic
+        (*counter)++;
+        #pragma oss atomic
+        v[0] += i;
+        #pragma oss atomic
+        v[1] |= i;
+        #pragma oss atomic
+        --v[2];
+    }
+    #pragma oss task inout(v[0;n])
+    g(v, n);
+    #pragma oss task in(v[0;n])
+    g(v, n - 1);
+    #pragma oss taskwait
+}
+EOC
+    done
+} > ${INPUT}
+
+best_time()
+{
+    local mcc=$1
+    local best=
+    for ((r = 0; r < RUNS; r++));
+    do
+        local start=$(date +%s.%N)
+        ${mcc} --ompss-2 -y -o ${WORKDIR}/out.c ${INPUT}
+        local end=$(date +%s.%N)
+        best=$(awk -v s=${start} -v e=${end} -v b="${best}" \
+            'BEGIN { t = e - s; if (b == "" || t < b) b = t; printf "%.3f", b }')
+    done
+    echo ${best}
+}
+
+BEFORE=$(best_time ${MCC_BEFORE})
+AFTER=$(best_time ${MCC_AFTER})
+
+echo "Input: ${FUNCTIONS} functions, best of ${RUNS} runs"
+echo "Before: ${BEFORE} s"
+echo "After:  ${AFTER} s"
+echo "Speedup: $(awk -v b=${BEFORE} -v a=${AFTER} 'BEGIN { printf "%.3f", b / a }')"
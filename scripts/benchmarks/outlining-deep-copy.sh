@@ -0,0 +1,85 @@
+#!/usr/bin/env bash
+
+# Compares the time spent outlining tasks with many captured variables with
+# two builds of Mercurium. Outlining deep copies the task body through a
+# symbol map with one entry per captured variable, nested once per task.
+#
+#   outlining-deep-copy.sh <mcc-before> <mcc-after> [variables] [functions] [runs]
+#
+# The input has <functions> functions (default 50), each one declaring
+# <variables> variables (default 400) used inside a task that contains
+# another task using them too. Each compiler is run <runs> times
+# (default 5) with -y and the best wall time is reported. Both compilers
+# must find the Nanos6 headers.
+
+set -e
+
+if [ $# -lt 2 ];
+then
+    echo "usage: $0 <mcc-before> <mcc-after> [variables] [functions] [runs]" 1>&2
+    exit 1
+fi
+
+MCC_BEFORE=$1
+MCC_AFTER=$2
+VARIABLES=${3:-400}
+FUNCTIONS=${4:-50}
+RUNS=${5:-5}
+
+WORKDIR=$(mktemp -d)
+trap "rm -rf ${WORKDIR}" EXIT
+
+INPUT=${WORKDIR}/outlining-deep-copy.c
+
+{
+    for ((i = 0; i < FUNCTIONS; i++));
+    do
+        echo "int f${i}(void)"
+        echo "{"
+        for ((v = 0; v < VARIABLES; v++));
+        do
+            echo "    int v${v} = ${v};"
+        done
+        echo "    int sum = 0;"
+        echo "    #pragma oss task inout(sum)"
+        echo "    {"
+        for ((v = 0; v < VARIABLES; v++));
+        do
+            echo "        sum += v${v};"
+        done
+        echo "        #pragma oss task inout(sum)"
+        echo "        {"
+        for ((v = 0; v < VARIABLES; v++));
+        do
+            echo "            sum -= v${v};"
+        done
+        echo "        }"
+        echo "    }"
+        echo "    #pragma oss taskwait"
+        echo "    return sum;"
+        echo "}"
+    done
+} > ${INPUT}
+
+best_time()
+{
+    local mcc=$1
+    local best=
+    for ((r = 0; r < RUNS; r++));
+    do
+        local start=$(date +%s.%N)
+        ${mcc} --ompss-2 -y -o ${WORKDIR}/out.c ${INPUT}
+        local end=$(date +%s.%N)
+        best=$(awk -v s=${start} -v e=${end} -v b="${best}" \
+            'BEGIN { t = e - s; if (b == "" || t < b) b = t; printf "%.3f", b }')
+    done
+    echo ${best}
+}
+
+BEFORE=$(best_time ${MCC_BEFORE})
+AFTER=$(best_time ${MCC_AFTER})
+
+echo "Input: ${FUNCTIONS} functions with ${VARIABLES} captured variables, best of ${RUNS} runs"
+echo "Before: ${BEFORE} s"
+echo "After:  ${AFTER} s"
+echo "Speedup: $(awk -v b=${BEFORE} -v a=${AFTER} 'BEGIN { printf "%.3f", b / a }')"
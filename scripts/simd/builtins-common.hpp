@@ -1,6 +1,8 @@
 #ifndef BUILTINS_COMMON_HPP
 #define BUILTINS_COMMON_HPP
 
+#include <vector>
+
 template <typename T>
 struct generate_type
 {
@@ -797,8 +799,34 @@ struct generate_type<R(T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13,
     }
 };
 
+// Every builtin is signed in by its own function and all of them are listed
+// in a table, so the frontend only creates those actually referenced. The file
+// including the generated code defines LAZY_BUILTIN_SIGN_IN and
+// LAZY_BUILTINS_TABLE to give them unique names
+static std::vector<std::string> lazy_builtin_names;
+
+static void begin_lazy_builtin(const std::string& str)
+{
+    lazy_builtin_names.push_back(str);
+    std::cout
+        << "static void LAZY_BUILTIN_SIGN_IN(" << str << ")(const decl_context_t* decl_context, "
+        << "const locus_t* builtins_locus UNUSED_PARAMETER)\n";
+}
+
+static void end_lazy_builtins()
+{
+    std::cout << "static lazy_symbol_t LAZY_BUILTINS_TABLE[] =\n{\n";
+    for (std::vector<std::string>::iterator it = lazy_builtin_names.begin();
+            it != lazy_builtin_names.end();
+            it++)
+    {
+        std::cout << "{ \"" << *it << "\", LAZY_BUILTIN_SIGN_IN(" << *it << ") },\n";
+    }
+    std::cout << "};\n";
+}
+
 template <typename T>
-void f(const std::string& str)
+void f_body(const std::string& str)
 {
     std::cout 
         << "{\n"
@@ -812,4 +840,11 @@ void f(const std::string& str)
         ;
 }
 
+template <typename T>
+void f(const std::string& str)
+{
+    begin_lazy_builtin(str);
+    f_body<T>(str);
+}
+
 #endif // BUILTINS_COMMON_HPP
@@ -1694,6 +1694,7 @@ struct generate_type<__builtin_aarch64_simd_xi> // 8 double registers
 
 static void do_alias(const char* newname, const char* existing)
 {
+    begin_lazy_builtin(newname);
     std::cout << "{\n"
         << "scope_entry_list_t *entry_list = query_in_scope_str(decl_context, uniquestr(\"" << existing << "\"), /* field_path */ NULL);\n"
         << "ERROR_CONDITION(entry_list == NULL, \"Symbol '" << existing << "' should have been declared\",0);\n"
@@ -1715,4 +1716,6 @@ int main(int, char**)
     do_alias(#newname, #existing);
     VECTOR_INTRINSICS_LIST
 #undef VECTOR_INTRIN
+
+    end_lazy_builtins();
 }
@@ -119,12 +119,15 @@ int main(int, char**)
     f<__typeof__(X)>(#X);
 
 #define OVERLOADED_VECTOR_INTRIN(X) \
-    std::cout << "if (IS_CXX_LANGUAGE) {\n";  \
-        VECTOR_INTRIN(X) \
+    begin_lazy_builtin(#X); \
+    std::cout << "{\nif (IS_CXX_LANGUAGE)\n";  \
+        f_body<__typeof__(X)>(#X); \
     std::cout << "}\n";
 
     VECTOR_INTRINSICS_LIST
 
 #undef VECTOR_INTRIN
 #undef OVERLOADED_VECTOR_INTRIN
+
+    end_lazy_builtins();
 }
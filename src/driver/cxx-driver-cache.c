@@ -0,0 +1,680 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2013 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+
+#ifdef HAVE_CONFIG_H
+  #include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if defined(__linux__)
+  #include <link.h>
+#endif
+
+#include "cxx-driver-cache.h"
+#include "cxx-driver-utils.h"
+#include "cxx-driver.h"
+#include "cxx-utils.h"
+#include "uniquestr.h"
+#include "dhash_str.h"
+
+// Lane 0 is FNV-1a, lane 1 uses the same scheme with a different basis and
+// multiplier so both lanes do not collide at the same time
+#define CACHE_HASH_BASIS_0 UINT64_C(0xcbf29ce484222325)
+#define CACHE_HASH_PRIME_0 UINT64_C(0x100000001b3)
+#define CACHE_HASH_BASIS_1 UINT64_C(0x84222325cbf29ce4)
+#define CACHE_HASH_PRIME_1 UINT64_C(0x9e3779b97f4a7c15)
+
+void cache_hash_init(cache_hash_t* hash)
+{
+    hash->lane[0] = CACHE_HASH_BASIS_0;
+    hash->lane[1] = CACHE_HASH_BASIS_1;
+}
+
+void cache_hash_bytes(cache_hash_t* hash, const void* data, size_t size)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h0 = hash->lane[0];
+    uint64_t h1 = hash->lane[1];
+
+    size_t i;
+    for (i = 0; i < size; i++)
+    {
+        h0 = (h0 ^ p[i]) * CACHE_HASH_PRIME_0;
+        h1 = (h1 ^ p[i]) * CACHE_HASH_PRIME_1;
+    }
+
+    hash->lane[0] = h0;
+    hash->lane[1] = h1;
+}
+
+void cache_hash_string(cache_hash_t* hash, const char* str)
+{
+    if (str == NULL)
+        str = "";
+
+    cache_hash_bytes(hash, str, strlen(str) + 1);
+}
+
+char cache_hash_file(cache_hash_t* hash, const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return 1;
+
+    char buffer[8192];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        cache_hash_bytes(hash, buffer, n);
+    }
+
+    char failed = (ferror(f) != 0);
+    fclose(f);
+
+    return failed;
+}
+
+const char* cache_hash_to_str(const cache_hash_t* hash)
+{
+    char c[33];
+    snprintf(c, sizeof(c), "%016llx%016llx",
+            (unsigned long long)hash->lane[0],
+            (unsigned long long)hash->lane[1]);
+    c[32] = '\0';
+
+    return uniquestr(c);
+}
+
+static const char* cache_directory(const char** cache_dir, const char* description)
+{
+    const char* dir = *cache_dir;
+    if (dir == NULL)
+        return NULL;
+
+    struct stat buf;
+    if (stat(dir, &buf) != 0)
+    {
+        if (mkdir(dir, 0755) != 0
+                && errno != EEXIST)
+        {
+            fprintf(stderr, "%s: warning: cannot create %s cache directory '%s' (%s). "
+                    "Cache disabled\n",
+                    compilation_process.exec_basename,
+                    description,
+                    dir,
+                    strerror(errno));
+            *cache_dir = NULL;
+            return NULL;
+        }
+    }
+    else if (!S_ISDIR(buf.st_mode))
+    {
+        fprintf(stderr, "%s: warning: %s cache '%s' is not a directory. "
+                "Cache disabled\n",
+                compilation_process.exec_basename,
+                description,
+                dir);
+        *cache_dir = NULL;
+        return NULL;
+    }
+
+    return dir;
+}
+
+static const char* ppcache_directory(void)
+{
+    return cache_directory(&compilation_process.preprocessor_cache_dir, "preprocessing");
+}
+
+static const char* ppcache_key(const char* input_filename,
+        int num_options, const char** preprocessor_options)
+{
+    cache_hash_t hash;
+    cache_hash_init(&hash);
+
+    cache_hash_string(&hash, "ppcache-1");
+    cache_hash_string(&hash, CURRENT_CONFIGURATION->configuration_name);
+    cache_hash_bytes(&hash,
+            &CURRENT_CONFIGURATION->source_language,
+            sizeof(CURRENT_CONFIGURATION->source_language));
+    cache_hash_string(&hash, CURRENT_CONFIGURATION->preprocessor_name);
+
+    int i;
+    for (i = 0; i < num_options; i++)
+    {
+        cache_hash_string(&hash, preprocessor_options[i]);
+    }
+
+    // Relative include paths depend on the current directory
+    char current_directory[1024];
+    if (getcwd(current_directory, sizeof(current_directory)) == NULL)
+        return NULL;
+    cache_hash_string(&hash, current_directory);
+
+    cache_hash_string(&hash, input_filename);
+    if (cache_hash_file(&hash, input_filename) != 0)
+        return NULL;
+
+    return cache_hash_to_str(&hash);
+}
+
+static const char* cache_entry_filename(const char* dir, const char* key, const char* extension)
+{
+    char c[1024];
+    snprintf(c, sizeof(c), "%s%s%s%s", dir, DIR_SEPARATOR, key, extension);
+    c[sizeof(c) - 1] = '\0';
+
+    return uniquestr(c);
+}
+
+static const char* file_hash_str(const char* filename)
+{
+    cache_hash_t hash;
+    cache_hash_init(&hash);
+    if (cache_hash_file(&hash, filename) != 0)
+        return NULL;
+
+    return cache_hash_to_str(&hash);
+}
+
+const char* ppcache_lookup(const char* input_filename,
+        int num_options, const char** preprocessor_options)
+{
+    const char* dir = ppcache_directory();
+    if (dir == NULL)
+        return NULL;
+
+    const char* key = ppcache_key(input_filename, num_options, preprocessor_options);
+    if (key == NULL)
+        return NULL;
+
+    const char* preprocessed_filename = cache_entry_filename(dir, key, ".i");
+    const char* dependences_filename = cache_entry_filename(dir, key, ".d");
+
+    FILE* dependences = fopen(dependences_filename, "r");
+    if (dependences == NULL)
+        return NULL;
+
+    // Every line is '<hash> <filename>'
+    char valid = 1;
+    char line[4096];
+    while (valid
+            && fgets(line, sizeof(line), dependences) != NULL)
+    {
+        char* newline = strchr(line, '\n');
+        if (newline == NULL)
+        {
+            valid = 0;
+            break;
+        }
+        *newline = '\0';
+
+        char* filename = strchr(line, ' ');
+        if (filename == NULL)
+        {
+            valid = 0;
+            break;
+        }
+        *filename = '\0';
+        filename++;
+
+        const char* current_hash = file_hash_str(filename);
+        valid = (current_hash != NULL
+                && strcmp(current_hash, line) == 0);
+    }
+    fclose(dependences);
+
+    if (!valid
+            || access(preprocessed_filename, R_OK) != 0)
+        return NULL;
+
+    if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "Using cached preprocessed file '%s' for '%s'\n",
+                preprocessed_filename,
+                input_filename);
+    }
+
+    return preprocessed_filename;
+}
+
+// Gets the filename of a line marker '# 12 "file"' or '#line 12 "file"'
+static const char* filename_of_line_marker(const char* line)
+{
+    const char* p = line;
+    if (*p != '#')
+        return NULL;
+    p++;
+
+    while (*p == ' ' || *p == '\t')
+        p++;
+    if (strncmp(p, "line", strlen("line")) == 0)
+        p += strlen("line");
+    while (*p == ' ' || *p == '\t')
+        p++;
+
+    if (!('0' <= *p && *p <= '9'))
+        return NULL;
+    while ('0' <= *p && *p <= '9')
+        p++;
+    while (*p == ' ' || *p == '\t')
+        p++;
+
+    if (*p != '"')
+        return NULL;
+    p++;
+
+    char filename[4096];
+    unsigned int length = 0;
+    while (*p != '"' && *p != '\0'
+            && length < sizeof(filename) - 1)
+    {
+        if (*p == '\\' && *(p + 1) != '\0')
+            p++;
+        filename[length] = *p;
+        length++;
+        p++;
+    }
+
+    if (*p != '"')
+        return NULL;
+    filename[length] = '\0';
+
+    return uniquestr(filename);
+}
+
+typedef struct ppcache_dependences_tag
+{
+    dhash_str_t* seen;
+    int num_filenames;
+    const char** filenames;
+} ppcache_dependences_t;
+
+static char ppcache_compute_dependences(const char* input_filename,
+        const char* preprocessed_filename,
+        ppcache_dependences_t* dependences)
+{
+    FILE* f = fopen(preprocessed_filename, "r");
+    if (f == NULL)
+        return 0;
+
+    char at_line_start = 1;
+    char line[4096];
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        char is_line_start = at_line_start;
+        at_line_start = (strchr(line, '\n') != NULL);
+
+        if (!is_line_start
+                || line[0] != '#')
+            continue;
+
+        const char* filename = filename_of_line_marker(line);
+        if (filename == NULL
+                // <built-in>, <command-line>, ...
+                || filename[0] == '<'
+                || filename == input_filename
+                || dhash_str_query(dependences->seen, filename) != NULL)
+            continue;
+
+        dhash_str_insert(dependences->seen, filename, (void*)filename);
+        P_LIST_ADD(dependences->filenames, dependences->num_filenames, filename);
+    }
+
+    fclose(f);
+    return 1;
+}
+
+void ppcache_store(const char* input_filename,
+        int num_options, const char** preprocessor_options,
+        const char* preprocessed_filename)
+{
+    const char* dir = ppcache_directory();
+    if (dir == NULL)
+        return;
+
+    int i;
+    for (i = 0; i < num_options; i++)
+    {
+        // Without line markers we cannot know the included files
+        if (strcmp(preprocessor_options[i], "-P") == 0)
+            return;
+    }
+
+    const char* key = ppcache_key(input_filename, num_options, preprocessor_options);
+    if (key == NULL)
+        return;
+
+    ppcache_dependences_t dependences;
+    memset(&dependences, 0, sizeof(dependences));
+    dependences.seen = dhash_str_new(0);
+
+    char ok = ppcache_compute_dependences(uniquestr(input_filename),
+            preprocessed_filename, &dependences);
+
+    char pid_extension[64];
+    snprintf(pid_extension, sizeof(pid_extension), ".%d", (int)getpid());
+    pid_extension[63] = '\0';
+
+    const char* cached_preprocessed_filename = cache_entry_filename(dir, key, ".i");
+    const char* cached_dependences_filename = cache_entry_filename(dir, key, ".d");
+
+    // Write in private files and rename them so concurrent compilations
+    // never see incomplete entries. Dependences go last since they are what
+    // makes an entry valid
+    const char* new_preprocessed_filename = strappend(cached_preprocessed_filename, pid_extension);
+    const char* new_dependences_filename = strappend(cached_dependences_filename, pid_extension);
+
+    FILE* f = NULL;
+    if (ok)
+    {
+        ok = (copy_file(preprocessed_filename, new_preprocessed_filename) == 0);
+    }
+    if (ok)
+    {
+        f = fopen(new_dependences_filename, "w");
+        ok = (f != NULL);
+    }
+    for (i = 0; ok && i < dependences.num_filenames; i++)
+    {
+        const char* hash_str = file_hash_str(dependences.filenames[i]);
+        ok = (hash_str != NULL
+                && fprintf(f, "%s %s\n", hash_str, dependences.filenames[i]) > 0);
+    }
+    if (f != NULL)
+    {
+        ok = (fclose(f) == 0) && ok;
+    }
+    ok = ok
+        && rename(new_preprocessed_filename, cached_preprocessed_filename) == 0
+        && rename(new_dependences_filename, cached_dependences_filename) == 0;
+
+    if (!ok)
+    {
+        remove(new_preprocessed_filename);
+        remove(new_dependences_filename);
+    }
+    else if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "Preprocessed file of '%s' stored in the cache as '%s'\n",
+                input_filename,
+                cached_preprocessed_filename);
+    }
+
+    DELETE(dependences.filenames);
+    dhash_str_destroy(dependences.seen);
+}
+
+static const char* occache_directory(void)
+{
+    return cache_directory(&compilation_process.output_cache_dir, "output");
+}
+
+static void cache_hash_file_stat(cache_hash_t* hash, const char* filename)
+{
+    cache_hash_string(hash, filename);
+
+    struct stat buf;
+    if (stat(filename, &buf) != 0)
+        return;
+
+    uint64_t size = buf.st_size;
+    uint64_t mtime = buf.st_mtime;
+    cache_hash_bytes(hash, &size, sizeof(size));
+    cache_hash_bytes(hash, &mtime, sizeof(mtime));
+}
+
+#if defined(__linux__)
+static int hash_loaded_library(struct dl_phdr_info *info,
+        size_t size UNUSED_PARAMETER, void *data)
+{
+    cache_hash_t* hash = (cache_hash_t*)data;
+
+    // The main program has an empty name
+    if (info->dlpi_name != NULL
+            && info->dlpi_name[0] != '\0')
+    {
+        cache_hash_file_stat(hash, info->dlpi_name);
+    }
+
+    return 0;
+}
+#endif
+
+// Compiler phases are loaded with dlopen so hashing every loaded library
+// covers them, the driver itself and the libraries it uses
+static void cache_hash_loaded_libraries(cache_hash_t* hash)
+{
+#if defined(__linux__)
+    cache_hash_file_stat(hash, "/proc/self/exe");
+    dl_iterate_phdr(hash_loaded_library, hash);
+#else
+    cache_hash_string(hash, compilation_process.argv[0]);
+#endif
+}
+
+static void cache_hash_configuration(cache_hash_t* hash,
+        compilation_configuration_t* configuration)
+{
+    for (; configuration != NULL; configuration = configuration->base_configuration)
+    {
+        cache_hash_string(hash, configuration->configuration_name);
+
+        int i;
+        for (i = 0; i < configuration->num_configuration_lines; i++)
+        {
+            compilation_configuration_line_t* line = configuration->configuration_lines[i];
+            // Flags of the line are given by the command line, which is
+            // already part of the key, so its location suffices
+            cache_hash_string(hash, line->filename);
+            cache_hash_bytes(hash, &line->line, sizeof(line->line));
+            cache_hash_string(hash, line->name);
+            cache_hash_string(hash, line->index);
+            cache_hash_string(hash, line->value);
+        }
+    }
+}
+
+// These options do not change the generated objects so they should not
+// prevent reusing them
+static char option_does_not_change_output(const char* option)
+{
+    const char* options[] =
+    {
+        "-j", "--jobs=", "--native-jobs=", "--pp-cache=", "--output-cache=",
+        "--check-tree=", NULL
+    };
+
+    int i;
+    for (i = 0; options[i] != NULL; i++)
+    {
+        if (strncmp(option, options[i], strlen(options[i])) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+// These options take their value in the next argument, which does not
+// change the generated objects either
+static char option_with_ignored_argument(const char* option)
+{
+    return (strcmp(option, "-o") == 0
+            || strcmp(option, "-j") == 0);
+}
+
+// Input files are identified by their preprocessed contents, not by their
+// names, so an object can be reused for a copy of the input file or when
+// several files are given in the command line
+static char argument_is_input_file(const char* argument)
+{
+    int i;
+    for (i = 0; i < compilation_process.num_translation_units; i++)
+    {
+        if (strcmp(compilation_process.translation_units[i]->translation_unit->input_filename,
+                    argument) == 0)
+            return 1;
+    }
+
+    for (i = 0; i < CURRENT_CONFIGURATION->num_args_linker_command; i++)
+    {
+        if (strcmp(CURRENT_CONFIGURATION->linker_command[i]->argument, argument) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+// Debug information records the directory where the object was compiled
+static char native_options_emit_debug_information(void)
+{
+    int num_native_options = count_null_ended_array((void**)CURRENT_CONFIGURATION->native_compiler_options);
+    int i;
+    for (i = 0; i < num_native_options; i++)
+    {
+        if (strncmp(CURRENT_CONFIGURATION->native_compiler_options[i], "-g", 2) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+const char* occache_key(const char* parsed_filename)
+{
+    cache_hash_t hash;
+    cache_hash_init(&hash);
+
+    cache_hash_string(&hash, "occache-2");
+    cache_hash_string(&hash, compilation_process.exec_basename);
+
+    int i;
+    for (i = 1; i < compilation_process.argc; i++)
+    {
+        const char* argument = compilation_process.argv[i];
+        if (option_with_ignored_argument(argument))
+        {
+            i++;
+        }
+        else if (strncmp(argument, "-o", 2) == 0
+                || option_does_not_change_output(argument)
+                || argument_is_input_file(argument))
+        {
+            // Skip it
+        }
+        else
+        {
+            cache_hash_string(&hash, argument);
+        }
+    }
+
+    cache_hash_configuration(&hash, CURRENT_CONFIGURATION);
+
+    cache_hash_string(&hash, CURRENT_CONFIGURATION->native_compiler_name);
+    int num_native_options = count_null_ended_array((void**)CURRENT_CONFIGURATION->native_compiler_options);
+    for (i = 0; i < num_native_options; i++)
+    {
+        cache_hash_string(&hash, CURRENT_CONFIGURATION->native_compiler_options[i]);
+    }
+
+    cache_hash_loaded_libraries(&hash);
+
+    if (native_options_emit_debug_information())
+    {
+        char current_directory[1024];
+        if (getcwd(current_directory, sizeof(current_directory)) == NULL)
+            return NULL;
+        cache_hash_string(&hash, current_directory);
+    }
+
+    // The line markers of the preprocessed input already tell its name
+    if (cache_hash_file(&hash, parsed_filename) != 0)
+        return NULL;
+
+    return cache_hash_to_str(&hash);
+}
+
+char occache_lookup(const char* key, const char* output_filename)
+{
+    const char* dir = occache_directory();
+    if (dir == NULL)
+        return 0;
+
+    const char* cached_filename = cache_entry_filename(dir, key, ".o");
+    if (access(cached_filename, R_OK) != 0)
+        return 0;
+
+    if (copy_file(cached_filename, output_filename) != 0)
+    {
+        remove(output_filename);
+        return 0;
+    }
+
+    if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "Using cached output '%s' as '%s'\n",
+                cached_filename,
+                output_filename);
+    }
+
+    return 1;
+}
+
+void occache_store(const char* key, const char* output_filename)
+{
+    const char* dir = occache_directory();
+    if (dir == NULL)
+        return;
+
+    char pid_extension[64];
+    snprintf(pid_extension, sizeof(pid_extension), ".%d", (int)getpid());
+    pid_extension[63] = '\0';
+
+    const char* cached_filename = cache_entry_filename(dir, key, ".o");
+    const char* new_cached_filename = strappend(cached_filename, pid_extension);
+
+    if (copy_file(output_filename, new_cached_filename) != 0
+            || rename(new_cached_filename, cached_filename) != 0)
+    {
+        remove(new_cached_filename);
+        return;
+    }
+
+    if (CURRENT_CONFIGURATION->verbose)
+    {
+        fprintf(stderr, "Output '%s' stored in the cache as '%s'\n",
+                output_filename,
+                cached_filename);
+    }
+}
@@ -0,0 +1,95 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2013 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+
+#ifndef CXX_DRIVER_CACHE_H
+#define CXX_DRIVER_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cxx-macros.h"
+
+MCXX_BEGIN_DECLS
+
+// Hashes used to identify the contents kept in the driver caches.
+// They are not cryptographic, only good enough to tell inputs apart
+typedef struct cache_hash_tag
+{
+    uint64_t lane[2];
+} cache_hash_t;
+
+void cache_hash_init(cache_hash_t* hash);
+void cache_hash_bytes(cache_hash_t* hash, const void* data, size_t size);
+// Strings are hashed along with their terminator so "ab","c" and "a","bc"
+// give different hashes. NULL is hashed as an empty string
+void cache_hash_string(cache_hash_t* hash, const char* str);
+// Returns nonzero if the file cannot be read
+char cache_hash_file(cache_hash_t* hash, const char* filename);
+// Hexadecimal representation of the hash
+const char* cache_hash_to_str(const cache_hash_t* hash);
+
+// Preprocessing cache
+//
+// The preprocessed output of a file is kept in the cache directory
+// (--pp-cache=<dir>) along with the list of files it included. It is reused
+// as long as the input file, the preprocessor options and all the included
+// files are unchanged.
+
+// Returns the cached preprocessed file of input_filename or NULL if there is
+// none valid. The returned file must not be modified nor removed
+const char* ppcache_lookup(const char* input_filename,
+        int num_options, const char** preprocessor_options);
+
+// Adds preprocessed_filename, the result of preprocessing input_filename,
+// to the cache
+void ppcache_store(const char* input_filename,
+        int num_options, const char** preprocessor_options,
+        const char* preprocessed_filename);
+
+// Output cache
+//
+// The object generated for a translation unit is kept in the cache directory
+// (--output-cache=<dir>). Its key hashes the preprocessed input, the command
+// line, the lines of the profile, the native compiler and the libraries
+// (including compiler phases) loaded in the driver, so a hit means that
+// the whole frontend, phases and native compilation can be skipped.
+
+// Computes the key of the current translation unit or NULL if it cannot be
+// computed. Compiler phases of the current configuration must be loaded
+const char* occache_key(const char* parsed_filename);
+
+// Copies the cached object of key to output_filename. Returns nonzero
+// if it was found
+char occache_lookup(const char* key, const char* output_filename);
+
+// Adds output_filename to the cache under key
+void occache_store(const char* key, const char* output_filename);
+
+MCXX_END_DECLS
+
+#endif // CXX_DRIVER_CACHE_H
@@ -97,6 +97,17 @@ typedef enum native_vendor_tag
 #undef NATIVE_VENDOR
 } native_vendor_t;
 
+// How the tree is checked after every compiler phase (--check-tree)
+typedef enum check_tree_mode_tag
+{
+    // Checks the whole tree
+    CHECK_TREE_FULL = 0,
+    // Checks only the nodes created or modified since the last check
+    CHECK_TREE_DIRTY,
+    // Does not check the tree
+    CHECK_TREE_NONE,
+} check_tree_mode_t;
+
 typedef struct sublanguage_profile_tag
 {
     source_language_t sublanguage;
@@ -152,6 +163,9 @@ typedef struct translation_unit_tag
 
     // Opaque pointer used when running compiler phases
     void *dto;
+
+    // Region where the trees of this translation unit are allocated, if any
+    struct ast_region_tag* ast_region;
 } translation_unit_t;
 
 struct compilation_configuration_tag;
@@ -299,6 +313,18 @@ typedef struct compilation_process_tag
 
     // Flags
     char parallel_process; // enables features allowing parallel compilation
+
+    // Maximum number of translation units compiled concurrently (-j)
+    int num_jobs;
+
+    // Maximum number of native compilations running in background
+    int num_native_jobs;
+
+    // Directory where preprocessed files are cached (--pp-cache)
+    const char* preprocessor_cache_dir;
+
+    // Directory where generated objects are cached (--output-cache)
+    const char* output_cache_dir;
 } compilation_process_t;
 
 typedef struct compilation_configuration_conditional_flags
@@ -609,6 +635,9 @@ typedef struct compilation_configuration_tag
     // Emit line markers in the output files
     char line_markers;
 
+    // Checks of the tree done between compiler phases
+    check_tree_mode_t check_tree_mode;
+
     // List of profile errors
     int num_errors;
     const char** error_messages;
@@ -630,6 +659,9 @@ typedef struct compilation_file_process_tag
 
     int num_secondary_translation_units;
     struct compilation_file_process_tag **secondary_translation_units;
+
+    // Key of the output cache where the output of this file will be stored
+    const char* output_cache_key;
 } compilation_file_process_t;
 
 // These castings are here to convert these expressions in lvalues so people won't modify them
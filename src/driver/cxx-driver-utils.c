@@ -123,6 +123,13 @@ void temporal_files_cleanup(void)
     temporal_file_list = NULL;
 }
 
+void temporal_files_forget(void)
+{
+    // Note that the elements are not freed since the caller may still be
+    // referencing them through a temporal_file_t
+    temporal_file_list = NULL;
+}
+
 static char name_is_in_temporal_files(const char* name)
 {
     temporal_file_list_t it = temporal_file_list;
@@ -345,7 +352,7 @@ int execute_program(const char* program_name, const char** arguments)
 }
 
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
-static int execute_program_flags_unix(const char* program_name, const char** arguments, const char* stdout_f, const char* stderr_f)
+static pid_t spawn_program_flags_unix(const char* program_name, const char** arguments, const char* stdout_f, const char* stderr_f)
 {
     if (program_name == NULL)
         program_name = "";
@@ -449,29 +456,59 @@ static int execute_program_flags_unix(const char* program_name, const char** arg
         // Execvp should not return
         fatal_error("error: execution of subprocess '%s' failed (%s)", program_name, strerror(errno));
     }
-    else // I'm the parent
+
+    // I'm the parent
+    return spawned_process;
+}
+
+static int wait_program_unix(pid_t spawned_process, const char* program_name)
+{
+    if (program_name == NULL)
+        program_name = "";
+
+    // Wait for my son (and only for him, there may be other children
+    // running)
+    int status;
+    while (waitpid(spawned_process, &status, 0) < 0)
     {
-        // Wait for my son
-        int status;
-        wait(&status);
-        if (WIFEXITED(status))
+        if (errno != EINTR)
         {
-            return (WEXITSTATUS(status));
+            fatal_error("error: waiting for subprocess '%s' failed (%s)", program_name, strerror(errno));
         }
-        else if (WIFSIGNALED(status))
-        {
-            fprintf(stderr, "Subprocess '%s' was ended with signal %d\n",
-                    program_name, WTERMSIG(status));
+    }
+    if (WIFEXITED(status))
+    {
+        return (WEXITSTATUS(status));
+    }
+    else if (WIFSIGNALED(status))
+    {
+        fprintf(stderr, "Subprocess '%s' was ended with signal %d\n",
+                program_name, WTERMSIG(status));
 
-            return 1;
-        }
-        else
-        {
-            internal_error(
-                    "Subprocess '%s' ended but neither by normal exit nor signal", 
-                    program_name);
-        }
+        return 1;
     }
+    else
+    {
+        internal_error(
+                "Subprocess '%s' ended but neither by normal exit nor signal", 
+                program_name);
+    }
+}
+
+static int execute_program_flags_unix(const char* program_name, const char** arguments, const char* stdout_f, const char* stderr_f)
+{
+    pid_t spawned_process = spawn_program_flags_unix(program_name, arguments, stdout_f, stderr_f);
+    return wait_program_unix(spawned_process, program_name);
+}
+
+pid_t execute_program_async(const char* program_name, const char** arguments)
+{
+    return spawn_program_flags_unix(program_name, arguments, /* stdout_f */ NULL, /* stderr_f */ NULL);
+}
+
+int wait_program(pid_t program_id, const char* program_name)
+{
+    return wait_program_unix(program_id, program_name);
 }
 #else
 
@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <sys/time.h>
 #include <time.h>
+#include <sys/types.h>
 #include "cxx-process.h"
 
 MCXX_BEGIN_DECLS
@@ -75,12 +76,25 @@ temporal_file_t new_temporal_file_extension(const char* extension);
 // file is closed and erased.
 void temporal_files_cleanup(void);
 
+// Forgets, without removing them, every temporal file registered so far.
+// Used by worker processes so they do not remove the files of their parent
+void temporal_files_forget(void);
+
 const char* get_extension_filename(const char* filename);
 
 int execute_program(const char* program_name, const char** arguments);
 int execute_program_flags(const char* program_name, const char** arguments, 
         const char *stdout_f, const char *stderr_f);
 
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+// Starts a program but does not wait for it to end. Returns an identifier
+// that must be passed to wait_program
+pid_t execute_program_async(const char* program_name, const char** arguments);
+// Waits for a program started with execute_program_async and returns its
+// exit status like execute_program does
+int wait_program(pid_t program_id, const char* program_name);
+#endif
+
 // char** routines
 int count_null_ended_array(void** v);
 void remove_string_from_null_ended_string_array(const char** string_arr, const char* to_remove);
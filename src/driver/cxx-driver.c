@@ -40,10 +40,12 @@
 #include <string.h>
 #include <libgen.h>
 #include <errno.h>
+#include <limits.h>
 #include <unistd.h>
 
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
 #include <signal.h>
+#include <sys/wait.h>
 #endif
 
 #ifdef HAVE_MALLINFO
@@ -58,6 +60,7 @@
 #include "cxx-utils.h"
 #include "cxx-driver.h"
 #include "cxx-driver-utils.h"
+#include "cxx-driver-cache.h"
 #include "cxx-ast.h"
 #include "cxx-ambiguity.h"
 #include "cxx-graphviz.h"
@@ -127,6 +130,20 @@
 "  -k, --keep-files         Do not remove intermediate files\n" \
 "  -K, --keep-all-files     Do not remove any generated file, including\n" \
 "                           temporary files\n" \
+"  -j, --jobs=<n>           Compiles up to <n> input files concurrently\n" \
+"                           Fortran files are always compiled one\n" \
+"                           after the other\n" \
+"  --native-jobs=<n>        Runs up to <n> native compilations in\n" \
+"                           background while the next input files\n" \
+"                           are processed. Use 0 to wait for every\n" \
+"                           native compilation. Default is 0\n" \
+"  --output-cache=<dir>     Keeps the generated objects in <dir> and\n" \
+"                           reuses them when a C/C++ file is compiled\n" \
+"                           again with the same compiler and flags\n" \
+"  --pp-cache=<dir>         Keeps the preprocessed files in <dir>\n" \
+"                           and reuses them while neither the input\n" \
+"                           file, its included files nor the\n" \
+"                           preprocessor options change\n" \
 "  -J <dir>                 Sets <dir> as the output module directory\n" \
 "                           This flag is only meaningful for Fortran\n" \
 "                           See flag --module-out-pattern flag\n" \
@@ -307,6 +324,11 @@
 "                           option is incompatible with parallel\n" \
 "                           compilation\n" \
 "  --line-markers           Adds line markers to the generated file\n" \
+"  --check-tree=<mode>      Sets how the tree is checked after\n" \
+"                           every compiler phase: 'full' checks\n" \
+"                           the whole tree (default), 'dirty' only\n" \
+"                           the parts modified since the last check\n" \
+"                           and 'none' disables the checks\n" \
 "  --parallel               EXPERIMENTAL: behave in a way that \n" \
 "                           allows parallel compilation of the same\n" \
 "                           source codes without reusing intermediate\n" \
@@ -382,8 +404,10 @@ typedef enum
     OPTION_UNDEFINED = 1024,
     // Keep the following options sorted (but leave OPTION_UNDEFINED as is)
     OPTION_ALWAYS_PREPROCESS,
+    OPTION_NATIVE_JOBS,
     OPTION_NATIVE_VENDOR,
     OPTION_CONFIG_DIR,
+    OPTION_CHECK_TREE,
     OPTION_CUDA,
     OPTION_DEBUG_FLAG,
     OPTION_DISABLE_FILE_LOCKING,
@@ -419,6 +443,7 @@ typedef enum
     OPTION_HELP_TARGET_OPTIONS,
     OPTION_INSTANTIATE_TEMPLATES,
     OPTION_ISO_C_FLOATN,
+    OPTION_JOBS,
     OPTION_LINE_MARKERS,
     OPTION_LINKER_NAME,
     OPTION_LIST_ENVIRONMENTS,
@@ -432,9 +457,11 @@ typedef enum
     OPTION_NO_WHOLE_FILE,
     OPTION_OPENCL,
     OPTION_OPENCL_OPTIONS,
+    OPTION_OUTPUT_CACHE,
     OPTION_OUTPUT_DIRECTORY,
     OPTION_PARALLEL,
     OPTION_PASS_THROUGH,
+    OPTION_PREPROCESSOR_CACHE,
     OPTION_PREPROCESSOR_NAME,
     OPTION_PREPROCESSOR_USES_STDOUT,
     OPTION_PRINT_CONFIG_DIR,
@@ -451,7 +478,7 @@ typedef enum
 
 
 // It mimics getopt
-#define SHORT_OPTIONS_STRING "vVkKcho:EyI:J:L:l:gD:U:x:"
+#define SHORT_OPTIONS_STRING "vVkKcho:EyI:j:J:L:l:gD:U:x:"
 // This one mimics getopt_long but with one less field (the third one is not given)
 struct command_line_long_options command_line_long_options[] =
 {
@@ -532,10 +559,15 @@ struct command_line_long_options command_line_long_options[] =
     {"enable-intel-vector-types", CLP_NO_ARGUMENT, OPTION_ENABLE_INTEL_VECTOR_TYPES },
     {"disable-locking", CLP_NO_ARGUMENT, OPTION_DISABLE_FILE_LOCKING },
     {"line-markers", CLP_NO_ARGUMENT, OPTION_LINE_MARKERS },
+    {"check-tree", CLP_REQUIRED_ARGUMENT, OPTION_CHECK_TREE },
     {"parallel", CLP_NO_ARGUMENT, OPTION_PARALLEL },
+    {"jobs", CLP_REQUIRED_ARGUMENT, OPTION_JOBS },
     {"Xcompiler", CLP_REQUIRED_ARGUMENT, OPTION_XCOMPILER },
     {"iso-c-FloatN", CLP_NO_ARGUMENT, OPTION_ISO_C_FLOATN },
     {"native-vendor", CLP_REQUIRED_ARGUMENT, OPTION_NATIVE_VENDOR },
+    {"native-jobs", CLP_REQUIRED_ARGUMENT, OPTION_NATIVE_JOBS },
+    {"pp-cache", CLP_REQUIRED_ARGUMENT, OPTION_PREPROCESSOR_CACHE },
+    {"output-cache", CLP_REQUIRED_ARGUMENT, OPTION_OUTPUT_CACHE },
     // sentinel
     {NULL, 0, 0}
 };
@@ -580,6 +612,8 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
 static const char* codegen_translation_unit(translation_unit_t* translation_unit, const char* parsed_filename);
 static void native_compilation(translation_unit_t* translation_unit, 
         const char* prettyprinted_filename, char remove_input);
+static void join_native_compilations(int max_pending);
+static const char* native_compilation_output_filename(translation_unit_t* translation_unit);
 
 #if !defined(WIN32_BUILD) || defined(__CYGWIN__)
 static void terminating_signal_handler(int sig);
@@ -587,6 +621,9 @@ static void terminating_signal_handler(int sig);
 static char check_tree(AST a);
 
 static void embed_files(void);
+static void embed_files_of_file_process(compilation_file_process_t* file_process);
+static void store_output_in_cache(compilation_file_process_t* file_process);
+static void store_outputs_in_cache(void);
 static void link_objects(void);
 
 static void add_to_parameter_list_str(const char*** existing_options, const char* str);
@@ -679,9 +716,15 @@ int main(int argc, char* argv[])
     // Compilation of every specified translation unit
     compile_every_translation_unit();
 
+    // Wait for native compilations still running in background
+    join_native_compilations(/* max_pending */ 0);
+
     // Embed files
     embed_files();
 
+    // Keep the final objects for later compilations
+    store_outputs_in_cache();
+
     // Link all generated objects
     link_objects();
 
@@ -1221,6 +1264,55 @@ int parse_arguments(int argc, const char* argv[],
                                 uniquestr(parameter_info.argument));
                         break;
                     }
+                case 'j':
+                case OPTION_JOBS:
+                    {
+                        char *error = NULL;
+                        errno = 0;
+                        long num_jobs = strtol(parameter_info.argument, &error, 10);
+                        if (error == parameter_info.argument
+                                || *error != '\0'
+                                || errno == ERANGE
+                                || num_jobs <= 0
+                                || num_jobs > INT_MAX)
+                        {
+                            fprintf(stderr, "%s: invalid number of jobs '%s'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument);
+                            return 1;
+                        }
+                        compilation_process.num_jobs = (int)num_jobs;
+                        break;
+                    }
+                case OPTION_NATIVE_JOBS:
+                    {
+                        char *error = NULL;
+                        errno = 0;
+                        long num_native_jobs = strtol(parameter_info.argument, &error, 10);
+                        if (error == parameter_info.argument
+                                || *error != '\0'
+                                || errno == ERANGE
+                                || num_native_jobs < 0
+                                || num_native_jobs > INT_MAX)
+                        {
+                            fprintf(stderr, "%s: invalid number of native jobs '%s'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument);
+                            return 1;
+                        }
+                        compilation_process.num_native_jobs = (int)num_native_jobs;
+                        break;
+                    }
+                case OPTION_PREPROCESSOR_CACHE:
+                    {
+                        compilation_process.preprocessor_cache_dir = uniquestr(parameter_info.argument);
+                        break;
+                    }
+                case OPTION_OUTPUT_CACHE:
+                    {
+                        compilation_process.output_cache_dir = uniquestr(parameter_info.argument);
+                        break;
+                    }
                 case 'J':
                     {
                         if (CURRENT_CONFIGURATION->module_out_dir != NULL)
@@ -1685,6 +1777,29 @@ int parse_arguments(int argc, const char* argv[],
                         CURRENT_CONFIGURATION->line_markers = 1;
                         break;
                     }
+                case OPTION_CHECK_TREE:
+                    {
+                        if (strcmp(parameter_info.argument, "full") == 0)
+                        {
+                            CURRENT_CONFIGURATION->check_tree_mode = CHECK_TREE_FULL;
+                        }
+                        else if (strcmp(parameter_info.argument, "dirty") == 0)
+                        {
+                            CURRENT_CONFIGURATION->check_tree_mode = CHECK_TREE_DIRTY;
+                        }
+                        else if (strcmp(parameter_info.argument, "none") == 0)
+                        {
+                            CURRENT_CONFIGURATION->check_tree_mode = CHECK_TREE_NONE;
+                        }
+                        else
+                        {
+                            fprintf(stderr, "%s: invalid tree check mode '%s'\n",
+                                    compilation_process.exec_basename,
+                                    parameter_info.argument);
+                            return 1;
+                        }
+                        break;
+                    }
                 case OPTION_PARALLEL:
                     {
                         compilation_process.parallel_process = 1;
@@ -2738,6 +2853,7 @@ static void initialize_default_values(void)
     // Initialize here all default values
     compilation_process.config_dir = strappend(compilation_process.home_directory, DIR_CONFIG_RELATIVE_PATH);
     compilation_process.num_translation_units = 0;
+    compilation_process.num_native_jobs = 0;
 
     // The minimal default configuration
     memset(&minimal_default_configuration, 0, sizeof(minimal_default_configuration));
@@ -2781,6 +2897,8 @@ static void initialize_default_values(void)
     // Specifying the backend vendor is mandatory. Thus, we do not need to
     // assume anything at this point
     CURRENT_CONFIGURATION->native_vendor = NATIVE_VENDOR_UNKNOWN;
+
+    CURRENT_CONFIGURATION->check_tree_mode = CHECK_TREE_FULL;
 }
 
 static void print_version(void)
@@ -3130,11 +3248,64 @@ static void register_upc_pragmae(compilation_configuration_t* configuration)
     register_new_directive(configuration, "distributed", "", /* is_construct */ 0, /* bound_to_single_stmt */ 0);
 }
 
+// The output cache only keeps the objects of the files given in the command
+// line, once their secondary translation units have been embedded. Fortran
+// is not cached because its compilation also generates module files
+static char output_cache_can_be_used(compilation_file_process_t* file_process,
+        struct extensions_table_t* current_extension,
+        char file_not_processed)
+{
+    if (compilation_process.output_cache_dir == NULL
+            || file_not_processed
+            || current_extension->source_language == SOURCE_LANGUAGE_FORTRAN
+            || BITMAP_TEST(current_extension->source_kind, SOURCE_KIND_DO_NOT_COMPILE)
+            || CURRENT_CONFIGURATION->source_language == SOURCE_LANGUAGE_FORTRAN
+            || CURRENT_CONFIGURATION->do_not_parse
+            || CURRENT_CONFIGURATION->do_not_compile
+            || CURRENT_CONFIGURATION->pass_through
+            || debug_options.do_not_codegen)
+        return 0;
+
+    int i;
+    for (i = 0; i < compilation_process.num_translation_units; i++)
+    {
+        if (compilation_process.translation_units[i] == file_process)
+            return 1;
+    }
+
+    return 0;
+}
+
+static void store_output_in_cache(compilation_file_process_t* file_process)
+{
+    if (file_process->output_cache_key == NULL
+            || file_process->translation_unit->output_filename == NULL)
+        return;
+
+    occache_store(file_process->output_cache_key,
+            file_process->translation_unit->output_filename);
+}
+
+// Trees created while compiling a translation unit may still be referenced
+// by the types (which are shared by all translation units) so they can only
+// be released at once when nothing else will be compiled by this process.
+// This means that in a build with several files only the last one gets an
+// AST region: the trees of every other file are still freed node by node
+static int compilation_nesting_level = 0;
+
+static char translation_unit_can_use_ast_region(int i, int num_translation_units)
+{
+    return compilation_nesting_level == 1
+        && i == num_translation_units - 1;
+}
+
 static void compile_every_translation_unit_aux_(int num_translation_units,
         compilation_file_process_t** translation_units)
 {
     // This is just to avoid having a return in this function by mistake
 #define return 1 = 1;
+    compilation_nesting_level++;
+
     // Save the old current file
     compilation_file_process_t* saved_file_process = CURRENT_FILE_PROCESS;
     compilation_configuration_t* saved_configuration = CURRENT_CONFIGURATION;
@@ -3256,6 +3427,23 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
             }
         }
 
+        // * Reuse the output of a previous compilation if possible
+        if (output_cache_can_be_used(file_process, current_extension, file_not_processed))
+        {
+            file_process->output_cache_key = occache_key(parsed_filename);
+            if (file_process->output_cache_key != NULL
+                    && occache_lookup(file_process->output_cache_key,
+                        native_compilation_output_filename(translation_unit)))
+            {
+                // Nothing has to be stored back
+                file_process->output_cache_key = NULL;
+
+                CURRENT_CONFIGURATION->enable_cuda = old_cuda_flag;
+                file_process->already_compiled = 1;
+                continue;
+            }
+        }
+
         char is_fixed_form  = (current_extension->source_language == SOURCE_LANGUAGE_FORTRAN
                 // We prescan from fixed to free if 
                 //  - the file is fixed form OR we are forced to be fixed for (--fixed)
@@ -3282,6 +3470,12 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                 // Initialize diagnostics
                 diagnostics_reset();
 
+                if (translation_unit_can_use_ast_region(i, num_translation_units))
+                {
+                    translation_unit->ast_region = ast_region_new();
+                    ast_region_push(translation_unit->ast_region);
+                }
+
                 // Fill the context with initial information
                 initialize_semantic_analysis(translation_unit, parsed_filename);
 
@@ -3331,24 +3525,39 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                 semantic_analysis(translation_unit, parsed_filename);
 
                 // * Check nodecl generated by semantic analysis
-                timing_t timing_check_tree;
-                if (CURRENT_CONFIGURATION->verbose)
-                {
-                    fprintf(stderr, "Checking integrity of nodecl tree\n");
-                }
-                // This checks links
-                timing_start(&timing_check_tree);
-                if (!ast_check(nodecl_get_ast(translation_unit->nodecl)))
+                if (CURRENT_CONFIGURATION->check_tree_mode != CHECK_TREE_NONE)
                 {
-                    internal_error("Invalid nodecl tree generated by the frontend\n", 0);
-                }
-                // This checks structure
-                nodecl_check_tree(nodecl_get_ast(translation_unit->nodecl));
-                timing_end(&timing_check_tree);
-                if (CURRENT_CONFIGURATION->verbose)
-                {
-                    fprintf(stderr, "Nodecl integrity verified in %.2f seconds\n",
-                            timing_elapsed(&timing_check_tree));
+                    timing_t timing_check_tree;
+                    if (CURRENT_CONFIGURATION->verbose)
+                    {
+                        fprintf(stderr, "Checking integrity of nodecl tree\n");
+                    }
+                    timing_start(&timing_check_tree);
+                    if (CURRENT_CONFIGURATION->check_tree_mode == CHECK_TREE_DIRTY)
+                    {
+                        // The whole tree is new, but this leaves it clean
+                        // for the checks done after each phase
+                        if (!ast_check_dirty(nodecl_get_ast(translation_unit->nodecl), nodecl_check_node))
+                        {
+                            internal_error("Invalid nodecl tree generated by the frontend\n", 0);
+                        }
+                    }
+                    else
+                    {
+                        // This checks links
+                        if (!ast_check(nodecl_get_ast(translation_unit->nodecl)))
+                        {
+                            internal_error("Invalid nodecl tree generated by the frontend\n", 0);
+                        }
+                        // This checks structure
+                        nodecl_check_tree(nodecl_get_ast(translation_unit->nodecl));
+                    }
+                    timing_end(&timing_check_tree);
+                    if (CURRENT_CONFIGURATION->verbose)
+                    {
+                        fprintf(stderr, "Nodecl integrity verified in %.2f seconds\n",
+                                timing_elapsed(&timing_check_tree));
+                    }
                 }
 
                 // * TL::run and TL::phase_cleanup
@@ -3385,6 +3594,11 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                     = codegen_translation_unit(translation_unit, parsed_filename);
             }
 
+            if (translation_unit->ast_region != NULL)
+            {
+                ast_region_pop(translation_unit->ast_region);
+            }
+
             timing_t timing_free_tree;
             if (CURRENT_CONFIGURATION->verbose)
             {
@@ -3394,9 +3608,23 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
                 }
             }
             timing_start(&timing_free_tree);
-            nodecl_free(translation_unit->nodecl);
+            char tree_freed = 0;
+            if (translation_unit->ast_region == NULL)
+            {
+                tree_freed = !nodecl_is_null(translation_unit->nodecl);
+                nodecl_free(translation_unit->nodecl);
+            }
+            else if (file_process->num_secondary_translation_units == 0)
+            {
+                ast_region_free(translation_unit->ast_region);
+                translation_unit->ast_region = NULL;
+                tree_freed = 1;
+            }
+            // else secondary translation units may still refer to the trees
+            translation_unit->nodecl = nodecl_null();
             timing_end(&timing_free_tree);
-            if (CURRENT_CONFIGURATION->verbose)
+            if (CURRENT_CONFIGURATION->verbose
+                    && tree_freed)
             {
                 DEBUG_CODE()
                 {
@@ -3482,11 +3710,285 @@ static void compile_every_translation_unit_aux_(int num_translation_units,
     // Restore previous state
     SET_CURRENT_FILE_PROCESS(saved_file_process);
     SET_CURRENT_CONFIGURATION(saved_configuration);
+
+    compilation_nesting_level--;
 #undef return
 }
 
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+typedef struct compilation_worker_tag
+{
+    pid_t pid;
+    char finished;
+    int exit_status;
+
+    // Diagnostics of the worker, replayed in order by the parent
+    const char* stdout_filename;
+    const char* stderr_filename;
+
+    // Used by the worker to send back the name of the generated object
+    int result_pipe[2];
+} compilation_worker_t;
+
+static char translation_unit_can_be_compiled_concurrently(
+        compilation_file_process_t* file_process)
+{
+    // Fortran files may USE modules created by previous files so they
+    // must be compiled in the order given
+    if (file_process->compilation_configuration->source_language == SOURCE_LANGUAGE_FORTRAN)
+        return 0;
+
+    const char* extension = get_extension_filename(file_process->translation_unit->input_filename);
+    struct extensions_table_t* current_extension = fileextensions_lookup(extension, strlen(extension));
+
+    return (current_extension->source_language != SOURCE_LANGUAGE_FORTRAN);
+}
+
+static void replay_worker_output(const char* filename, FILE* dest)
+{
+    FILE* f = fopen(filename, "r");
+    if (f == NULL)
+        return;
+
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        fwrite(buffer, 1, n, dest);
+    }
+    fclose(f);
+    fflush(dest);
+}
+
+static void run_compilation_worker(compilation_file_process_t* file_process,
+        compilation_worker_t* worker)
+{
+    // Files registered by the parent are not ours to remove
+    temporal_files_forget();
+
+    close(worker->result_pipe[0]);
+
+    if (freopen(worker->stdout_filename, "w", stdout) == NULL
+            || freopen(worker->stderr_filename, "w", stderr) == NULL)
+    {
+        _exit(EXIT_FAILURE);
+    }
+
+    compile_every_translation_unit_aux_(1, &file_process);
+    join_native_compilations(/* max_pending */ 0);
+
+    // Secondary translation units only exist in this process so they have
+    // to be embedded here
+    embed_files_of_file_process(file_process);
+    store_output_in_cache(file_process);
+
+    const char* output_filename = file_process->translation_unit->output_filename;
+    if (output_filename != NULL)
+    {
+        size_t length = strlen(output_filename);
+        if (write(worker->result_pipe[1], output_filename, length) != (ssize_t)length)
+        {
+            fatal_error("Could not send the output filename of '%s' to the driver (%s)\n",
+                    file_process->translation_unit->input_filename,
+                    strerror(errno));
+        }
+    }
+    close(worker->result_pipe[1]);
+
+    exit(compilation_process.execution_result);
+}
+
+static void launch_compilation_worker(compilation_file_process_t* file_process,
+        compilation_worker_t* worker)
+{
+    compilation_configuration_t* saved_configuration = CURRENT_CONFIGURATION;
+
+    // Load the phases once here so every worker inherits them
+    SET_CURRENT_CONFIGURATION(file_process->compilation_configuration);
+    load_compiler_phases(CURRENT_CONFIGURATION);
+    SET_CURRENT_CONFIGURATION(saved_configuration);
+
+    worker->stdout_filename = new_temporal_file()->name;
+    worker->stderr_filename = new_temporal_file()->name;
+
+    if (pipe(worker->result_pipe) != 0)
+    {
+        fatal_error("Could not create pipe for compilation worker (%s)\n", strerror(errno));
+    }
+
+    // Avoid children flushing our pending output
+    fflush(stdout);
+    fflush(stderr);
+
+    worker->pid = fork();
+    if (worker->pid < 0)
+    {
+        fatal_error("Could not fork compilation worker for '%s' (%s)\n",
+                file_process->translation_unit->input_filename,
+                strerror(errno));
+    }
+    else if (worker->pid == 0)
+    {
+        run_compilation_worker(file_process, worker);
+        // Not reached
+    }
+
+    close(worker->result_pipe[1]);
+}
+
+static void finish_compilation_worker(compilation_file_process_t* file_process,
+        compilation_worker_t* worker)
+{
+    replay_worker_output(worker->stdout_filename, stdout);
+    replay_worker_output(worker->stderr_filename, stderr);
+
+    char output_filename[1024];
+    ssize_t length = 0, n;
+    while (length < (ssize_t)sizeof(output_filename) - 1
+            && (n = read(worker->result_pipe[0],
+                    output_filename + length,
+                    sizeof(output_filename) - 1 - length)) > 0)
+    {
+        length += n;
+    }
+    output_filename[length] = '\0';
+    close(worker->result_pipe[0]);
+
+    if (worker->exit_status == 0)
+    {
+        if (length > 0)
+        {
+            file_process->translation_unit->output_filename = uniquestr(output_filename);
+        }
+        file_process->already_compiled = 1;
+    }
+}
+
+// Compiles every translation unit in its own forked worker process. Workers
+// share nothing with each other, so the CURRENT_{FILE_PROCESS,CONFIGURATION}
+// state, which is committed before forking, remains private to each of them
+static void compile_every_translation_unit_concurrently(int num_translation_units,
+        compilation_file_process_t** translation_units)
+{
+    compilation_worker_t* workers = NEW_VEC0(compilation_worker_t, num_translation_units);
+
+    int next_to_launch = 0;
+    int next_to_report = 0;
+    int num_running = 0;
+    char some_failed = 0;
+
+    while (next_to_report < num_translation_units)
+    {
+        while (!some_failed
+                && num_running < compilation_process.num_jobs
+                && next_to_launch < num_translation_units)
+        {
+            compilation_file_process_t* file_process = translation_units[next_to_launch];
+            compilation_worker_t* worker = &workers[next_to_launch];
+            next_to_launch++;
+
+            const char* extension = get_extension_filename(file_process->translation_unit->input_filename);
+            struct extensions_table_t* current_extension = fileextensions_lookup(extension, strlen(extension));
+
+            if (file_process->already_compiled
+                    // Linker data is not processed anymore
+                    || current_extension->source_language == SOURCE_LANGUAGE_LINKER_DATA)
+            {
+                file_process->already_compiled = 1;
+                worker->finished = 1;
+                continue;
+            }
+
+            launch_compilation_worker(file_process, worker);
+            num_running++;
+        }
+
+        if (num_running > 0)
+        {
+            int status;
+            pid_t pid = wait(&status);
+            if (pid < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                fatal_error("Waiting for compilation workers failed (%s)\n", strerror(errno));
+            }
+
+            int i;
+            for (i = next_to_report; i < next_to_launch; i++)
+            {
+                if (workers[i].pid == pid
+                        && !workers[i].finished)
+                {
+                    workers[i].finished = 1;
+                    workers[i].exit_status = (WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+                    if (WIFSIGNALED(status))
+                    {
+                        fprintf(stderr, "%s: compilation of '%s' was ended with signal %d\n",
+                                compilation_process.exec_basename,
+                                translation_units[i]->translation_unit->input_filename,
+                                WTERMSIG(status));
+                    }
+                    some_failed = some_failed || (workers[i].exit_status != 0);
+                    num_running--;
+                    break;
+                }
+            }
+        }
+
+        // Report in the same order as the input files
+        while (next_to_report < next_to_launch
+                && workers[next_to_report].finished)
+        {
+            if (workers[next_to_report].pid != 0)
+            {
+                finish_compilation_worker(translation_units[next_to_report],
+                        &workers[next_to_report]);
+            }
+            next_to_report++;
+        }
+
+        if (some_failed
+                && num_running == 0)
+            break;
+    }
+
+    DELETE(workers);
+
+    if (some_failed)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+#endif
+
 static void compile_every_translation_unit(void)
 {
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    if (compilation_process.num_jobs > 1
+            && compilation_process.num_translation_units > 1)
+    {
+        char can_be_concurrent = 1;
+        int i;
+        for (i = 0; i < compilation_process.num_translation_units && can_be_concurrent; i++)
+        {
+            can_be_concurrent = translation_unit_can_be_compiled_concurrently(
+                    compilation_process.translation_units[i]);
+        }
+
+        if (can_be_concurrent)
+        {
+            compile_every_translation_unit_concurrently(compilation_process.num_translation_units,
+                    compilation_process.translation_units);
+            return;
+        }
+        else if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "There are Fortran files, they will be compiled sequentially\n");
+        }
+    }
+#endif
+
     compile_every_translation_unit_aux_(compilation_process.num_translation_units,
             compilation_process.translation_units);
 }
@@ -3610,6 +4112,7 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
     timing_t timing_semantic;
 
     timing_start(&timing_semantic);
+    const_value_reset_counters();
     nodecl_t nodecl;
     if (IS_C_LANGUAGE
             || IS_CXX_LANGUAGE)
@@ -3642,6 +4145,15 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
                 translation_unit->input_filename,
                 parsed_filename,
                 timing_elapsed(&timing_semantic));
+
+        const_value_counters_t* counters = const_value_get_counters();
+        fprintf(stderr, "File '%s' folded %d constant operations (%d small integers reused) "
+                "and evaluated %d constexpr calls (%d reused)\n",
+                translation_unit->input_filename,
+                counters->folded_operations,
+                counters->small_integer_hits,
+                counters->constexpr_calls,
+                counters->constexpr_call_cache_hits);
     }
 
     char there_were_errors = (diagnostics_get_error_count() != 0);
@@ -3682,7 +4194,11 @@ static void semantic_analysis(translation_unit_t* translation_unit, const char*
         fprintf(stderr, "Freeing parse tree\n");
     }
     timing_start(&timing_free_tree);
-    ast_free(translation_unit->parsed_tree);
+    // Released along with the region
+    if (translation_unit->ast_region == NULL)
+    {
+        ast_free(translation_unit->parsed_tree);
+    }
     translation_unit->parsed_tree = NULL;
     timing_end(&timing_free_tree);
     if (CURRENT_CONFIGURATION->verbose)
@@ -4112,6 +4628,20 @@ static const char* preprocess_single_file(const char* input_filename, const char
     preprocessor_options[i] = "-D_MERCURIUM";
     i++;
 
+    // Only the preprocessed files that we parse are cached
+    char use_cache = (compilation_process.preprocessor_cache_dir != NULL
+            && !CURRENT_CONFIGURATION->do_not_parse
+            && !CURRENT_CONFIGURATION->pass_through);
+    int num_cached_options = i;
+
+    if (use_cache)
+    {
+        const char* cached_filename = ppcache_lookup(input_filename,
+                num_cached_options, preprocessor_options);
+        if (cached_filename != NULL)
+            return cached_filename;
+    }
+
     const char *preprocessed_filename = NULL;
 
     if (!CURRENT_CONFIGURATION->do_not_parse)
@@ -4166,6 +4696,12 @@ static const char* preprocess_single_file(const char* input_filename, const char
 
     if (result_preprocess == 0)
     {
+        if (use_cache)
+        {
+            ppcache_store(input_filename,
+                    num_cached_options, preprocessor_options,
+                    preprocessed_filename);
+        }
         return preprocessed_filename;
     }
     else
@@ -4188,19 +4724,9 @@ const char* preprocess_file(const char* input_filename)
     return preprocess_single_file(input_filename, NULL);
 }
 
-static void native_compilation(translation_unit_t* translation_unit, 
-        const char* prettyprinted_filename, 
-        char remove_input)
+// Sets, if needed, and returns the output filename of the native compilation
+static const char* native_compilation_output_filename(translation_unit_t* translation_unit)
 {
-    if (CURRENT_CONFIGURATION->do_not_compile
-            || debug_options.do_not_codegen)
-        return;
-
-    if (remove_input)
-    {
-        mark_file_for_cleanup(prettyprinted_filename);
-    }
-
     const char* output_object_filename = NULL;
 
     if (translation_unit->output_filename == NULL
@@ -4231,6 +4757,128 @@ static void native_compilation(translation_unit_t* translation_unit,
         output_object_filename = translation_unit->output_filename;
     }
 
+    return output_object_filename;
+}
+
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+typedef struct pending_native_compilation_tag
+{
+    pid_t program_id;
+    const char* native_compiler_name;
+    const char* input_filename;
+    const char* prettyprinted_filename;
+    timing_t timing_compilation;
+} pending_native_compilation_t;
+
+// Native compilations running in background, kept in a ring buffer of
+// num_native_jobs entries whose oldest one is first_pending_native_compilation
+static int num_pending_native_compilations = 0;
+static int first_pending_native_compilation = 0;
+static int max_pending_native_compilations = 0;
+static pending_native_compilation_t* pending_native_compilations = NULL;
+
+static void launch_native_compilation(
+        const char* native_compiler_name,
+        const char** native_compilation_args,
+        const char* input_filename,
+        const char* prettyprinted_filename,
+        timing_t* timing_compilation)
+{
+    // Keep at most num_native_jobs compilations running
+    join_native_compilations(compilation_process.num_native_jobs - 1);
+
+    pending_native_compilation_t new_pending;
+    new_pending.native_compiler_name = native_compiler_name;
+    new_pending.input_filename = input_filename;
+    new_pending.prettyprinted_filename = prettyprinted_filename;
+    new_pending.timing_compilation = *timing_compilation;
+
+    // Avoid the native compiler output being mixed with ours
+    fflush(stdout);
+    fflush(stderr);
+
+    new_pending.program_id = execute_program_async(native_compiler_name, native_compilation_args);
+
+    if (max_pending_native_compilations < compilation_process.num_native_jobs)
+    {
+        // Only happens before the first launch since num_native_jobs
+        // does not change afterwards
+        ERROR_CONDITION(num_pending_native_compilations != 0,
+                "Cannot grow the ring buffer while it is in use", 0);
+        max_pending_native_compilations = compilation_process.num_native_jobs;
+        pending_native_compilations = NEW_REALLOC(pending_native_compilation_t,
+                pending_native_compilations,
+                max_pending_native_compilations);
+        first_pending_native_compilation = 0;
+    }
+
+    int last = (first_pending_native_compilation + num_pending_native_compilations)
+        % max_pending_native_compilations;
+    pending_native_compilations[last] = new_pending;
+    num_pending_native_compilations++;
+}
+#endif
+
+// Waits, oldest first, until there are no more than max_pending native
+// compilations running in background
+static void join_native_compilations(int max_pending)
+{
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    if (max_pending < 0)
+        max_pending = 0;
+
+    const char* failed_input_filename = NULL;
+    while (num_pending_native_compilations > max_pending
+            // If one fails, wait for all of them before giving up
+            || (failed_input_filename != NULL
+                && num_pending_native_compilations > 0))
+    {
+        pending_native_compilation_t current =
+            pending_native_compilations[first_pending_native_compilation];
+
+        first_pending_native_compilation = (first_pending_native_compilation + 1)
+            % max_pending_native_compilations;
+        num_pending_native_compilations--;
+
+        int result = wait_program(current.program_id, current.native_compiler_name);
+        timing_end(&current.timing_compilation);
+
+        if (result != 0)
+        {
+            if (failed_input_filename == NULL)
+                failed_input_filename = current.input_filename;
+        }
+        else if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "File '%s' ('%s') natively compiled in %.2f seconds\n", 
+                    current.input_filename,
+                    current.prettyprinted_filename,
+                    timing_elapsed(&current.timing_compilation));
+        }
+    }
+
+    if (failed_input_filename != NULL)
+    {
+        fatal_error("Native compilation failed for file '%s'", failed_input_filename);
+    }
+#endif
+}
+
+static void native_compilation(translation_unit_t* translation_unit, 
+        const char* prettyprinted_filename, 
+        char remove_input)
+{
+    if (CURRENT_CONFIGURATION->do_not_compile
+            || debug_options.do_not_codegen)
+        return;
+
+    if (remove_input)
+    {
+        mark_file_for_cleanup(prettyprinted_filename);
+    }
+
+    const char* output_object_filename = native_compilation_output_filename(translation_unit);
+
     int num_args_compiler = count_null_ended_array((void**)CURRENT_CONFIGURATION->native_compiler_options);
 
     int num_arguments = num_args_compiler;
@@ -4354,6 +5002,23 @@ static void native_compilation(translation_unit_t* translation_unit,
     timing_t timing_compilation;
     timing_start(&timing_compilation);
 
+#if !defined(WIN32_BUILD) || defined(__CYGWIN__)
+    // Fortran files may need the modules of the previous ones and the binary
+    // check needs the object right now, otherwise let the native compiler run
+    // in background while we go on with the next file
+    if (compilation_process.num_native_jobs > 0
+            && CURRENT_CONFIGURATION->source_language != SOURCE_LANGUAGE_FORTRAN
+            && !debug_options.binary_check)
+    {
+        launch_native_compilation(CURRENT_CONFIGURATION->native_compiler_name,
+                native_compilation_args,
+                translation_unit->input_filename,
+                prettyprinted_filename,
+                &timing_compilation);
+        return;
+    }
+#endif
+
     if (execute_program(CURRENT_CONFIGURATION->native_compiler_name, native_compilation_args) != 0)
     {
         // Clean things up if they go wrong here before aborting
@@ -4430,156 +5095,162 @@ static void native_compilation(translation_unit_t* translation_unit,
     }
 }
 
-static void embed_files(void)
+static void embed_files_of_file_process(compilation_file_process_t* file_process)
 {
     if (CURRENT_CONFIGURATION->do_not_compile)
         return;
 
-    char there_are_secondary_files = 0;
-    int i;
-    for (i = 0; i < compilation_process.num_translation_units; i++)
+    int num_secondary_translation_units = 
+        file_process->num_secondary_translation_units;
+    compilation_file_process_t** secondary_translation_units = 
+        file_process->secondary_translation_units;
+
+    if (num_secondary_translation_units == 0)
+        return;
+
+    translation_unit_t* translation_unit = file_process->translation_unit;
+    const char* extension = get_extension_filename(translation_unit->input_filename);
+    struct extensions_table_t* current_extension = fileextensions_lookup(extension, strlen(extension));
+
+    // We do not have to embed linker data
+    if (current_extension->source_language == SOURCE_LANGUAGE_LINKER_DATA
+            // Or languages that we know that cannot be embedded
+            || ((current_extension->source_kind & SOURCE_KIND_DO_NOT_EMBED) == SOURCE_KIND_DO_NOT_EMBED))
     {
-        if (compilation_process.translation_units[i]->num_secondary_translation_units != 0)
-        {
-            there_are_secondary_files = 1;
-        }
+        return;
     }
 
-    if (!there_are_secondary_files)
-        return;
+    const char *output_filename = translation_unit->output_filename;
 
-    for (i = 0; i < compilation_process.num_translation_units; i++)
+    if (CURRENT_CONFIGURATION->verbose)
     {
-        int num_secondary_translation_units = 
-            compilation_process.translation_units[i]->num_secondary_translation_units;
-        compilation_file_process_t** secondary_translation_units = 
-            compilation_process.translation_units[i]->secondary_translation_units;
+        fprintf(stderr, "Embedding secondary files into '%s'\n", output_filename);
+    }
 
-        translation_unit_t* translation_unit = compilation_process.translation_units[i]->translation_unit;
-        const char* extension = get_extension_filename(translation_unit->input_filename);
-        struct extensions_table_t* current_extension = fileextensions_lookup(extension, strlen(extension));
+#define MAX_EMBED_MODES 8
+    int num_embed_modes_seen = 0;
+    unsigned int embed_modes[MAX_EMBED_MODES] = { 0 };
+    void *embed_mode_data[MAX_EMBED_MODES] = { 0 };
+
+    int j;
+    for (j = 0; j < num_secondary_translation_units; j++)
+    {
+        compilation_file_process_t* secondary_compilation_file = secondary_translation_units[j];
+        compilation_configuration_t* secondary_configuration = secondary_compilation_file->compilation_configuration;
 
-        // We do not have to embed linker data
+        // If a .o file is introduced by a phase, then it will not have an
+        // output filename because we usually compute these very late in
+        // the linking step and we will end using the same name.
+        extension = get_extension_filename(secondary_compilation_file->translation_unit->input_filename);
+        current_extension = fileextensions_lookup(extension, strlen(extension));
         if (current_extension->source_language == SOURCE_LANGUAGE_LINKER_DATA
-                // Or languages that we know that cannot be embedded
-                || ((current_extension->source_kind & SOURCE_KIND_DO_NOT_EMBED) == SOURCE_KIND_DO_NOT_EMBED))
+                && secondary_compilation_file->translation_unit->output_filename == NULL)
         {
-            continue;
+            secondary_compilation_file->translation_unit->output_filename =
+                secondary_compilation_file->translation_unit->input_filename;
         }
-        const char *output_filename = translation_unit->output_filename;
 
-        if (CURRENT_CONFIGURATION->verbose)
+        target_options_map_t* target_options = get_target_options(secondary_configuration, CURRENT_CONFIGURATION->configuration_name);
+
+        if (target_options == NULL)
         {
-            fprintf(stderr, "Embedding secondary files into '%s'\n", output_filename);
+            fatal_error("During embedding, there are no target options defined from profile '%s' to profile '%s' in the configuration\n",
+                    secondary_configuration->configuration_name,
+                    CURRENT_CONFIGURATION->configuration_name);
         }
 
-#define MAX_EMBED_MODES 8
-        int num_embed_modes_seen = 0;
-        unsigned int embed_modes[MAX_EMBED_MODES] = { 0 };
-        void *embed_mode_data[MAX_EMBED_MODES] = { 0 };
-
-        int j;
-        for (j = 0; j < num_secondary_translation_units; j++)
+        if (!target_options->do_embedding)
         {
-            compilation_file_process_t* secondary_compilation_file = secondary_translation_units[j];
-            compilation_configuration_t* secondary_configuration = secondary_compilation_file->compilation_configuration;
-
-            // If a .o file is introduced by a phase, then it will not have an
-            // output filename because we usually compute these very late in
-            // the linking step and we will end using the same name.
-            extension = get_extension_filename(secondary_compilation_file->translation_unit->input_filename);
-            current_extension = fileextensions_lookup(extension, strlen(extension));
-            if (current_extension->source_language == SOURCE_LANGUAGE_LINKER_DATA
-                    && secondary_compilation_file->translation_unit->output_filename == NULL)
-            {
-                secondary_compilation_file->translation_unit->output_filename =
-                    secondary_compilation_file->translation_unit->input_filename;
-            }
+            // Do nothing if we are told not to embed
+            continue;
+        }
 
-            target_options_map_t* target_options = get_target_options(secondary_configuration, CURRENT_CONFIGURATION->configuration_name);
+        // Remember the embed mode to run the collective embed procedure later
+        ERROR_CONDITION(num_embed_modes_seen == MAX_EMBED_MODES, "Too many embed modes. Max is %d", MAX_EMBED_MODES);
+        int k; 
+        char found = 0;
 
-            if (target_options == NULL)
-            {
-                fatal_error("During embedding, there are no target options defined from profile '%s' to profile '%s' in the configuration\n",
-                        secondary_configuration->configuration_name,
-                        CURRENT_CONFIGURATION->configuration_name);
-            }
+        void **embed_data = NULL;
 
-            if (!target_options->do_embedding)
+        for (k = 0;  k < num_embed_modes_seen && !found; k++)
+        {
+            if (embed_modes[k] == target_options->embedding_mode)
             {
-                // Do nothing if we are told not to embed
-                continue;
+                found = 1;
+                break;
             }
+        }
+        if (!found)
+        {
+            embed_modes[num_embed_modes_seen] = target_options->embedding_mode;
+            embed_data = &(embed_mode_data[num_embed_modes_seen]);
+            num_embed_modes_seen++;
+        }
+        else
+        {
+            embed_data = &(embed_mode_data[k]);
+        }
 
-            // Remember the embed mode to run the collective embed procedure later
-            ERROR_CONDITION(num_embed_modes_seen == MAX_EMBED_MODES, "Too many embed modes. Max is %d", MAX_EMBED_MODES);
-            int k; 
-            char found = 0;
-
-            void **embed_data = NULL;
-
-            for (k = 0;  k < num_embed_modes_seen && !found; k++)
-            {
-                if (embed_modes[k] == target_options->embedding_mode)
+        // Single embed
+        switch (target_options->embedding_mode)
+        {
+            case EMBEDDING_MODE_BFD:
                 {
-                    found = 1;
+                    multifile_embed_bfd_single(embed_data, secondary_compilation_file);
                     break;
                 }
-            }
-            if (!found)
-            {
-                embed_modes[num_embed_modes_seen] = target_options->embedding_mode;
-                embed_data = &(embed_mode_data[num_embed_modes_seen]);
-                num_embed_modes_seen++;
-            }
-            else
-            {
-                embed_data = &(embed_mode_data[k]);
-            }
-
-            // Single embed
-            switch (target_options->embedding_mode)
-            {
-                case EMBEDDING_MODE_BFD:
-                    {
-                        multifile_embed_bfd_single(embed_data, secondary_compilation_file);
-                        break;
-                    }
-                case EMBEDDING_MODE_PARTIAL_LINKING:
-                    {
-                        multifile_embed_partial_linking_single(
-                                embed_data, secondary_compilation_file, output_filename);
-                        break;
-                    }
-                default:
-                    internal_error("Unknown embedding mode", 0);
-            }
-
+            case EMBEDDING_MODE_PARTIAL_LINKING:
+                {
+                    multifile_embed_partial_linking_single(
+                            embed_data, secondary_compilation_file, output_filename);
+                    break;
+                }
+            default:
+                internal_error("Unknown embedding mode", 0);
         }
 
-        // Collective embed
-        for (j = 0; j < num_embed_modes_seen; j++)
+    }
+
+    // Collective embed
+    for (j = 0; j < num_embed_modes_seen; j++)
+    {
+        switch (embed_modes[j])
         {
-            switch (embed_modes[j])
-            {
-                case EMBEDDING_MODE_BFD:
-                    {
-                        multifile_embed_bfd_collective(&(embed_mode_data[j]), output_filename);
-                        break;
-                    }
-                case EMBEDDING_MODE_PARTIAL_LINKING:
-                    {
-                        // We don't need to do anything, secondary translation units
-                        // are already embedded in the output linker object
-                        break;
-                    }
-                default:
-                    internal_error("Unknown embedding mode", 0);
-            }
+            case EMBEDDING_MODE_BFD:
+                {
+                    multifile_embed_bfd_collective(&(embed_mode_data[j]), output_filename);
+                    break;
+                }
+            case EMBEDDING_MODE_PARTIAL_LINKING:
+                {
+                    // We don't need to do anything, secondary translation units
+                    // are already embedded in the output linker object
+                    break;
+                }
+            default:
+                internal_error("Unknown embedding mode", 0);
         }
     }
 }
 
+static void embed_files(void)
+{
+    int i;
+    for (i = 0; i < compilation_process.num_translation_units; i++)
+    {
+        embed_files_of_file_process(compilation_process.translation_units[i]);
+    }
+}
+
+static void store_outputs_in_cache(void)
+{
+    int i;
+    for (i = 0; i < compilation_process.num_translation_units; i++)
+    {
+        store_output_in_cache(compilation_process.translation_units[i]);
+    }
+}
+
 static void link_files(const char** file_list, int num_files,
         const char* linked_output_filename,
         compilation_configuration_t* compilation_configuration)
@@ -5349,6 +6020,13 @@ static void print_memory_report(void)
             sizeof(scope_entry_t));
     fprintf(stderr, "Size of entity specifiers (bytes): %zd\n",
             sizeof(entity_specifiers_t));
+    fprintf(stderr, "Size of entity specifiers groups (bytes): "
+            "function %zd, variable %zd, templates %zd, extra %zd, fortran %zd\n",
+            sizeof(entity_specifiers_function_t),
+            sizeof(entity_specifiers_variable_t),
+            sizeof(entity_specifiers_templates_t),
+            sizeof(entity_specifiers_extra_t),
+            sizeof(entity_specifiers_fortran_t));
     fprintf(stderr, "Size of a context (bytes): %zd\n",
             sizeof(const decl_context_t*));
     fprintf(stderr, "Size of a type (bytes): %zd\n",
@@ -5382,7 +6060,11 @@ static void print_memory_report(void)
     }
 
     fprintf(stderr, " - AST node size (bytes): %d\n", ast_node_size());
+    fprintf(stderr, " - Memory used by AST regions (bytes): %llu\n", ast_region_used_memory());
     fprintf(stderr, " - Total number of AST nodes: %d\n", num_nodes);
+    // Children are stored inside the node
+    fprintf(stderr, " - Total size of AST nodes (bytes): %llu\n",
+            (unsigned long long)num_nodes * ast_node_size());
 
     for (i = 0; i < MCXX_MAX_AST_CHILDREN + 1; i++)
     {
@@ -5394,6 +6076,12 @@ static void print_memory_report(void)
     }
 
     fprintf(stderr, "\n");
+
+    class_scope_lookup_stats();
+    fprintf(stderr, "\n");
+
+    solve_overload_cache_stats();
+    fprintf(stderr, "\n");
 }
 
 type_environment_t* get_environment(const char* env_id)
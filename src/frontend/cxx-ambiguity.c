@@ -50,6 +50,167 @@
  *
  */
 
+// Expressions checked while solving an ambiguity are kept so the winning
+// interpretation does not have to be checked again when it is built
+typedef
+struct checked_expression_tag
+{
+    AST expression;
+    const decl_context_t* decl_context;
+    nodecl_t nodecl;
+    // Interpretation being checked when the expression was checked
+    int option;
+} checked_expression_t;
+
+// One per ambiguity being solved
+typedef
+struct ambiguity_frame_tag
+{
+    int current_option;
+
+    int num_checked_expressions;
+    checked_expression_t* checked_expressions;
+
+    struct ambiguity_frame_tag* previous;
+} ambiguity_frame_t;
+
+static ambiguity_frame_t* current_ambiguity_frame = NULL;
+
+// Checked expressions of the interpretations chosen by the outermost
+// ambiguities, indexed by their AST
+static dhash_ptr_t* chosen_checked_expressions = NULL;
+
+// While solving an ambiguity the scopes do not change, so a nested ambiguity
+// that could not be solved will not be solvable later either. Indexed by the
+// AST, the value is the decl_context of the attempt.
+//
+// This relies on the check functions not signing in symbols. If one of them
+// ever did (or instantiated something that adds names to a scope being
+// looked up) a remembered failure could become stale before the outermost
+// ambiguity is solved. Attempts made with an info pointer are not remembered
+// because their outcome may also depend on it
+static dhash_ptr_t* failed_nested_ambiguities = NULL;
+
+static void ambiguity_frame_push(ambiguity_frame_t* frame)
+{
+    memset(frame, 0, sizeof(*frame));
+
+    frame->previous = current_ambiguity_frame;
+    current_ambiguity_frame = frame;
+
+    if (frame->previous == NULL
+            && failed_nested_ambiguities == NULL)
+    {
+        failed_nested_ambiguities = dhash_ptr_new(5);
+    }
+}
+
+static void keep_chosen_checked_expression(checked_expression_t* checked)
+{
+    if (chosen_checked_expressions == NULL)
+        chosen_checked_expressions = dhash_ptr_new(5);
+
+    checked_expression_t* previous =
+        (checked_expression_t*)dhash_ptr_query(chosen_checked_expressions, (const char*)checked->expression);
+    if (previous != NULL)
+    {
+        nodecl_free(previous->nodecl);
+        DELETE(previous);
+    }
+
+    checked_expression_t* kept = NEW(checked_expression_t);
+    *kept = *checked;
+    dhash_ptr_insert(chosen_checked_expressions, (const char*)kept->expression, kept);
+}
+
+// Keeps the checked expressions of the chosen option and frees the others
+static void ambiguity_frame_pop(ambiguity_frame_t* frame, int chosen_option)
+{
+    ERROR_CONDITION(current_ambiguity_frame != frame, "Invalid ambiguity frame", 0);
+    current_ambiguity_frame = frame->previous;
+
+    int i;
+    for (i = 0; i < frame->num_checked_expressions; i++)
+    {
+        checked_expression_t* checked = &frame->checked_expressions[i];
+        if (checked->option != chosen_option)
+        {
+            nodecl_free(checked->nodecl);
+        }
+        else if (frame->previous != NULL)
+        {
+            // It belongs to the interpretation of the enclosing ambiguity
+            checked->option = frame->previous->current_option;
+            P_LIST_ADD(frame->previous->checked_expressions,
+                    frame->previous->num_checked_expressions,
+                    *checked);
+        }
+        else
+        {
+            keep_chosen_checked_expression(checked);
+        }
+    }
+    DELETE(frame->checked_expressions);
+
+    if (frame->previous == NULL
+            && failed_nested_ambiguities != NULL)
+    {
+        dhash_ptr_destroy(failed_nested_ambiguities);
+        failed_nested_ambiguities = NULL;
+    }
+}
+
+static void ambiguity_keep_checked_expression(AST expression,
+        const decl_context_t* decl_context,
+        nodecl_t nodecl_expr)
+{
+    if (current_ambiguity_frame == NULL
+            || nodecl_is_null(nodecl_expr)
+            || nodecl_is_err_expr(nodecl_expr))
+    {
+        nodecl_free(nodecl_expr);
+        return;
+    }
+
+    checked_expression_t checked;
+    checked.expression = expression;
+    checked.decl_context = decl_context;
+    checked.nodecl = nodecl_expr;
+    checked.option = current_ambiguity_frame->current_option;
+
+    P_LIST_ADD(current_ambiguity_frame->checked_expressions,
+            current_ambiguity_frame->num_checked_expressions,
+            checked);
+}
+
+char ambiguity_take_checked_expression(AST expression,
+        const decl_context_t* decl_context,
+        nodecl_t* nodecl_output)
+{
+    if (chosen_checked_expressions == NULL)
+        return 0;
+
+    checked_expression_t* checked =
+        (checked_expression_t*)dhash_ptr_query(chosen_checked_expressions, (const char*)expression);
+    if (checked == NULL)
+        return 0;
+
+    dhash_ptr_remove(chosen_checked_expressions, (const char*)expression);
+
+    char found = (checked->decl_context == decl_context);
+    if (found)
+    {
+        *nodecl_output = checked->nodecl;
+    }
+    else
+    {
+        nodecl_free(checked->nodecl);
+    }
+    DELETE(checked);
+
+    return found;
+}
+
 // Generic routines
 void solve_ambiguity_generic(AST a, const decl_context_t* decl_context, void *info,
         ambiguity_check_intepretation_fun_t* ambiguity_check_intepretation,
@@ -65,12 +226,16 @@ void solve_ambiguity_generic(AST a, const decl_context_t* decl_context, void *in
 
     diagnostic_context_t* ambig_diag[n + 1];
 
+    ambiguity_frame_t frame;
+    ambiguity_frame_push(&frame);
+
     for (i = 0; i < n; i++)
     {
         AST current_interpretation = ast_get_ambiguity(a, i);
 
         ast_fix_parents_inside_intepretation(current_interpretation);
 
+        frame.current_option = i;
         ambig_diag[i] = diagnostic_context_push_buffered();
         char c = ambiguity_check_intepretation(current_interpretation, decl_context, i, info);
         diagnostic_context_pop();
@@ -126,6 +291,7 @@ void solve_ambiguity_generic(AST a, const decl_context_t* decl_context, void *in
             AST current_interpretation = ast_get_ambiguity(a, i);
             ast_fix_parents_inside_intepretation(current_interpretation);
 
+            frame.current_option = i;
             if (ambiguity_fallback_interpretation(current_interpretation, decl_context, i, info))
             {
                 valid_option = i;
@@ -172,6 +338,8 @@ void solve_ambiguity_generic(AST a, const decl_context_t* decl_context, void *in
         }
     }
 
+    ambiguity_frame_pop(&frame, valid_option);
+
     ast_replace_with_ambiguity(a, valid_option);
 }
 
@@ -182,14 +350,31 @@ static char try_to_solve_ambiguity_generic(AST a, const decl_context_t* decl_con
 {
     ERROR_CONDITION(ASTKind(a) != AST_AMBIGUITY, "Tree is not an ambiguity", 0);
 
+    char remember_failure = (info == NULL);
+    if (remember_failure
+            && failed_nested_ambiguities != NULL
+            && dhash_ptr_query(failed_nested_ambiguities, (const char*)a) == decl_context)
+    {
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "AMBIGUITY: Ambiguity at '%s' already known not to be solvable\n",
+                    ast_location(a));
+        }
+        return 0;
+    }
+
     int valid_option = -1;
 
+    ambiguity_frame_t frame;
+    ambiguity_frame_push(&frame);
+
     int i, n = ast_get_num_ambiguities(a);
     for (i = 0; i < n; i++)
     {
         AST current_interpretation = ast_get_ambiguity(a, i);
         ast_fix_parents_inside_intepretation(current_interpretation);
 
+        frame.current_option = i;
         char c = ambiguity_check_intepretation(current_interpretation, decl_context, i, info);
 
         if (c)
@@ -225,14 +410,22 @@ static char try_to_solve_ambiguity_generic(AST a, const decl_context_t* decl_con
                 }
                 else
                 {
-                    return 0;
+                    valid_option = -1;
+                    break;
                 }
             }
         }
     }
 
+    ambiguity_frame_pop(&frame, valid_option);
+
     if (valid_option < 0)
     {
+        if (remember_failure
+                && failed_nested_ambiguities != NULL)
+        {
+            dhash_ptr_insert(failed_nested_ambiguities, (const char*)a, (void*)decl_context);
+        }
         return 0;
     }
 
@@ -1263,7 +1456,7 @@ static char check_expression_statement(AST a, const decl_context_t* decl_context
 
     nodecl_t nodecl_expr = nodecl_null();
     char result = check_expression(expression, decl_context, &nodecl_expr);
-    nodecl_free(nodecl_expr);
+    ambiguity_keep_checked_expression(expression, decl_context, nodecl_expr);
 
     return result;
 }
@@ -2358,6 +2551,7 @@ static char solve_ambiguous_condition_interpretation(AST current_condition, cons
     {
         current_expression = ASTSon2(current_condition);
         current_check = check_expression(current_expression, decl_context, &current_nodecl);
+        ambiguity_keep_checked_expression(current_expression, decl_context, current_nodecl);
     }
     else
     {
@@ -2374,6 +2568,8 @@ static char solve_ambiguous_condition_interpretation(AST current_condition, cons
 
         current_expression = ASTSon0(equal_initializer);
         current_check = current_check && check_expression(current_expression, decl_context, &current_nodecl);
+        // The initializer will be checked again against the declared entity
+        nodecl_free(current_nodecl);
     }
 
     return current_check;
@@ -77,6 +77,12 @@ LIBMCXX_EXTERN char check_type_id_tree_or_class_template_name(AST type_id, const
 
 LIBMCXX_EXTERN void solve_ambiguous_expression(AST ambig_expression, const decl_context_t* decl_context, nodecl_t* nodecl_output);
 
+// If expression was checked when solving the ambiguity that chose it, returns
+// the nodecl obtained then. It can only be taken once
+LIBMCXX_EXTERN char ambiguity_take_checked_expression(AST expression,
+        const decl_context_t* decl_context,
+        nodecl_t* nodecl_output);
+
 LIBMCXX_EXTERN char solve_ambiguous_list_of_expressions(AST ambiguous_list, const decl_context_t* decl_context, nodecl_t* nodecl_output);
 
 LIBMCXX_EXTERN char solve_ambiguous_list_of_initializer_clauses(AST ambiguous_list, const decl_context_t* decl_context, nodecl_t* nodecl_output);
@@ -31,38 +31,67 @@
 #include "mem.h"
 #include "cxx-process.h"
 #include <stdint.h>
+#include <string.h>
 
 MCXX_BEGIN_DECLS
 
 // Definition of the type
+//
+// It is laid out so it takes 64 bytes in 64-bit architectures
 typedef
 struct AST_tag
 {
-    // Node type (1024 different node types)
+    // Node type (2048 different node types)
     node_t node_type:11;
 
     // This is a bitmap for the sons
     unsigned int bitmap_sons:MCXX_MAX_AST_CHILDREN;
 
-    // Number of ambiguities of this node
-    int num_ambig;
+    // Memory of the node, of its ambiguities and of its expr_info has been
+    // allocated in a region (see ast_region_push) and must not be freed
+    // individually
+    unsigned int node_in_region:1;
+    unsigned int ambig_in_region:1;
+    unsigned int expr_info_in_region:1;
+
+    // A structural id has been memoized for this node (see
+    // Nodecl::Utils::get_structural_id). If set, it is also set in all the
+    // descendants of this node
+    unsigned int structural_id_valid:1;
+
+    // This node or one of its descendants is a pragma or OpenMP/OmpSs
+    // construct (see ast_kind_is_construct). Never cleared, so a node without
+    // it is known not to contain any construct
+    unsigned int construct_in_subtree:1;
+
+    // This node has been created or modified since the tree was last
+    // checked (see ast_check_dirty). Ancestors of a dirty node have
+    // dirty_in_subtree set
+    unsigned int dirty:1;
+    unsigned int dirty_in_subtree:1;
+
+    // Node locus (see locus_get_index)
+    unsigned int locus_index;
 
     // Parent node
     struct AST_tag* parent;
 
-    // Node locus
-    const locus_t* locus;
-
     // Textual information linked to the node
     // normally the symbol or the literal
     const char* text;
 
     union
     {
-        // The children of this tree (except for AST_AMBIGUITY)
-        struct AST_tag** children;
+        // The children of this tree (except for AST_AMBIGUITY) indexed
+        // by child number. Only those in bitmap_sons are valid
+        struct AST_tag* children[MCXX_MAX_AST_CHILDREN];
         // When type == AST_AMBIGUITY, all intepretations are here
-        struct AST_tag** ambig;
+        struct
+        {
+            struct AST_tag** ambig;
+            // Number of ambiguities of this node
+            int num_ambig;
+        };
     };
 
     // This is used by nodecl trees
@@ -100,34 +129,87 @@ static inline void ast_set_text(AST a, const char* str)
     a->text = str;
 }
 
-static inline void ast_set_kind(AST a, node_t node_type)
+static inline char ast_get_structural_id_valid(const_AST a)
 {
-    a->node_type = node_type;
+    return a->structural_id_valid;
 }
 
-static inline int ast_bitmap_to_index(unsigned int bitmap, int num)
+static inline void ast_set_structural_id_valid(AST a)
 {
-    ERROR_CONDITION(((1 << num) & bitmap) == 0,
-            "Invalid bitmap!", 0);
-#if HAVE__BUILTIN_POPCOUNT
-    bitmap = bitmap & (~(~0U << num));
-    return __builtin_popcount(bitmap);
-#else
-    int i;
-    int s = 0;
-    for (i = 0; i < num; i++)
+    a->structural_id_valid = 1;
+}
+
+static inline void ast_invalidate_structural_id(AST a)
+{
+    // Since descendants of a node with a memoized id have one too, we can
+    // stop at the first ancestor without it
+    while (a != NULL
+            && a->structural_id_valid)
     {
-        s += bitmap & 1;
-        bitmap = bitmap >> 1;
+        a->structural_id_valid = 0;
+        a = a->parent;
     }
+}
 
-    return s;
-#endif
+static inline char ast_kind_is_construct(node_t kind)
+{
+    // 0 means not computed yet, see ast_compute_construct_kind
+    if (ast_construct_kinds[kind] == 0)
+        return ast_compute_construct_kind(kind);
+    return (ast_construct_kinds[kind] == 2);
 }
 
-ALWAYS_INLINE static inline int ast_son_num_to_son_index(const_AST a, int num_son)
+static inline char ast_has_construct_in_subtree(const_AST a)
 {
-    return ast_bitmap_to_index(a->bitmap_sons, num_son);
+    return a->construct_in_subtree;
+}
+
+static inline void ast_propagate_construct_in_subtree(AST a)
+{
+    // Ancestors of a node with the bit set have it as well, so we can stop
+    // at the first one that already has it
+    while (a != NULL
+            && !a->construct_in_subtree)
+    {
+        a->construct_in_subtree = 1;
+        a = a->parent;
+    }
+}
+
+static inline char ast_is_dirty(const_AST a)
+{
+    return a->dirty;
+}
+
+static inline void ast_propagate_dirty_in_subtree(AST a)
+{
+    while (a != NULL
+            && !a->dirty_in_subtree)
+    {
+        a->dirty_in_subtree = 1;
+        a = a->parent;
+    }
+}
+
+static inline void ast_mark_dirty(AST a)
+{
+    a->dirty = 1;
+    // Force the propagation even if the bit was already set, the
+    // ancestors may have changed
+    a->dirty_in_subtree = 0;
+    ast_propagate_dirty_in_subtree(a);
+}
+
+static inline void ast_set_kind(AST a, node_t node_type)
+{
+    ast_invalidate_structural_id(a);
+    ast_mark_dirty(a);
+    // The new kind must be allowed by the rule of the parent
+    if (a->parent != NULL)
+        ast_mark_dirty(a->parent);
+    a->node_type = node_type;
+    if (ast_kind_is_construct(node_type))
+        ast_propagate_construct_in_subtree(a);
 }
 
 ALWAYS_INLINE static inline char ast_has_son(const_AST a, int son)
@@ -139,7 +221,7 @@ ALWAYS_INLINE static inline AST ast_get_child(const_AST a, int num_child)
 {
     if (ast_has_son(a, num_child))
     {
-        return a->children[ast_son_num_to_son_index(a, num_child)];
+        return a->children[num_child];
     }
     else
     {
@@ -149,7 +231,15 @@ ALWAYS_INLINE static inline AST ast_get_child(const_AST a, int num_child)
 
 static inline void ast_set_parent(AST a, AST parent)
 {
+    // The previous parent may still have a as a child, so its links have
+    // to be checked again
+    if (a->parent != NULL
+            && a->parent != parent)
+        ast_mark_dirty(a->parent);
     a->parent = parent;
+    ast_mark_dirty(a);
+    if (a->construct_in_subtree)
+        ast_propagate_construct_in_subtree(parent);
 }
 
 static inline int ast_count_bitmap(unsigned int bitmap)
@@ -169,41 +259,98 @@ static inline int ast_count_bitmap(unsigned int bitmap)
 #endif
 }
 
+// Allocates from the current region, if any, or from the heap otherwise
+static inline void* ast_allocate(size_t size, char *in_region)
+{
+    void* p = ast_region_allocate(size);
+    *in_region = (p != NULL);
+    if (p == NULL)
+        p = xmalloc(size);
+    return p;
+}
+
+static inline void ast_deallocate(void* p, char in_region)
+{
+    if (!in_region)
+        DELETE(p);
+}
+
+static inline AST* ast_allocate_ambiguities(AST a, int num_ambig)
+{
+    char in_region;
+    AST* ambig = (AST*)ast_allocate(sizeof(AST) * num_ambig, &in_region);
+    a->ambig_in_region = in_region;
+    return ambig;
+}
+
+// Like NEW_REALLOC for the ambiguities of a node
+static inline void ast_reallocate_ambiguities(AST a, int old_num_ambig, int new_num_ambig)
+{
+    if (!a->ambig_in_region
+            && !ast_region_is_active())
+    {
+        a->ambig = NEW_REALLOC(AST, a->ambig, new_num_ambig);
+        return;
+    }
+
+    AST* old_ambig = a->ambig;
+    char old_in_region = a->ambig_in_region;
+
+    a->ambig = ast_allocate_ambiguities(a, new_num_ambig);
+    if (old_ambig != NULL)
+    {
+        memcpy(a->ambig, old_ambig, sizeof(AST) * old_num_ambig);
+        ast_deallocate(old_ambig, old_in_region);
+    }
+}
+
+static inline void* ast_allocate_expr_info(AST a, size_t size)
+{
+    char in_region;
+    a->expr_info = (struct nodecl_expr_info_tag*)ast_allocate(size, &in_region);
+    a->expr_info_in_region = in_region;
+    return a->expr_info;
+}
+
 static inline AST ast_make(node_t type, int __num_children UNUSED_PARAMETER, 
         AST child0, AST child1, AST child2, AST child3, 
         const locus_t* location, const char *text)
 {
-    AST result = NEW(AST_node_t);
+    char in_region;
+    AST result = (AST)ast_allocate(sizeof(AST_node_t), &in_region);
     // ERROR_CONDITION(result & 0x1 != 0, "Invalid pointer for AST", 0);
 
     result->node_type = type;
+    result->node_in_region = in_region;
+    result->ambig_in_region = 0;
+    result->expr_info_in_region = 0;
+    result->structural_id_valid = 0;
+    result->construct_in_subtree = ast_kind_is_construct(type)
+        || (child0 != NULL && child0->construct_in_subtree)
+        || (child1 != NULL && child1->construct_in_subtree)
+        || (child2 != NULL && child2->construct_in_subtree)
+        || (child3 != NULL && child3->construct_in_subtree);
+    result->dirty = 1;
+    result->dirty_in_subtree = 1;
 
-    int num_children = 0;
-    unsigned int bitmap_sons = 0;
-
-    result->bitmap_sons = bitmap_sons;
     result->parent = NULL;
-    result->locus = location;
+    result->locus_index = locus_get_index(location);
 
     result->text = text;
 
-    bitmap_sons =
+    result->bitmap_sons =
         (!!child0)
         | (!!child1 << 1)
         | (!!child2 << 2)
         | (!!child3 << 3);
-    num_children = ast_count_bitmap(bitmap_sons);
 
-    result->bitmap_sons = bitmap_sons;
-    result->children = NEW_VEC(AST, num_children);
-
-    int idx = 0;
 #define ADD_SON(n) \
+    result->children[n] = child##n; \
     if (child##n != NULL) \
     { \
-        result->children[idx] = child##n; \
+        if (child##n->parent != NULL) \
+            ast_mark_dirty(child##n->parent); \
         child##n->parent = result; \
-        idx++; \
     }
 
     ADD_SON(0);
@@ -217,16 +364,10 @@ static inline AST ast_make(node_t type, int __num_children UNUSED_PARAMETER,
     return result;
 }
 
-// This function works both for shrinking or widening
-static inline void ast_reallocate_children(AST a, int num_child, AST new_child)
+static inline void ast_set_child_but_parent(AST a, int num_child, AST new_child)
 {
-    // Reallocate childrens
-    // Save the old children array
-    AST* old_children = a->children;
-    // And the old children bitmap
-    unsigned int old_bitmap = a->bitmap_sons;
-
-    // Enable or disable this new son depending on it being null
+    ast_invalidate_structural_id(a);
+    ast_mark_dirty(a);
     if (new_child != NULL)
     {
         a->bitmap_sons = (a->bitmap_sons | (1 << num_child));
@@ -235,58 +376,10 @@ static inline void ast_reallocate_children(AST a, int num_child, AST new_child)
     {
         a->bitmap_sons = (a->bitmap_sons & (~(1 << num_child)));
     }
-
-    a->children = NEW_VEC(AST, ast_count_bitmap(a->bitmap_sons));
-
-    // Now for every old son, update the new children
-    int i;
-    for (i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
-    {
-        // Note that when shrinking the node ast_has_son
-        // will always return false for num_child.
-        if (ast_has_son(a, i))
-        {
-            if (i == num_child)
-            {
-                // The new son
-                a->children[ast_son_num_to_son_index(a, i)] = new_child;
-            }
-            else
-            {
-                // Old sons that are updated their position
-                a->children[ast_son_num_to_son_index(a, i)] = 
-                    old_children[ast_bitmap_to_index(old_bitmap, i)];
-            }
-        }
-    }
-
-    // Now DELETE the old children (if any)
-    if (old_children != NULL)
-        DELETE(old_children);
-}
-
-static inline void ast_set_child_but_parent(AST a, int num_child, AST new_child)
-{
-    if (new_child == NULL)
-    {
-        if (ast_has_son(a, num_child))
-        {
-            // Shrink the node if we have it
-            ast_reallocate_children(a, num_child, new_child);
-        }
-    }
-    else
-    {
-        if (ast_has_son(a, num_child))
-        {
-            a->children[ast_son_num_to_son_index(a, num_child)] = new_child;
-        }
-        else
-        {
-            // This will widen the node
-            ast_reallocate_children(a, num_child, new_child);
-        }
-    }
+    a->children[num_child] = new_child;
+    if (new_child != NULL
+            && new_child->construct_in_subtree)
+        ast_propagate_construct_in_subtree(a);
 }
 
 static inline void ast_set_child(AST a, int num_child, AST new_child)
@@ -294,6 +387,10 @@ static inline void ast_set_child(AST a, int num_child, AST new_child)
     ast_set_child_but_parent(a, num_child, new_child);
     if (new_child != NULL)
     {
+        // The previous parent may still have new_child as a child
+        if (new_child->parent != NULL
+                && new_child->parent != a)
+            ast_mark_dirty(new_child->parent);
         new_child->parent = a;
     }
 }
@@ -412,7 +509,7 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
             int original_son0 = son0->num_ambig;
 
             son0->num_ambig += son1->num_ambig;
-            son0->ambig = NEW_REALLOC(AST, son0->ambig, son0->num_ambig);
+            ast_reallocate_ambiguities(son0, original_son0, son0->num_ambig);
 
             int i;
             for (i = 0; i < son1->num_ambig; i++)
@@ -425,7 +522,7 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
         else
         {
             son0->num_ambig++;
-            son0->ambig = NEW_REALLOC(AST, son0->ambig, son0->num_ambig);
+            ast_reallocate_ambiguities(son0, son0->num_ambig - 1, son0->num_ambig);
             son0->ambig[son0->num_ambig-1] = son1;
 
             return son0;
@@ -434,7 +531,7 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
     else if (ASTKind(son1) == AST_AMBIGUITY)
     {
         son1->num_ambig++;
-        son1->ambig = NEW_REALLOC(AST, son1->ambig, son1->num_ambig);
+        ast_reallocate_ambiguities(son1, son1->num_ambig - 1, son1->num_ambig);
         son1->ambig[son1->num_ambig-1] = son0;
 
         return son1;
@@ -444,10 +541,10 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
         AST result = ASTLeaf(AST_AMBIGUITY, make_locus("", 0, 0), NULL);
 
         result->num_ambig = 2;
-        result->ambig = NEW_VEC(AST, result->num_ambig);
+        result->ambig = ast_allocate_ambiguities(result, result->num_ambig);
         result->ambig[0] = son0;
         result->ambig[1] = son1;
-        result->locus = son0->locus;
+        result->locus_index = son0->locus_index;
 
         return result;
     }
@@ -455,7 +552,24 @@ static inline AST ast_make_ambiguous(AST son0, AST son1)
 
 static inline void ast_replace(AST dest, const_AST src)
 {
+    // The memory of dest is still the one of dest
+    char node_in_region = dest->node_in_region;
+    AST old_parent = dest->parent;
+    ast_invalidate_structural_id(dest);
     *dest = *src;
+    dest->node_in_region = node_in_region;
+    dest->structural_id_valid = 0;
+    ast_mark_dirty(dest);
+    // dest may now be of a kind not allowed where it is, which is checked
+    // along with its parent
+    if (old_parent != NULL)
+        ast_mark_dirty(old_parent);
+    if (dest->construct_in_subtree)
+    {
+        // dest keeps its place in the tree, so its old ancestors now
+        // contain whatever src contained
+        ast_propagate_construct_in_subtree(old_parent);
+    }
 }
 
 static inline void ast_replace_with_ambiguity(AST a, int n)
@@ -492,7 +606,7 @@ static inline const locus_t* ast_get_locus(const_AST a)
     if (a == NULL)
         return NULL;
     else if (ASTKind(a) != AST_NODE_LIST)
-        return a->locus;
+        return locus_from_index(a->locus_index);
     else
         return ast_get_locus(
                 ASTSon1(ast_list_head(a))
@@ -503,7 +617,7 @@ static inline void ast_set_locus(AST a, const locus_t* locus)
 {
     ERROR_CONDITION(ASTKind(a) == AST_NODE_LIST,
             "list nodes do not have locus", 0);
-    a->locus = locus;
+    a->locus_index = locus_get_index(locus);
 }
 
 static inline const char *ast_get_filename(const_AST a)
@@ -128,6 +128,107 @@ char ast_check(const_AST root)
     DELETE(stack);
 
     return ok;
+#undef PUSH_BACK
+}
+
+char ast_check_dirty(AST root, void (*check_node)(AST))
+{
+    if (root == NULL
+            || !root->dirty_in_subtree)
+        return 1;
+
+    int stack_capacity = 1024;
+    int stack_length = 1;
+    AST *stack = NEW_VEC(AST, stack_capacity);
+
+    stack[0] = root;
+
+#define PUSH_BACK(child) \
+{ \
+    if (stack_length == stack_capacity) \
+    { \
+        stack_capacity *= 2; \
+        stack = NEW_REALLOC(AST, stack, stack_capacity); \
+    } \
+    stack_length++; \
+    stack[stack_length - 1] = (child); \
+}
+
+    char ok = 1;
+    while (stack_length > 0 && ok)
+    {
+        AST node = stack[stack_length - 1];
+        stack_length--;
+
+        int i;
+        if (ast_get_kind(node) == AST_AMBIGUITY)
+        {
+            for (i = 0; i < node->num_ambig; i++)
+            {
+                AST c = node->ambig[i];
+                if (c->dirty_in_subtree)
+                    PUSH_BACK(c);
+            }
+        }
+        else
+        {
+            for (i = 0; i < MCXX_MAX_AST_CHILDREN && ok; i++)
+            {
+                AST c = ast_get_child(node, i);
+                if (c == NULL)
+                    continue;
+
+                // Clean children were checked along with their parent
+                // before, so only links from dirty nodes can be wrong
+                if (node->dirty
+                        && ast_get_parent(c) != node)
+                {
+                    AST wrong_parent = ast_get_parent(c);
+                    fprintf(stderr, "Child %d of %s (%s, %p) does not correctly relink. Instead it points to %s (%s, %p)\n",
+                            i, ast_location(node), ast_print_node_type(ast_get_kind(node)), node,
+                            wrong_parent == NULL ? "(null)" : ast_location(wrong_parent),
+                            wrong_parent == NULL ? "null" : ast_print_node_type(ast_get_kind(wrong_parent)),
+                            wrong_parent);
+                    ok = 0;
+                }
+                else if (c->dirty_in_subtree)
+                {
+                    PUSH_BACK(c);
+                }
+            }
+
+            // Only the links of this list node are checked, the rest of
+            // the list is either clean or dirty itself
+            if (ok
+                    && node->dirty
+                    && ast_get_kind(node) == AST_NODE_LIST
+                    && (ASTSon1(node) == NULL
+                        || ASTKind(ASTSon1(node)) == AST_NODE_LIST
+                        || (ASTSon0(node) != NULL
+                            && ASTKind(ASTSon0(node)) != AST_NODE_LIST)))
+            {
+                fprintf(stderr, "List node %p (%s) is incorrectly built\n",
+                        node,
+                        ast_location(node));
+                ok = 0;
+            }
+
+            if (ok
+                    && node->dirty
+                    && check_node != NULL)
+            {
+                check_node(node);
+            }
+        }
+
+        node->dirty = 0;
+        node->dirty_in_subtree = 0;
+    }
+
+    DELETE(stack);
+
+    return ok;
+#undef PUSH_BACK
 }
 
 char ast_check_list_tree(const_AST root)
@@ -273,22 +374,165 @@ void ast_free(AST root)
             }
         }
 
-        DELETE(a->expr_info);
-        DELETE(a->children);
+        ast_deallocate(a->expr_info, a->expr_info_in_region);
+        if (ast_get_kind(a) == AST_AMBIGUITY)
+            ast_deallocate(a->ambig, a->ambig_in_region);
         // Clear the node for safety
         // __builtin_memset(a, 0, sizeof(*a));
-        DELETE(a);
+        ast_deallocate(a, a->node_in_region);
     }
 
     DELETE(stack);
 #undef PUSH_BACK
 }
 
+struct ast_region_tag
+{
+    char* current;
+    size_t current_free;
+
+    int num_pages;
+    char** pages;
+
+    unsigned long long int bytes_used;
+};
+
+enum
+{
+    AST_REGION_PAGE_SIZE = 256 * 1024,
+    // Allocations bigger than this get a page of their own
+    AST_REGION_MAX_SMALL_SIZE = AST_REGION_PAGE_SIZE / 8,
+    AST_REGION_ALIGNMENT = sizeof(void*),
+};
+
+static int num_pushed_regions = 0;
+static ast_region_t** pushed_regions = NULL;
+
+static unsigned long long int region_bytes_used = 0;
+
+ast_region_t* ast_region_new(void)
+{
+    return NEW0(ast_region_t);
+}
+
+void ast_region_free(ast_region_t* region)
+{
+    int i;
+    for (i = 0; i < num_pushed_regions; i++)
+    {
+        ERROR_CONDITION(pushed_regions[i] == region,
+                "Freeing a region that is still pushed", 0);
+    }
+
+    for (i = 0; i < region->num_pages; i++)
+    {
+        DELETE(region->pages[i]);
+    }
+    DELETE(region->pages);
+
+    region_bytes_used -= region->bytes_used;
+    DELETE(region);
+}
+
+void ast_region_push(ast_region_t* region)
+{
+    P_LIST_ADD(pushed_regions, num_pushed_regions, region);
+}
+
+void ast_region_pop(ast_region_t* region)
+{
+    ERROR_CONDITION(num_pushed_regions == 0
+            || pushed_regions[num_pushed_regions - 1] != region,
+            "This region is not the current one", 0);
+    num_pushed_regions--;
+}
+
+char ast_region_is_active(void)
+{
+    return num_pushed_regions > 0;
+}
+
+static char* ast_region_new_page(ast_region_t* region, size_t size)
+{
+    char* page = xmalloc(size);
+    P_LIST_ADD(region->pages, region->num_pages, page);
+
+    region->bytes_used += size;
+    region_bytes_used += size;
+
+    return page;
+}
+
+void* ast_region_allocate(size_t size)
+{
+    if (num_pushed_regions == 0)
+        return NULL;
+
+    ast_region_t* region = pushed_regions[num_pushed_regions - 1];
+
+    size = (size + AST_REGION_ALIGNMENT - 1) & ~(size_t)(AST_REGION_ALIGNMENT - 1);
+    if (size > AST_REGION_MAX_SMALL_SIZE)
+        return ast_region_new_page(region, size);
+
+    if (size > region->current_free)
+    {
+        region->current = ast_region_new_page(region, AST_REGION_PAGE_SIZE);
+        region->current_free = AST_REGION_PAGE_SIZE;
+    }
+
+    void* result = region->current;
+    region->current += size;
+    region->current_free -= size;
+
+    return result;
+}
+
+unsigned long long int ast_region_used_memory(void)
+{
+    return region_bytes_used;
+}
+
+unsigned char ast_construct_kinds[AST_LAST_NODE];
+
+char ast_compute_construct_kind(node_t kind)
+{
+    static const char* construct_prefixes[] =
+    {
+        "NODECL_PRAGMA_CUSTOM_DIRECTIVE",
+        "NODECL_PRAGMA_CUSTOM_STATEMENT",
+        "NODECL_PRAGMA_CUSTOM_DECLARATION",
+        "NODECL_OPEN_M_P_",
+        "NODECL_OMP_SS_",
+    };
+
+    char is_construct = 0;
+    const char* name = ast_node_type_name(kind);
+    unsigned int i;
+    for (i = 0;
+            name != NULL
+            && !is_construct
+            && i < STATIC_ARRAY_LENGTH(construct_prefixes);
+            i++)
+    {
+        is_construct = (strncmp(name, construct_prefixes[i],
+                    strlen(construct_prefixes[i])) == 0);
+    }
+
+    ast_construct_kinds[kind] = is_construct ? 2 : 1;
+    return is_construct;
+}
+
 static void ast_copy_one_node(AST dest, AST orig)
 {
+    char node_in_region = dest->node_in_region;
     *dest = *orig;
+    dest->node_in_region = node_in_region;
+    dest->structural_id_valid = 0;
+    dest->dirty = 1;
+    dest->dirty_in_subtree = 1;
     dest->bitmap_sons = 0;
-    dest->children = 0;
+    memset(dest->children, 0, sizeof(dest->children));
+    dest->ambig_in_region = 0;
 }
 
 AST ast_duplicate_one_node(AST orig)
@@ -304,7 +548,10 @@ AST ast_copy(const_AST a)
     if (a == NULL)
         return NULL;
 
-    AST result = NEW0(AST_node_t);
+    char in_region;
+    AST result = (AST)ast_allocate(sizeof(AST_node_t), &in_region);
+    memset(result, 0, sizeof(*result));
+    result->node_in_region = in_region;
 
     ast_copy_one_node(result, (AST)a);
 
@@ -313,7 +560,7 @@ AST ast_copy(const_AST a)
             && a->num_ambig > 0)
     {
         result->num_ambig = a->num_ambig;
-        result->ambig = NEW_VEC(AST, a->num_ambig);
+        result->ambig = ast_allocate_ambiguities(result, a->num_ambig);
         for (i = 0; i < a->num_ambig; i++)
         {
             result->ambig[i] = ast_copy(a->ambig[i]);
@@ -321,11 +568,6 @@ AST ast_copy(const_AST a)
     }
     else
     {
-        result->bitmap_sons = a->bitmap_sons;
-        int num_children = ast_count_bitmap(result->bitmap_sons);
-
-        result->children = NEW_VEC(AST, num_children);
-
         for (i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
         {
             AST c = ast_copy(ast_get_child(a, i));
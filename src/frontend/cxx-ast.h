@@ -71,6 +71,29 @@ static inline void ast_set_text(AST a, const char* str);
 // Sets the kind
 static inline void ast_set_kind(AST a, node_t node_type);
 
+// Memoization of structural ids. Any change to a node invalidates its id
+// and those of its ancestors
+static inline char ast_get_structural_id_valid(const_AST a);
+static inline void ast_set_structural_id_valid(AST a);
+static inline void ast_invalidate_structural_id(AST a);
+
+// Summary of pragma and OpenMP/OmpSs constructs. Every node knows whether
+// its subtree might contain one of them so traversals looking for constructs
+// can skip the rest of the tree
+static inline char ast_kind_is_construct(node_t kind);
+static inline char ast_has_construct_in_subtree(const_AST a);
+static inline void ast_propagate_construct_in_subtree(AST a);
+
+// Incremental checking. Nodes created or modified are marked dirty so
+// ast_check_dirty only has to visit them
+static inline char ast_is_dirty(const_AST a);
+static inline void ast_mark_dirty(AST a);
+static inline void ast_propagate_dirty_in_subtree(AST a);
+
+// Do not use these directly, use ast_kind_is_construct instead
+LIBMCXX_EXTERN unsigned char ast_construct_kinds[AST_LAST_NODE];
+LIBMCXX_EXTERN char ast_compute_construct_kind(node_t kind);
+
 // Returns the children 'num_child'. Might be
 // NULL
 static inline AST ast_get_child(const_AST a, int num_child);
@@ -131,9 +154,33 @@ LIBMCXX_EXTERN char ast_check(const_AST a);
 // Special checker for list trees (invoked also by ast_check above)
 LIBMCXX_EXTERN char ast_check_list_tree(const_AST a);
 
+// Like ast_check but only checks the nodes marked as dirty, which are
+// unmarked afterwards. If check_node is not NULL it is called for every
+// dirty node
+LIBMCXX_EXTERN char ast_check_dirty(AST a, void (*check_node)(AST));
+
 // Frees tree.
 LIBMCXX_EXTERN void ast_free(AST a);
 
+// Regions. While a region is pushed, nodes (and their children and
+// expression info) are allocated in it. Freeing a node allocated in a
+// region does nothing, instead the whole region is released at once with
+// ast_region_free. Regions can be nested
+typedef struct ast_region_tag ast_region_t;
+
+LIBMCXX_EXTERN ast_region_t* ast_region_new(void);
+LIBMCXX_EXTERN void ast_region_free(ast_region_t* region);
+
+LIBMCXX_EXTERN void ast_region_push(ast_region_t* region);
+LIBMCXX_EXTERN void ast_region_pop(ast_region_t* region);
+
+LIBMCXX_EXTERN char ast_region_is_active(void);
+// Returns NULL if there is no region pushed
+LIBMCXX_EXTERN void* ast_region_allocate(size_t size);
+
+// Used by memory report
+LIBMCXX_EXTERN unsigned long long int ast_region_used_memory(void);
+
 // Gives a copy of all the tree but extended data is the same as original trees
 LIBMCXX_EXTERN AST ast_copy(const_AST a);
 
@@ -4044,6 +4044,7 @@ static void gather_type_spec_from_friend_elaborated_class_specifier_common(
         // going to change its type
         scope_entry_t* new_dep = NEW0(scope_entry_t);
         *new_dep = *entry;
+        symbol_entity_specs_unshare(new_dep);
         new_dep->type_information = set_dependent_entry_kind(entry->type_information, class_kind);
         new_dep->decl_context = decl_context;
 
@@ -4865,6 +4866,7 @@ static void gather_type_spec_from_elaborated_class_specifier(AST a,
                 scope_entry_t* old_entry = entry;
                 entry = NEW0(scope_entry_t);
                 *entry = *old_entry;
+                symbol_entity_specs_unshare(entry);
 
                 keep_extra_attributes_in_symbol(entry, &class_gather_info);
             }
@@ -10364,6 +10366,7 @@ void gather_type_spec_from_class_specifier(AST a, type_t** type_info,
                     class_entry->symbol_name);
 
             *injected_symbol = *class_entry;
+            symbol_entity_specs_unshare(injected_symbol);
             // the injected class name is logically in the class-scope
             injected_symbol->decl_context = inner_decl_context;
             injected_symbol->do_not_print = 1;
@@ -19746,7 +19749,10 @@ static void build_scope_condition(AST a, const decl_context_t* decl_context, nod
     }
     else
     {
-        check_expression(ASTSon2(a), decl_context, nodecl_output);
+        if (!ambiguity_take_checked_expression(ASTSon2(a), decl_context, nodecl_output))
+        {
+            check_expression(ASTSon2(a), decl_context, nodecl_output);
+        }
     }
 }
 
@@ -19898,7 +19904,10 @@ static void build_scope_expression_statement(AST a,
 {
     AST expr = ASTSon0(a);
     nodecl_t nodecl_expr = nodecl_null();
-    check_expression(expr, decl_context, &nodecl_expr);
+    if (!ambiguity_take_checked_expression(expr, decl_context, &nodecl_expr))
+    {
+        check_expression(expr, decl_context, &nodecl_expr);
+    }
 
     build_scope_nodecl_expression_statement(nodecl_expr,
             decl_context,
@@ -389,6 +389,18 @@ static void const_value_free(const_value_t* v)
 
 static rb_red_blk_tree* _const_value_pool = NULL;
 
+static const_value_counters_t _const_value_counters;
+
+const_value_counters_t* const_value_get_counters(void)
+{
+    return &_const_value_counters;
+}
+
+void const_value_reset_counters(void)
+{
+    memset(&_const_value_counters, 0, sizeof(_const_value_counters));
+}
+
 static const_value_t* const_value_return_unique(const_value_t* v)
 {
     if (_const_value_pool == NULL)
@@ -414,6 +426,10 @@ static const_value_t* const_value_return_unique(const_value_t* v)
     return result;
 }
 
+// Integers in this range are kept in _small_integers, indexed by sign,
+// num_bytes and value
+enum { SMALL_INTEGER_MIN = -16, SMALL_INTEGER_MAX = 255 };
+static const_value_t** _small_integers[2][MCXX_MAX_BYTES_INTEGER + 1];
 
 const_value_t* const_value_get_integer(cvalue_uint_t value, int num_bytes, char sign)
 {
@@ -429,13 +445,36 @@ const_value_t* const_value_get_integer(cvalue_uint_t value, int num_bytes, char
         value &= ~mask;
     }
 
+    // Small integers are found directly in a table rather than in the pool
+    const_value_t** small_integer = NULL;
+    if (SMALL_INTEGER_MIN <= (cvalue_int_t)value
+            && (cvalue_int_t)value <= SMALL_INTEGER_MAX)
+    {
+        const_value_t*** small_integers = &_small_integers[sign != 0][num_bytes];
+        if (*small_integers == NULL)
+        {
+            *small_integers = NEW_VEC0(const_value_t*, SMALL_INTEGER_MAX - SMALL_INTEGER_MIN + 1);
+        }
+
+        small_integer = &(*small_integers)[(int)((cvalue_int_t)value - SMALL_INTEGER_MIN)];
+        if (*small_integer != NULL)
+        {
+            _const_value_counters.small_integer_hits++;
+            return *small_integer;
+        }
+    }
+
     const_value_t* cval = NEW0(const_value_t);
     cval->kind = CVK_INTEGER;
     cval->value.i = value;
     cval->num_bytes = num_bytes;
     cval->sign = sign;
 
-    return const_value_return_unique(cval);
+    cval = const_value_return_unique(cval);
+    if (small_integer != NULL)
+        *small_integer = cval;
+
+    return cval;
 }
 
 #define GET_SIGNED_INTEGER(type)  \
@@ -2560,6 +2599,7 @@ static const_value_t* extend_second_operand_to_structured_value(const_value_t* (
 const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 { \
     ERROR_CONDITION(v1 == NULL || v2 == NULL, "Either of the parameters is NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if ((v1->kind == CVK_INTEGER) \
             && (v2->kind == CVK_INTEGER)) \
     { \
@@ -2582,6 +2622,7 @@ const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 const_value_t* const_value_bitshl(const_value_t* v1, const_value_t* v2)
 {
     ERROR_CONDITION(v1 == NULL || v2 == NULL, "Either of the parameters is NULL", 0);
+    _const_value_counters.folded_operations++;
     if ((v1->kind == CVK_INTEGER)
             && (v2->kind == CVK_INTEGER))
     {
@@ -3063,6 +3104,7 @@ const_value_t* const_value_bitshl(const_value_t* v1, const_value_t* v2)
 const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 { \
     ERROR_CONDITION(v1 == NULL || v2 == NULL, "Either of the parameters is NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if ((v1->kind == CVK_INTEGER) \
             && (v2->kind == CVK_INTEGER)) \
     { \
@@ -3141,6 +3183,7 @@ const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 { \
     ERROR_CONDITION(v1 == NULL || v2 == NULL, "Either of the parameters is NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if (v1->kind == CVK_INTEGER \
             && v2->kind == CVK_INTEGER) \
     { \
@@ -3410,6 +3453,7 @@ const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 { \
     ERROR_CONDITION(v1 == NULL || v2 == NULL, "Either of the parameters is NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if ((v1->kind == CVK_INTEGER) \
             && (v2->kind == CVK_INTEGER)) \
     { \
@@ -3488,6 +3532,7 @@ const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 const_value_t* const_value_##_opname(const_value_t* v1, const_value_t* v2) \
 { \
     ERROR_CONDITION(v1 == NULL || v2 == NULL, "Either of the parameters is NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if (v1->kind == CVK_INTEGER \
             && v2->kind == CVK_INTEGER) \
     { \
@@ -3698,6 +3743,7 @@ BINOP_FUN_CALL(pow, arith_pow)
 const_value_t* const_value_##_opname(const_value_t* v1) \
 { \
     ERROR_CONDITION(v1 == NULL, "Parameter cannot be NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if (v1->kind == CVK_INTEGER) \
     { \
         cvalue_uint_t value = 0; \
@@ -3745,6 +3791,7 @@ const_value_t* const_value_##_opname(const_value_t* v1) \
 const_value_t* const_value_##_opname(const_value_t* v1) \
 { \
     ERROR_CONDITION(v1 == NULL, "Parameter cannot be NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if (v1->kind == CVK_INTEGER) \
     { \
         cvalue_uint_t value = 0; \
@@ -3782,6 +3829,7 @@ const_value_t* const_value_##_opname(const_value_t* v1) \
 const_value_t* const_value_##_opname(const_value_t* v1) \
 { \
     ERROR_CONDITION(v1 == NULL, "Parameter cannot be NULL", 0); \
+    _const_value_counters.folded_operations++; \
     if (v1->kind == CVK_INTEGER) \
     { \
         cvalue_uint_t value = 0; \
@@ -61,6 +61,22 @@ typedef uint64_t cvalue_uint_t;
 typedef int64_t  cvalue_int_t;
 #endif
 
+// Counters of constant evaluation, see const_value_reset_counters
+typedef struct const_value_counters_tag
+{
+    // Operations folded in constant values
+    int folded_operations;
+    // Integers found in the table of small integers
+    int small_integer_hits;
+    // Calls to constexpr functions evaluated, and those of them whose value
+    // was reused from an identical previous call
+    int constexpr_calls;
+    int constexpr_call_cache_hits;
+} const_value_counters_t;
+
+LIBMCXX_EXTERN const_value_counters_t* const_value_get_counters(void);
+LIBMCXX_EXTERN void const_value_reset_counters(void);
+
 LIBMCXX_EXTERN const_value_t* const_value_get_integer(cvalue_uint_t value, int num_bytes, char sign);
 
 LIBMCXX_EXTERN const_value_t* const_value_get_signed_int(cvalue_uint_t value);
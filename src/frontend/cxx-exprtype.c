@@ -27024,6 +27024,109 @@ static const_value_t* evaluate_constexpr_regular_function_call(
     return cval;
 }
 
+// Values of previous calls to a constexpr function, keyed by the function
+typedef
+struct constexpr_call_cache_item_tag
+{
+    int num_arguments;
+    const_value_t** arguments;
+    const_value_t* value;
+} constexpr_call_cache_item_t;
+
+typedef
+struct constexpr_call_cache_tag
+{
+    int num_items;
+    constexpr_call_cache_item_t* items;
+} constexpr_call_cache_t;
+
+static dhash_ptr_t* _constexpr_call_cache = NULL;
+
+// Returns the constant values of the arguments of a call that can be
+// cached, NULL otherwise. Constant values are unique so the values can be
+// compared by address
+static const_value_t** constexpr_call_cache_get_arguments(
+        scope_entry_t* entry,
+        nodecl_t converted_arg_list,
+        int *num_arguments)
+{
+    // Constructors and nonstatic member functions depend on the object
+    if (symbol_entity_specs_get_is_constructor(entry)
+            || (symbol_entity_specs_get_is_member(entry)
+                && !symbol_entity_specs_get_is_static(entry)))
+        return NULL;
+
+    int num_items = 0;
+    nodecl_t* list = nodecl_unpack_list(converted_arg_list, &num_items);
+
+    const_value_t** arguments = NEW_VEC0(const_value_t*, num_items + 1);
+    int i;
+    for (i = 0; i < num_items; i++)
+    {
+        arguments[i] = nodecl_get_constant(list[i]);
+        if (arguments[i] == NULL)
+        {
+            DELETE(arguments);
+            arguments = NULL;
+            break;
+        }
+    }
+    DELETE(list);
+
+    *num_arguments = num_items;
+    return arguments;
+}
+
+static constexpr_call_cache_item_t* constexpr_call_cache_query(
+        scope_entry_t* entry,
+        int num_arguments,
+        const_value_t** arguments)
+{
+    if (_constexpr_call_cache == NULL)
+        return NULL;
+
+    constexpr_call_cache_t* cache =
+        (constexpr_call_cache_t*)dhash_ptr_query(_constexpr_call_cache, (const char*)entry);
+    if (cache == NULL)
+        return NULL;
+
+    int i;
+    for (i = 0; i < cache->num_items; i++)
+    {
+        if (cache->items[i].num_arguments == num_arguments
+                && memcmp(cache->items[i].arguments, arguments,
+                    num_arguments * sizeof(*arguments)) == 0)
+            return &cache->items[i];
+    }
+
+    return NULL;
+}
+
+static void constexpr_call_cache_add(
+        scope_entry_t* entry,
+        int num_arguments,
+        const_value_t** arguments,
+        const_value_t* value)
+{
+    if (_constexpr_call_cache == NULL)
+        _constexpr_call_cache = dhash_ptr_new(5);
+
+    constexpr_call_cache_t* cache =
+        (constexpr_call_cache_t*)dhash_ptr_query(_constexpr_call_cache, (const char*)entry);
+    if (cache == NULL)
+    {
+        cache = NEW0(constexpr_call_cache_t);
+        dhash_ptr_insert(_constexpr_call_cache, (const char*)entry, cache);
+    }
+
+    constexpr_call_cache_item_t item;
+    item.num_arguments = num_arguments;
+    item.arguments = arguments;
+    item.value = value;
+
+    P_LIST_ADD(cache->items, cache->num_items, item);
+}
+
 static const_value_t* evaluate_constexpr_function_call(
         scope_entry_t* entry,
         nodecl_t converted_arg_list,
@@ -27038,6 +27141,27 @@ static const_value_t* evaluate_constexpr_function_call(
                     get_qualified_symbol_name(entry, entry->decl_context)));
     }
 
+    const_value_get_counters()->constexpr_calls++;
+
+    int num_arguments = 0;
+    const_value_t** arguments = constexpr_call_cache_get_arguments(
+            entry, converted_arg_list, &num_arguments);
+    if (arguments != NULL)
+    {
+        constexpr_call_cache_item_t* item =
+            constexpr_call_cache_query(entry, num_arguments, arguments);
+        if (item != NULL)
+        {
+            DEBUG_CODE()
+            {
+                fprintf(stderr, "EXPRTYPE: Reusing the value of a previous identical constexpr call\n");
+            }
+            const_value_get_counters()->constexpr_call_cache_hits++;
+            DELETE(arguments);
+            return item->value;
+        }
+    }
+
     const_value_t* value = NULL;
     if (symbol_entity_specs_get_is_constructor(entry))
     {
@@ -27056,6 +27180,15 @@ static const_value_t* evaluate_constexpr_function_call(
                 locus);
     }
 
+    // Only values are cached: failed evaluations must diagnose again
+    if (arguments != NULL)
+    {
+        if (value != NULL)
+            constexpr_call_cache_add(entry, num_arguments, arguments, value);
+        else
+            DELETE(arguments);
+    }
+
     return value;
 }
 
@@ -32052,3 +32185,158 @@ static void check_multiexpression(AST expr, const decl_context_t* decl_context,
             nodecl_get_type(nodecl_subexpr),
             ast_get_locus(expr));
 }
+
+// Entry points used by the nodecl builder of TL. They compute the type of the
+// expression from already checked operands so phases can build expressions
+// without going through the lexer and the parser
+nodecl_t cxx_nodecl_make_unary_operation(
+        node_t node_kind,
+        nodecl_t nodecl_op,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    if (nodecl_is_err_expr(nodecl_op))
+        return nodecl_make_err_expr(locus);
+
+    nodecl_t nodecl_output = nodecl_null();
+    switch (node_kind)
+    {
+        // Increments and decrements are not in unary_expression_fun
+        case NODECL_PREINCREMENT:
+            check_nodecl_preincrement(nodecl_op, decl_context, &nodecl_output);
+            break;
+        case NODECL_PREDECREMENT:
+            check_nodecl_predecrement(nodecl_op, decl_context, &nodecl_output);
+            break;
+        case NODECL_POSTINCREMENT:
+            check_nodecl_postincrement(nodecl_op, decl_context, &nodecl_output);
+            break;
+        case NODECL_POSTDECREMENT:
+            check_nodecl_postdecrement(nodecl_op, decl_context, &nodecl_output);
+            break;
+        default:
+            ERROR_CONDITION((size_t)node_kind >= STATIC_ARRAY_LENGTH(unary_expression_fun)
+                    || unary_expression_fun[node_kind].func == NULL,
+                    "Invalid unary operation node %s", ast_node_type_name(node_kind));
+            check_unary_expression_(node_kind, &nodecl_op, decl_context, locus, &nodecl_output);
+            break;
+    }
+
+    return nodecl_output;
+}
+
+nodecl_t cxx_nodecl_make_binary_operation(
+        node_t node_kind,
+        nodecl_t nodecl_lhs,
+        nodecl_t nodecl_rhs,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    ERROR_CONDITION((size_t)node_kind >= STATIC_ARRAY_LENGTH(binary_expression_fun)
+            || binary_expression_fun[node_kind].func == NULL,
+            "Invalid binary operation node %s", ast_node_type_name(node_kind));
+
+    if (nodecl_is_err_expr(nodecl_lhs)
+            || nodecl_is_err_expr(nodecl_rhs))
+    {
+        nodecl_free(nodecl_lhs);
+        nodecl_free(nodecl_rhs);
+        return nodecl_make_err_expr(locus);
+    }
+
+    nodecl_t nodecl_output = nodecl_null();
+    check_binary_expression_(node_kind, &nodecl_lhs, &nodecl_rhs, decl_context, locus, &nodecl_output);
+
+    return nodecl_output;
+}
+
+nodecl_t cxx_nodecl_make_cast(
+        nodecl_t nodecl_casted_expr,
+        type_t* dest_type,
+        const char* cast_kind,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    if (nodecl_is_err_expr(nodecl_casted_expr))
+        return nodecl_make_err_expr(locus);
+
+    nodecl_t nodecl_output = nodecl_null();
+    check_nodecl_cast_expr(nodecl_casted_expr, decl_context, dest_type,
+            cast_kind == NULL ? "C" : cast_kind,
+            locus, &nodecl_output);
+
+    return nodecl_output;
+}
+
+nodecl_t cxx_nodecl_make_member_access(
+        nodecl_t nodecl_accessed,
+        const char* member_name,
+        char is_arrow,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    nodecl_t nodecl_output = nodecl_null();
+    check_nodecl_member_access(nodecl_accessed,
+            nodecl_make_cxx_dep_name_simple(member_name, locus),
+            decl_context, is_arrow,
+            /* has_template_tag */ 0,
+            locus, &nodecl_output);
+
+    return nodecl_output;
+}
+
+nodecl_t cxx_nodecl_make_array_subscript(
+        nodecl_t nodecl_subscripted,
+        nodecl_t nodecl_subscript,
+        const decl_context_t* decl_context)
+{
+    nodecl_t nodecl_output = nodecl_null();
+    check_nodecl_array_subscript_expression(nodecl_subscripted, nodecl_subscript,
+            decl_context, &nodecl_output);
+
+    return nodecl_output;
+}
+
+nodecl_t cxx_nodecl_make_id_expression(
+        const char* name,
+        const decl_context_t* decl_context,
+        const locus_t* locus)
+{
+    nodecl_t nodecl_name = nodecl_make_cxx_dep_name_simple(uniquestr(name), locus);
+
+    scope_entry_list_t* entry_list = query_nodecl_name(decl_context, nodecl_name, NULL);
+    if (entry_list == NULL)
+    {
+        error_printf_at(locus, "symbol '%s' not found in current scope\n", name);
+        nodecl_free(nodecl_name);
+        return nodecl_make_err_expr(locus);
+    }
+
+    nodecl_t nodecl_output = nodecl_null();
+    if (IS_C_LANGUAGE)
+    {
+        // This frees entry_list
+        compute_symbol_type_from_entry_list(entry_list, &nodecl_output, locus);
+    }
+    else
+    {
+        // Overloaded functions are kept as an unresolved overload
+        cxx_compute_name_from_entry_list(nodecl_name, entry_list, decl_context, NULL, &nodecl_output);
+        entry_list_free(entry_list);
+    }
+    nodecl_free(nodecl_name);
+
+    return nodecl_output;
+}
+
+nodecl_t cxx_nodecl_make_checked_function_call(
+        nodecl_t nodecl_called,
+        nodecl_t nodecl_argument_list,
+        const decl_context_t* decl_context)
+{
+    nodecl_t nodecl_output = nodecl_null();
+    check_nodecl_function_call(nodecl_called, nodecl_argument_list,
+            decl_context, &nodecl_output);
+
+    return nodecl_output;
+}
@@ -225,6 +225,40 @@ LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_conversion_to_logical(nodecl_t expr, typ
         const locus_t* locus);
 LIBMCXX_EXTERN nodecl_t cxx_nodecl_wrap_in_parentheses(nodecl_t n);
 
+// Build already checked expressions from already checked operands. They
+// return a NODECL_ERR_EXPR (and emit a diagnostic) if the expression is invalid
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_unary_operation(node_t node_kind,
+        nodecl_t nodecl_op,
+        const decl_context_t* decl_context,
+        const locus_t* locus);
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_binary_operation(node_t node_kind,
+        nodecl_t nodecl_lhs,
+        nodecl_t nodecl_rhs,
+        const decl_context_t* decl_context,
+        const locus_t* locus);
+// cast_kind is one of "C", "static_cast", "dynamic_cast", "reinterpret_cast"
+// or "const_cast". NULL means "C"
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_cast(nodecl_t nodecl_casted_expr,
+        type_t* dest_type,
+        const char* cast_kind,
+        const decl_context_t* decl_context,
+        const locus_t* locus);
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_member_access(nodecl_t nodecl_accessed,
+        const char* member_name,
+        char is_arrow,
+        const decl_context_t* decl_context,
+        const locus_t* locus);
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_array_subscript(nodecl_t nodecl_subscripted,
+        nodecl_t nodecl_subscript,
+        const decl_context_t* decl_context);
+// Unqualified name looked up in decl_context
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_id_expression(const char* name,
+        const decl_context_t* decl_context,
+        const locus_t* locus);
+LIBMCXX_EXTERN nodecl_t cxx_nodecl_make_checked_function_call(nodecl_t nodecl_called,
+        nodecl_t nodecl_argument_list,
+        const decl_context_t* decl_context);
+
 LIBMCXX_EXTERN scope_entry_t* resolve_symbol_this(const decl_context_t* decl_context);
  
 // Given a base NODECL_SYMBOL it integrates it in an accessor that can be a NODECL_SYMBOL or a NODECL_CLASS_MEMBER_ACCESS
@@ -1,3 +1,4 @@
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabalsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabalsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabalsv2si"));
 sym___builtin_neon_vabalsv2si->kind = SK_FUNCTION;sym___builtin_neon_vabalsv2si->do_not_print = 1;sym___builtin_neon_vabalsv2si->locus = builtins_locus;
@@ -10,6 +11,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabalsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabalsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabalsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabalsv4hi"));
 sym___builtin_neon_vabalsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabalsv4hi->do_not_print = 1;sym___builtin_neon_vabalsv4hi->locus = builtins_locus;
@@ -22,6 +24,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabalsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabalsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabalsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabalsv8qi"));
 sym___builtin_neon_vabalsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabalsv8qi->do_not_print = 1;sym___builtin_neon_vabalsv8qi->locus = builtins_locus;
@@ -34,6 +37,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabalsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabaluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabaluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabaluv2si"));
 sym___builtin_neon_vabaluv2si->kind = SK_FUNCTION;sym___builtin_neon_vabaluv2si->do_not_print = 1;sym___builtin_neon_vabaluv2si->locus = builtins_locus;
@@ -46,6 +50,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabaluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabaluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabaluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabaluv4hi"));
 sym___builtin_neon_vabaluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabaluv4hi->do_not_print = 1;sym___builtin_neon_vabaluv4hi->locus = builtins_locus;
@@ -58,6 +63,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabaluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabaluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabaluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabaluv8qi"));
 sym___builtin_neon_vabaluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabaluv8qi->do_not_print = 1;sym___builtin_neon_vabaluv8qi->locus = builtins_locus;
@@ -70,6 +76,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabaluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabasv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabasv16qi"));
 sym___builtin_neon_vabasv16qi->kind = SK_FUNCTION;sym___builtin_neon_vabasv16qi->do_not_print = 1;sym___builtin_neon_vabasv16qi->locus = builtins_locus;
@@ -82,6 +89,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabasv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabasv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabasv2si"));
 sym___builtin_neon_vabasv2si->kind = SK_FUNCTION;sym___builtin_neon_vabasv2si->do_not_print = 1;sym___builtin_neon_vabasv2si->locus = builtins_locus;
@@ -94,6 +102,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabasv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabasv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabasv4hi"));
 sym___builtin_neon_vabasv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabasv4hi->do_not_print = 1;sym___builtin_neon_vabasv4hi->locus = builtins_locus;
@@ -106,6 +115,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabasv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabasv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabasv4si"));
 sym___builtin_neon_vabasv4si->kind = SK_FUNCTION;sym___builtin_neon_vabasv4si->do_not_print = 1;sym___builtin_neon_vabasv4si->locus = builtins_locus;
@@ -118,6 +128,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabasv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabasv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabasv8hi"));
 sym___builtin_neon_vabasv8hi->kind = SK_FUNCTION;sym___builtin_neon_vabasv8hi->do_not_print = 1;sym___builtin_neon_vabasv8hi->locus = builtins_locus;
@@ -130,6 +141,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabasv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabasv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabasv8qi"));
 sym___builtin_neon_vabasv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabasv8qi->do_not_print = 1;sym___builtin_neon_vabasv8qi->locus = builtins_locus;
@@ -142,6 +154,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabasv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabauv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabauv16qi"));
 sym___builtin_neon_vabauv16qi->kind = SK_FUNCTION;sym___builtin_neon_vabauv16qi->do_not_print = 1;sym___builtin_neon_vabauv16qi->locus = builtins_locus;
@@ -154,6 +167,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabauv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabauv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabauv2si"));
 sym___builtin_neon_vabauv2si->kind = SK_FUNCTION;sym___builtin_neon_vabauv2si->do_not_print = 1;sym___builtin_neon_vabauv2si->locus = builtins_locus;
@@ -166,6 +180,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabauv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabauv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabauv4hi"));
 sym___builtin_neon_vabauv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabauv4hi->do_not_print = 1;sym___builtin_neon_vabauv4hi->locus = builtins_locus;
@@ -178,6 +193,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabauv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabauv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabauv4si"));
 sym___builtin_neon_vabauv4si->kind = SK_FUNCTION;sym___builtin_neon_vabauv4si->do_not_print = 1;sym___builtin_neon_vabauv4si->locus = builtins_locus;
@@ -190,6 +206,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabauv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabauv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabauv8hi"));
 sym___builtin_neon_vabauv8hi->kind = SK_FUNCTION;sym___builtin_neon_vabauv8hi->do_not_print = 1;sym___builtin_neon_vabauv8hi->locus = builtins_locus;
@@ -202,6 +219,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabauv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabauv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabauv8qi"));
 sym___builtin_neon_vabauv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabauv8qi->do_not_print = 1;sym___builtin_neon_vabauv8qi->locus = builtins_locus;
@@ -214,6 +232,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabauv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdfv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdfv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdfv2sf"));
 sym___builtin_neon_vabdfv2sf->kind = SK_FUNCTION;sym___builtin_neon_vabdfv2sf->do_not_print = 1;sym___builtin_neon_vabdfv2sf->locus = builtins_locus;
@@ -225,6 +244,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdfv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdfv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdfv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdfv4sf"));
 sym___builtin_neon_vabdfv4sf->kind = SK_FUNCTION;sym___builtin_neon_vabdfv4sf->do_not_print = 1;sym___builtin_neon_vabdfv4sf->locus = builtins_locus;
@@ -236,6 +256,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdfv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdlsv2si"));
 sym___builtin_neon_vabdlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vabdlsv2si->do_not_print = 1;sym___builtin_neon_vabdlsv2si->locus = builtins_locus;
@@ -247,6 +268,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdlsv4hi"));
 sym___builtin_neon_vabdlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabdlsv4hi->do_not_print = 1;sym___builtin_neon_vabdlsv4hi->locus = builtins_locus;
@@ -258,6 +280,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdlsv8qi"));
 sym___builtin_neon_vabdlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabdlsv8qi->do_not_print = 1;sym___builtin_neon_vabdlsv8qi->locus = builtins_locus;
@@ -269,6 +292,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdluv2si"));
 sym___builtin_neon_vabdluv2si->kind = SK_FUNCTION;sym___builtin_neon_vabdluv2si->do_not_print = 1;sym___builtin_neon_vabdluv2si->locus = builtins_locus;
@@ -280,6 +304,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdluv4hi"));
 sym___builtin_neon_vabdluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabdluv4hi->do_not_print = 1;sym___builtin_neon_vabdluv4hi->locus = builtins_locus;
@@ -291,6 +316,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdluv8qi"));
 sym___builtin_neon_vabdluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabdluv8qi->do_not_print = 1;sym___builtin_neon_vabdluv8qi->locus = builtins_locus;
@@ -302,6 +328,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdsv16qi"));
 sym___builtin_neon_vabdsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vabdsv16qi->do_not_print = 1;sym___builtin_neon_vabdsv16qi->locus = builtins_locus;
@@ -313,6 +340,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdsv2si"));
 sym___builtin_neon_vabdsv2si->kind = SK_FUNCTION;sym___builtin_neon_vabdsv2si->do_not_print = 1;sym___builtin_neon_vabdsv2si->locus = builtins_locus;
@@ -324,6 +352,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdsv4hi"));
 sym___builtin_neon_vabdsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabdsv4hi->do_not_print = 1;sym___builtin_neon_vabdsv4hi->locus = builtins_locus;
@@ -335,6 +364,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdsv4si"));
 sym___builtin_neon_vabdsv4si->kind = SK_FUNCTION;sym___builtin_neon_vabdsv4si->do_not_print = 1;sym___builtin_neon_vabdsv4si->locus = builtins_locus;
@@ -346,6 +376,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdsv8hi"));
 sym___builtin_neon_vabdsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vabdsv8hi->do_not_print = 1;sym___builtin_neon_vabdsv8hi->locus = builtins_locus;
@@ -357,6 +388,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabdsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabdsv8qi"));
 sym___builtin_neon_vabdsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabdsv8qi->do_not_print = 1;sym___builtin_neon_vabdsv8qi->locus = builtins_locus;
@@ -368,6 +400,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabdsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabduv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabduv16qi"));
 sym___builtin_neon_vabduv16qi->kind = SK_FUNCTION;sym___builtin_neon_vabduv16qi->do_not_print = 1;sym___builtin_neon_vabduv16qi->locus = builtins_locus;
@@ -379,6 +412,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabduv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabduv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabduv2si"));
 sym___builtin_neon_vabduv2si->kind = SK_FUNCTION;sym___builtin_neon_vabduv2si->do_not_print = 1;sym___builtin_neon_vabduv2si->locus = builtins_locus;
@@ -390,6 +424,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabduv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabduv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabduv4hi"));
 sym___builtin_neon_vabduv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabduv4hi->do_not_print = 1;sym___builtin_neon_vabduv4hi->locus = builtins_locus;
@@ -401,6 +436,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabduv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabduv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabduv4si"));
 sym___builtin_neon_vabduv4si->kind = SK_FUNCTION;sym___builtin_neon_vabduv4si->do_not_print = 1;sym___builtin_neon_vabduv4si->locus = builtins_locus;
@@ -412,6 +448,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabduv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabduv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabduv8hi"));
 sym___builtin_neon_vabduv8hi->kind = SK_FUNCTION;sym___builtin_neon_vabduv8hi->do_not_print = 1;sym___builtin_neon_vabduv8hi->locus = builtins_locus;
@@ -423,6 +460,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabduv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabduv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabduv8qi"));
 sym___builtin_neon_vabduv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabduv8qi->do_not_print = 1;sym___builtin_neon_vabduv8qi->locus = builtins_locus;
@@ -434,6 +472,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabduv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv16qi"));
 sym___builtin_neon_vabsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vabsv16qi->do_not_print = 1;sym___builtin_neon_vabsv16qi->locus = builtins_locus;
@@ -444,6 +483,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv2sf"));
 sym___builtin_neon_vabsv2sf->kind = SK_FUNCTION;sym___builtin_neon_vabsv2sf->do_not_print = 1;sym___builtin_neon_vabsv2sf->locus = builtins_locus;
@@ -454,6 +494,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv2si"));
 sym___builtin_neon_vabsv2si->kind = SK_FUNCTION;sym___builtin_neon_vabsv2si->do_not_print = 1;sym___builtin_neon_vabsv2si->locus = builtins_locus;
@@ -464,6 +505,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv4hi"));
 sym___builtin_neon_vabsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vabsv4hi->do_not_print = 1;sym___builtin_neon_vabsv4hi->locus = builtins_locus;
@@ -474,6 +516,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv4sf"));
 sym___builtin_neon_vabsv4sf->kind = SK_FUNCTION;sym___builtin_neon_vabsv4sf->do_not_print = 1;sym___builtin_neon_vabsv4sf->locus = builtins_locus;
@@ -484,6 +527,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv4si"));
 sym___builtin_neon_vabsv4si->kind = SK_FUNCTION;sym___builtin_neon_vabsv4si->do_not_print = 1;sym___builtin_neon_vabsv4si->locus = builtins_locus;
@@ -494,6 +538,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv8hi"));
 sym___builtin_neon_vabsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vabsv8hi->do_not_print = 1;sym___builtin_neon_vabsv8hi->locus = builtins_locus;
@@ -504,6 +549,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vabsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vabsv8qi"));
 sym___builtin_neon_vabsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vabsv8qi->do_not_print = 1;sym___builtin_neon_vabsv8qi->locus = builtins_locus;
@@ -514,6 +560,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vabsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddhnv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddhnv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddhnv2di"));
 sym___builtin_neon_vaddhnv2di->kind = SK_FUNCTION;sym___builtin_neon_vaddhnv2di->do_not_print = 1;sym___builtin_neon_vaddhnv2di->locus = builtins_locus;
@@ -525,6 +572,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddhnv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddhnv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddhnv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddhnv4si"));
 sym___builtin_neon_vaddhnv4si->kind = SK_FUNCTION;sym___builtin_neon_vaddhnv4si->do_not_print = 1;sym___builtin_neon_vaddhnv4si->locus = builtins_locus;
@@ -536,6 +584,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddhnv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddhnv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddhnv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddhnv8hi"));
 sym___builtin_neon_vaddhnv8hi->kind = SK_FUNCTION;sym___builtin_neon_vaddhnv8hi->do_not_print = 1;sym___builtin_neon_vaddhnv8hi->locus = builtins_locus;
@@ -547,6 +596,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddhnv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddlsv2si"));
 sym___builtin_neon_vaddlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vaddlsv2si->do_not_print = 1;sym___builtin_neon_vaddlsv2si->locus = builtins_locus;
@@ -558,6 +608,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddlsv4hi"));
 sym___builtin_neon_vaddlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vaddlsv4hi->do_not_print = 1;sym___builtin_neon_vaddlsv4hi->locus = builtins_locus;
@@ -569,6 +620,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddlsv8qi"));
 sym___builtin_neon_vaddlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vaddlsv8qi->do_not_print = 1;sym___builtin_neon_vaddlsv8qi->locus = builtins_locus;
@@ -580,6 +632,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddluv2si"));
 sym___builtin_neon_vaddluv2si->kind = SK_FUNCTION;sym___builtin_neon_vaddluv2si->do_not_print = 1;sym___builtin_neon_vaddluv2si->locus = builtins_locus;
@@ -591,6 +644,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddluv4hi"));
 sym___builtin_neon_vaddluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vaddluv4hi->do_not_print = 1;sym___builtin_neon_vaddluv4hi->locus = builtins_locus;
@@ -602,6 +656,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddluv8qi"));
 sym___builtin_neon_vaddluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vaddluv8qi->do_not_print = 1;sym___builtin_neon_vaddluv8qi->locus = builtins_locus;
@@ -613,6 +668,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddv2sf"));
 sym___builtin_neon_vaddv2sf->kind = SK_FUNCTION;sym___builtin_neon_vaddv2sf->do_not_print = 1;sym___builtin_neon_vaddv2sf->locus = builtins_locus;
@@ -624,6 +680,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddv4sf"));
 sym___builtin_neon_vaddv4sf->kind = SK_FUNCTION;sym___builtin_neon_vaddv4sf->do_not_print = 1;sym___builtin_neon_vaddv4sf->locus = builtins_locus;
@@ -635,6 +692,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddwsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddwsv2si"));
 sym___builtin_neon_vaddwsv2si->kind = SK_FUNCTION;sym___builtin_neon_vaddwsv2si->do_not_print = 1;sym___builtin_neon_vaddwsv2si->locus = builtins_locus;
@@ -646,6 +704,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddwsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddwsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddwsv4hi"));
 sym___builtin_neon_vaddwsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vaddwsv4hi->do_not_print = 1;sym___builtin_neon_vaddwsv4hi->locus = builtins_locus;
@@ -657,6 +716,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddwsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddwsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddwsv8qi"));
 sym___builtin_neon_vaddwsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vaddwsv8qi->do_not_print = 1;sym___builtin_neon_vaddwsv8qi->locus = builtins_locus;
@@ -668,6 +728,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddwsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddwuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddwuv2si"));
 sym___builtin_neon_vaddwuv2si->kind = SK_FUNCTION;sym___builtin_neon_vaddwuv2si->do_not_print = 1;sym___builtin_neon_vaddwuv2si->locus = builtins_locus;
@@ -679,6 +740,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddwuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddwuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddwuv4hi"));
 sym___builtin_neon_vaddwuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vaddwuv4hi->do_not_print = 1;sym___builtin_neon_vaddwuv4hi->locus = builtins_locus;
@@ -690,6 +752,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddwuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vaddwuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vaddwuv8qi"));
 sym___builtin_neon_vaddwuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vaddwuv8qi->do_not_print = 1;sym___builtin_neon_vaddwuv8qi->locus = builtins_locus;
@@ -701,6 +764,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vaddwuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbsldi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbsldi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbsldi"));
 sym___builtin_neon_vbsldi->kind = SK_FUNCTION;sym___builtin_neon_vbsldi->do_not_print = 1;sym___builtin_neon_vbsldi->locus = builtins_locus;
@@ -713,6 +777,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbsldi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv16qi"));
 sym___builtin_neon_vbslv16qi->kind = SK_FUNCTION;sym___builtin_neon_vbslv16qi->do_not_print = 1;sym___builtin_neon_vbslv16qi->locus = builtins_locus;
@@ -725,6 +790,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv2di"));
 sym___builtin_neon_vbslv2di->kind = SK_FUNCTION;sym___builtin_neon_vbslv2di->do_not_print = 1;sym___builtin_neon_vbslv2di->locus = builtins_locus;
@@ -737,6 +803,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv2sf"));
 sym___builtin_neon_vbslv2sf->kind = SK_FUNCTION;sym___builtin_neon_vbslv2sf->do_not_print = 1;sym___builtin_neon_vbslv2sf->locus = builtins_locus;
@@ -749,6 +816,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv2si"));
 sym___builtin_neon_vbslv2si->kind = SK_FUNCTION;sym___builtin_neon_vbslv2si->do_not_print = 1;sym___builtin_neon_vbslv2si->locus = builtins_locus;
@@ -761,6 +829,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv4hi"));
 sym___builtin_neon_vbslv4hi->kind = SK_FUNCTION;sym___builtin_neon_vbslv4hi->do_not_print = 1;sym___builtin_neon_vbslv4hi->locus = builtins_locus;
@@ -773,6 +842,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv4sf"));
 sym___builtin_neon_vbslv4sf->kind = SK_FUNCTION;sym___builtin_neon_vbslv4sf->do_not_print = 1;sym___builtin_neon_vbslv4sf->locus = builtins_locus;
@@ -785,6 +855,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv4si"));
 sym___builtin_neon_vbslv4si->kind = SK_FUNCTION;sym___builtin_neon_vbslv4si->do_not_print = 1;sym___builtin_neon_vbslv4si->locus = builtins_locus;
@@ -797,6 +868,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv8hi"));
 sym___builtin_neon_vbslv8hi->kind = SK_FUNCTION;sym___builtin_neon_vbslv8hi->do_not_print = 1;sym___builtin_neon_vbslv8hi->locus = builtins_locus;
@@ -809,6 +881,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vbslv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vbslv8qi"));
 sym___builtin_neon_vbslv8qi->kind = SK_FUNCTION;sym___builtin_neon_vbslv8qi->do_not_print = 1;sym___builtin_neon_vbslv8qi->locus = builtins_locus;
@@ -821,6 +894,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vbslv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcagev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcagev2sf"));
 sym___builtin_neon_vcagev2sf->kind = SK_FUNCTION;sym___builtin_neon_vcagev2sf->do_not_print = 1;sym___builtin_neon_vcagev2sf->locus = builtins_locus;
@@ -832,6 +906,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcagev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcagev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcagev4sf"));
 sym___builtin_neon_vcagev4sf->kind = SK_FUNCTION;sym___builtin_neon_vcagev4sf->do_not_print = 1;sym___builtin_neon_vcagev4sf->locus = builtins_locus;
@@ -843,6 +918,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcagev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagtv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcagtv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcagtv2sf"));
 sym___builtin_neon_vcagtv2sf->kind = SK_FUNCTION;sym___builtin_neon_vcagtv2sf->do_not_print = 1;sym___builtin_neon_vcagtv2sf->locus = builtins_locus;
@@ -854,6 +930,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcagtv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagtv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcagtv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcagtv4sf"));
 sym___builtin_neon_vcagtv4sf->kind = SK_FUNCTION;sym___builtin_neon_vcagtv4sf->do_not_print = 1;sym___builtin_neon_vcagtv4sf->locus = builtins_locus;
@@ -865,6 +942,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcagtv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv16qi"));
 sym___builtin_neon_vceqv16qi->kind = SK_FUNCTION;sym___builtin_neon_vceqv16qi->do_not_print = 1;sym___builtin_neon_vceqv16qi->locus = builtins_locus;
@@ -876,6 +954,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv2sf"));
 sym___builtin_neon_vceqv2sf->kind = SK_FUNCTION;sym___builtin_neon_vceqv2sf->do_not_print = 1;sym___builtin_neon_vceqv2sf->locus = builtins_locus;
@@ -887,6 +966,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv2si"));
 sym___builtin_neon_vceqv2si->kind = SK_FUNCTION;sym___builtin_neon_vceqv2si->do_not_print = 1;sym___builtin_neon_vceqv2si->locus = builtins_locus;
@@ -898,6 +978,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv4hi"));
 sym___builtin_neon_vceqv4hi->kind = SK_FUNCTION;sym___builtin_neon_vceqv4hi->do_not_print = 1;sym___builtin_neon_vceqv4hi->locus = builtins_locus;
@@ -909,6 +990,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv4sf"));
 sym___builtin_neon_vceqv4sf->kind = SK_FUNCTION;sym___builtin_neon_vceqv4sf->do_not_print = 1;sym___builtin_neon_vceqv4sf->locus = builtins_locus;
@@ -920,6 +1002,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv4si"));
 sym___builtin_neon_vceqv4si->kind = SK_FUNCTION;sym___builtin_neon_vceqv4si->do_not_print = 1;sym___builtin_neon_vceqv4si->locus = builtins_locus;
@@ -931,6 +1014,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv8hi"));
 sym___builtin_neon_vceqv8hi->kind = SK_FUNCTION;sym___builtin_neon_vceqv8hi->do_not_print = 1;sym___builtin_neon_vceqv8hi->locus = builtins_locus;
@@ -942,6 +1026,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vceqv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vceqv8qi"));
 sym___builtin_neon_vceqv8qi->kind = SK_FUNCTION;sym___builtin_neon_vceqv8qi->do_not_print = 1;sym___builtin_neon_vceqv8qi->locus = builtins_locus;
@@ -953,6 +1038,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vceqv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgeuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgeuv16qi"));
 sym___builtin_neon_vcgeuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vcgeuv16qi->do_not_print = 1;sym___builtin_neon_vcgeuv16qi->locus = builtins_locus;
@@ -964,6 +1050,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgeuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgeuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgeuv2si"));
 sym___builtin_neon_vcgeuv2si->kind = SK_FUNCTION;sym___builtin_neon_vcgeuv2si->do_not_print = 1;sym___builtin_neon_vcgeuv2si->locus = builtins_locus;
@@ -975,6 +1062,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgeuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgeuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgeuv4hi"));
 sym___builtin_neon_vcgeuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vcgeuv4hi->do_not_print = 1;sym___builtin_neon_vcgeuv4hi->locus = builtins_locus;
@@ -986,6 +1074,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgeuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgeuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgeuv4si"));
 sym___builtin_neon_vcgeuv4si->kind = SK_FUNCTION;sym___builtin_neon_vcgeuv4si->do_not_print = 1;sym___builtin_neon_vcgeuv4si->locus = builtins_locus;
@@ -997,6 +1086,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgeuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgeuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgeuv8hi"));
 sym___builtin_neon_vcgeuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vcgeuv8hi->do_not_print = 1;sym___builtin_neon_vcgeuv8hi->locus = builtins_locus;
@@ -1008,6 +1098,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgeuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgeuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgeuv8qi"));
 sym___builtin_neon_vcgeuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vcgeuv8qi->do_not_print = 1;sym___builtin_neon_vcgeuv8qi->locus = builtins_locus;
@@ -1019,6 +1110,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgeuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev16qi"));
 sym___builtin_neon_vcgev16qi->kind = SK_FUNCTION;sym___builtin_neon_vcgev16qi->do_not_print = 1;sym___builtin_neon_vcgev16qi->locus = builtins_locus;
@@ -1030,6 +1122,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev2sf"));
 sym___builtin_neon_vcgev2sf->kind = SK_FUNCTION;sym___builtin_neon_vcgev2sf->do_not_print = 1;sym___builtin_neon_vcgev2sf->locus = builtins_locus;
@@ -1041,6 +1134,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev2si"));
 sym___builtin_neon_vcgev2si->kind = SK_FUNCTION;sym___builtin_neon_vcgev2si->do_not_print = 1;sym___builtin_neon_vcgev2si->locus = builtins_locus;
@@ -1052,6 +1146,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev4hi"));
 sym___builtin_neon_vcgev4hi->kind = SK_FUNCTION;sym___builtin_neon_vcgev4hi->do_not_print = 1;sym___builtin_neon_vcgev4hi->locus = builtins_locus;
@@ -1063,6 +1158,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev4sf"));
 sym___builtin_neon_vcgev4sf->kind = SK_FUNCTION;sym___builtin_neon_vcgev4sf->do_not_print = 1;sym___builtin_neon_vcgev4sf->locus = builtins_locus;
@@ -1074,6 +1170,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev4si"));
 sym___builtin_neon_vcgev4si->kind = SK_FUNCTION;sym___builtin_neon_vcgev4si->do_not_print = 1;sym___builtin_neon_vcgev4si->locus = builtins_locus;
@@ -1085,6 +1182,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev8hi"));
 sym___builtin_neon_vcgev8hi->kind = SK_FUNCTION;sym___builtin_neon_vcgev8hi->do_not_print = 1;sym___builtin_neon_vcgev8hi->locus = builtins_locus;
@@ -1096,6 +1194,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgev8qi"));
 sym___builtin_neon_vcgev8qi->kind = SK_FUNCTION;sym___builtin_neon_vcgev8qi->do_not_print = 1;sym___builtin_neon_vcgev8qi->locus = builtins_locus;
@@ -1107,6 +1206,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtuv16qi"));
 sym___builtin_neon_vcgtuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vcgtuv16qi->do_not_print = 1;sym___builtin_neon_vcgtuv16qi->locus = builtins_locus;
@@ -1118,6 +1218,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtuv2si"));
 sym___builtin_neon_vcgtuv2si->kind = SK_FUNCTION;sym___builtin_neon_vcgtuv2si->do_not_print = 1;sym___builtin_neon_vcgtuv2si->locus = builtins_locus;
@@ -1129,6 +1230,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtuv4hi"));
 sym___builtin_neon_vcgtuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vcgtuv4hi->do_not_print = 1;sym___builtin_neon_vcgtuv4hi->locus = builtins_locus;
@@ -1140,6 +1242,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtuv4si"));
 sym___builtin_neon_vcgtuv4si->kind = SK_FUNCTION;sym___builtin_neon_vcgtuv4si->do_not_print = 1;sym___builtin_neon_vcgtuv4si->locus = builtins_locus;
@@ -1151,6 +1254,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtuv8hi"));
 sym___builtin_neon_vcgtuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vcgtuv8hi->do_not_print = 1;sym___builtin_neon_vcgtuv8hi->locus = builtins_locus;
@@ -1162,6 +1266,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtuv8qi"));
 sym___builtin_neon_vcgtuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vcgtuv8qi->do_not_print = 1;sym___builtin_neon_vcgtuv8qi->locus = builtins_locus;
@@ -1173,6 +1278,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv16qi"));
 sym___builtin_neon_vcgtv16qi->kind = SK_FUNCTION;sym___builtin_neon_vcgtv16qi->do_not_print = 1;sym___builtin_neon_vcgtv16qi->locus = builtins_locus;
@@ -1184,6 +1290,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv2sf"));
 sym___builtin_neon_vcgtv2sf->kind = SK_FUNCTION;sym___builtin_neon_vcgtv2sf->do_not_print = 1;sym___builtin_neon_vcgtv2sf->locus = builtins_locus;
@@ -1195,6 +1302,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv2si"));
 sym___builtin_neon_vcgtv2si->kind = SK_FUNCTION;sym___builtin_neon_vcgtv2si->do_not_print = 1;sym___builtin_neon_vcgtv2si->locus = builtins_locus;
@@ -1206,6 +1314,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv4hi"));
 sym___builtin_neon_vcgtv4hi->kind = SK_FUNCTION;sym___builtin_neon_vcgtv4hi->do_not_print = 1;sym___builtin_neon_vcgtv4hi->locus = builtins_locus;
@@ -1217,6 +1326,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv4sf"));
 sym___builtin_neon_vcgtv4sf->kind = SK_FUNCTION;sym___builtin_neon_vcgtv4sf->do_not_print = 1;sym___builtin_neon_vcgtv4sf->locus = builtins_locus;
@@ -1228,6 +1338,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv4si"));
 sym___builtin_neon_vcgtv4si->kind = SK_FUNCTION;sym___builtin_neon_vcgtv4si->do_not_print = 1;sym___builtin_neon_vcgtv4si->locus = builtins_locus;
@@ -1239,6 +1350,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv8hi"));
 sym___builtin_neon_vcgtv8hi->kind = SK_FUNCTION;sym___builtin_neon_vcgtv8hi->do_not_print = 1;sym___builtin_neon_vcgtv8hi->locus = builtins_locus;
@@ -1250,6 +1362,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcgtv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcgtv8qi"));
 sym___builtin_neon_vcgtv8qi->kind = SK_FUNCTION;sym___builtin_neon_vcgtv8qi->do_not_print = 1;sym___builtin_neon_vcgtv8qi->locus = builtins_locus;
@@ -1261,6 +1374,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcgtv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclsv16qi"));
 sym___builtin_neon_vclsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vclsv16qi->do_not_print = 1;sym___builtin_neon_vclsv16qi->locus = builtins_locus;
@@ -1271,6 +1385,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclsv2si"));
 sym___builtin_neon_vclsv2si->kind = SK_FUNCTION;sym___builtin_neon_vclsv2si->do_not_print = 1;sym___builtin_neon_vclsv2si->locus = builtins_locus;
@@ -1281,6 +1396,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclsv4hi"));
 sym___builtin_neon_vclsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vclsv4hi->do_not_print = 1;sym___builtin_neon_vclsv4hi->locus = builtins_locus;
@@ -1291,6 +1407,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclsv4si"));
 sym___builtin_neon_vclsv4si->kind = SK_FUNCTION;sym___builtin_neon_vclsv4si->do_not_print = 1;sym___builtin_neon_vclsv4si->locus = builtins_locus;
@@ -1301,6 +1418,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclsv8hi"));
 sym___builtin_neon_vclsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vclsv8hi->do_not_print = 1;sym___builtin_neon_vclsv8hi->locus = builtins_locus;
@@ -1311,6 +1429,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclsv8qi"));
 sym___builtin_neon_vclsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vclsv8qi->do_not_print = 1;sym___builtin_neon_vclsv8qi->locus = builtins_locus;
@@ -1321,6 +1440,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclzv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclzv16qi"));
 sym___builtin_neon_vclzv16qi->kind = SK_FUNCTION;sym___builtin_neon_vclzv16qi->do_not_print = 1;sym___builtin_neon_vclzv16qi->locus = builtins_locus;
@@ -1331,6 +1451,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclzv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclzv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclzv2si"));
 sym___builtin_neon_vclzv2si->kind = SK_FUNCTION;sym___builtin_neon_vclzv2si->do_not_print = 1;sym___builtin_neon_vclzv2si->locus = builtins_locus;
@@ -1341,6 +1462,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclzv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclzv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclzv4hi"));
 sym___builtin_neon_vclzv4hi->kind = SK_FUNCTION;sym___builtin_neon_vclzv4hi->do_not_print = 1;sym___builtin_neon_vclzv4hi->locus = builtins_locus;
@@ -1351,6 +1473,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclzv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclzv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclzv4si"));
 sym___builtin_neon_vclzv4si->kind = SK_FUNCTION;sym___builtin_neon_vclzv4si->do_not_print = 1;sym___builtin_neon_vclzv4si->locus = builtins_locus;
@@ -1361,6 +1484,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclzv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclzv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclzv8hi"));
 sym___builtin_neon_vclzv8hi->kind = SK_FUNCTION;sym___builtin_neon_vclzv8hi->do_not_print = 1;sym___builtin_neon_vclzv8hi->locus = builtins_locus;
@@ -1371,6 +1495,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclzv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vclzv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vclzv8qi"));
 sym___builtin_neon_vclzv8qi->kind = SK_FUNCTION;sym___builtin_neon_vclzv8qi->do_not_print = 1;sym___builtin_neon_vclzv8qi->locus = builtins_locus;
@@ -1381,6 +1506,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vclzv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcntv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcntv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcntv16qi"));
 sym___builtin_neon_vcntv16qi->kind = SK_FUNCTION;sym___builtin_neon_vcntv16qi->do_not_print = 1;sym___builtin_neon_vcntv16qi->locus = builtins_locus;
@@ -1391,6 +1517,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcntv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcntv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcntv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcntv8qi"));
 sym___builtin_neon_vcntv8qi->kind = SK_FUNCTION;sym___builtin_neon_vcntv8qi->do_not_print = 1;sym___builtin_neon_vcntv8qi->locus = builtins_locus;
@@ -1401,6 +1528,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcntv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcombinedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcombinedi"));
 sym___builtin_neon_vcombinedi->kind = SK_FUNCTION;sym___builtin_neon_vcombinedi->do_not_print = 1;sym___builtin_neon_vcombinedi->locus = builtins_locus;
@@ -1412,6 +1540,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcombinedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcombinev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcombinev2sf"));
 sym___builtin_neon_vcombinev2sf->kind = SK_FUNCTION;sym___builtin_neon_vcombinev2sf->do_not_print = 1;sym___builtin_neon_vcombinev2sf->locus = builtins_locus;
@@ -1423,6 +1552,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcombinev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcombinev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcombinev2si"));
 sym___builtin_neon_vcombinev2si->kind = SK_FUNCTION;sym___builtin_neon_vcombinev2si->do_not_print = 1;sym___builtin_neon_vcombinev2si->locus = builtins_locus;
@@ -1434,6 +1564,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcombinev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcombinev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcombinev4hi"));
 sym___builtin_neon_vcombinev4hi->kind = SK_FUNCTION;sym___builtin_neon_vcombinev4hi->do_not_print = 1;sym___builtin_neon_vcombinev4hi->locus = builtins_locus;
@@ -1445,6 +1576,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcombinev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcombinev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcombinev8qi"));
 sym___builtin_neon_vcombinev8qi->kind = SK_FUNCTION;sym___builtin_neon_vcombinev8qi->do_not_print = 1;sym___builtin_neon_vcombinev8qi->locus = builtins_locus;
@@ -1456,6 +1588,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcombinev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcreatedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcreatedi"));
 sym___builtin_neon_vcreatedi->kind = SK_FUNCTION;sym___builtin_neon_vcreatedi->do_not_print = 1;sym___builtin_neon_vcreatedi->locus = builtins_locus;
@@ -1466,6 +1599,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcreatedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcreatev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcreatev2sf"));
 sym___builtin_neon_vcreatev2sf->kind = SK_FUNCTION;sym___builtin_neon_vcreatev2sf->do_not_print = 1;sym___builtin_neon_vcreatev2sf->locus = builtins_locus;
@@ -1476,6 +1610,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcreatev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcreatev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcreatev2si"));
 sym___builtin_neon_vcreatev2si->kind = SK_FUNCTION;sym___builtin_neon_vcreatev2si->do_not_print = 1;sym___builtin_neon_vcreatev2si->locus = builtins_locus;
@@ -1486,6 +1621,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcreatev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcreatev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcreatev4hi"));
 sym___builtin_neon_vcreatev4hi->kind = SK_FUNCTION;sym___builtin_neon_vcreatev4hi->do_not_print = 1;sym___builtin_neon_vcreatev4hi->locus = builtins_locus;
@@ -1496,6 +1632,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcreatev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcreatev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcreatev8qi"));
 sym___builtin_neon_vcreatev8qi->kind = SK_FUNCTION;sym___builtin_neon_vcreatev8qi->do_not_print = 1;sym___builtin_neon_vcreatev8qi->locus = builtins_locus;
@@ -1506,6 +1643,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcreatev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvts_nv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvts_nv2sf"));
 sym___builtin_neon_vcvts_nv2sf->kind = SK_FUNCTION;sym___builtin_neon_vcvts_nv2sf->do_not_print = 1;sym___builtin_neon_vcvts_nv2sf->locus = builtins_locus;
@@ -1517,6 +1655,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvts_nv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvts_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvts_nv2si"));
 sym___builtin_neon_vcvts_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vcvts_nv2si->do_not_print = 1;sym___builtin_neon_vcvts_nv2si->locus = builtins_locus;
@@ -1528,6 +1667,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvts_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvts_nv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvts_nv4sf"));
 sym___builtin_neon_vcvts_nv4sf->kind = SK_FUNCTION;sym___builtin_neon_vcvts_nv4sf->do_not_print = 1;sym___builtin_neon_vcvts_nv4sf->locus = builtins_locus;
@@ -1539,6 +1679,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvts_nv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvts_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvts_nv4si"));
 sym___builtin_neon_vcvts_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vcvts_nv4si->do_not_print = 1;sym___builtin_neon_vcvts_nv4si->locus = builtins_locus;
@@ -1550,6 +1691,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvts_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtsv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtsv2sf"));
 sym___builtin_neon_vcvtsv2sf->kind = SK_FUNCTION;sym___builtin_neon_vcvtsv2sf->do_not_print = 1;sym___builtin_neon_vcvtsv2sf->locus = builtins_locus;
@@ -1560,6 +1702,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtsv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtsv2si"));
 sym___builtin_neon_vcvtsv2si->kind = SK_FUNCTION;sym___builtin_neon_vcvtsv2si->do_not_print = 1;sym___builtin_neon_vcvtsv2si->locus = builtins_locus;
@@ -1570,6 +1713,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtsv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtsv4sf"));
 sym___builtin_neon_vcvtsv4sf->kind = SK_FUNCTION;sym___builtin_neon_vcvtsv4sf->do_not_print = 1;sym___builtin_neon_vcvtsv4sf->locus = builtins_locus;
@@ -1580,6 +1724,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtsv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtsv4si"));
 sym___builtin_neon_vcvtsv4si->kind = SK_FUNCTION;sym___builtin_neon_vcvtsv4si->do_not_print = 1;sym___builtin_neon_vcvtsv4si->locus = builtins_locus;
@@ -1590,6 +1735,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtu_nv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtu_nv2sf"));
 sym___builtin_neon_vcvtu_nv2sf->kind = SK_FUNCTION;sym___builtin_neon_vcvtu_nv2sf->do_not_print = 1;sym___builtin_neon_vcvtu_nv2sf->locus = builtins_locus;
@@ -1601,6 +1747,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtu_nv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtu_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtu_nv2si"));
 sym___builtin_neon_vcvtu_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vcvtu_nv2si->do_not_print = 1;sym___builtin_neon_vcvtu_nv2si->locus = builtins_locus;
@@ -1612,6 +1759,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtu_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtu_nv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtu_nv4sf"));
 sym___builtin_neon_vcvtu_nv4sf->kind = SK_FUNCTION;sym___builtin_neon_vcvtu_nv4sf->do_not_print = 1;sym___builtin_neon_vcvtu_nv4sf->locus = builtins_locus;
@@ -1623,6 +1771,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtu_nv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtu_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtu_nv4si"));
 sym___builtin_neon_vcvtu_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vcvtu_nv4si->do_not_print = 1;sym___builtin_neon_vcvtu_nv4si->locus = builtins_locus;
@@ -1634,6 +1783,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtu_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtuv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtuv2sf"));
 sym___builtin_neon_vcvtuv2sf->kind = SK_FUNCTION;sym___builtin_neon_vcvtuv2sf->do_not_print = 1;sym___builtin_neon_vcvtuv2sf->locus = builtins_locus;
@@ -1644,6 +1794,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtuv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtuv2si"));
 sym___builtin_neon_vcvtuv2si->kind = SK_FUNCTION;sym___builtin_neon_vcvtuv2si->do_not_print = 1;sym___builtin_neon_vcvtuv2si->locus = builtins_locus;
@@ -1654,6 +1805,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtuv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtuv4sf"));
 sym___builtin_neon_vcvtuv4sf->kind = SK_FUNCTION;sym___builtin_neon_vcvtuv4sf->do_not_print = 1;sym___builtin_neon_vcvtuv4sf->locus = builtins_locus;
@@ -1664,6 +1816,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtuv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vcvtuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vcvtuv4si"));
 sym___builtin_neon_vcvtuv4si->kind = SK_FUNCTION;sym___builtin_neon_vcvtuv4si->do_not_print = 1;sym___builtin_neon_vcvtuv4si->locus = builtins_locus;
@@ -1674,6 +1827,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vcvtuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanedi"));
 sym___builtin_neon_vdup_lanedi->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanedi->do_not_print = 1;sym___builtin_neon_vdup_lanedi->locus = builtins_locus;
@@ -1685,6 +1839,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev16qi"));
 sym___builtin_neon_vdup_lanev16qi->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev16qi->do_not_print = 1;sym___builtin_neon_vdup_lanev16qi->locus = builtins_locus;
@@ -1696,6 +1851,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev2di"));
 sym___builtin_neon_vdup_lanev2di->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev2di->do_not_print = 1;sym___builtin_neon_vdup_lanev2di->locus = builtins_locus;
@@ -1707,6 +1863,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev2sf"));
 sym___builtin_neon_vdup_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev2sf->do_not_print = 1;sym___builtin_neon_vdup_lanev2sf->locus = builtins_locus;
@@ -1718,6 +1875,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev2si"));
 sym___builtin_neon_vdup_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev2si->do_not_print = 1;sym___builtin_neon_vdup_lanev2si->locus = builtins_locus;
@@ -1729,6 +1887,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev4hi"));
 sym___builtin_neon_vdup_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev4hi->do_not_print = 1;sym___builtin_neon_vdup_lanev4hi->locus = builtins_locus;
@@ -1740,6 +1899,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev4sf"));
 sym___builtin_neon_vdup_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev4sf->do_not_print = 1;sym___builtin_neon_vdup_lanev4sf->locus = builtins_locus;
@@ -1751,6 +1911,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev4si"));
 sym___builtin_neon_vdup_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev4si->do_not_print = 1;sym___builtin_neon_vdup_lanev4si->locus = builtins_locus;
@@ -1762,6 +1923,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev8hi"));
 sym___builtin_neon_vdup_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev8hi->do_not_print = 1;sym___builtin_neon_vdup_lanev8hi->locus = builtins_locus;
@@ -1773,6 +1935,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_lanev8qi"));
 sym___builtin_neon_vdup_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vdup_lanev8qi->do_not_print = 1;sym___builtin_neon_vdup_lanev8qi->locus = builtins_locus;
@@ -1784,6 +1947,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_ndi"));
 sym___builtin_neon_vdup_ndi->kind = SK_FUNCTION;sym___builtin_neon_vdup_ndi->do_not_print = 1;sym___builtin_neon_vdup_ndi->locus = builtins_locus;
@@ -1794,6 +1958,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv16qi"));
 sym___builtin_neon_vdup_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv16qi->do_not_print = 1;sym___builtin_neon_vdup_nv16qi->locus = builtins_locus;
@@ -1804,6 +1969,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv2di"));
 sym___builtin_neon_vdup_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv2di->do_not_print = 1;sym___builtin_neon_vdup_nv2di->locus = builtins_locus;
@@ -1814,6 +1980,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv2sf"));
 sym___builtin_neon_vdup_nv2sf->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv2sf->do_not_print = 1;sym___builtin_neon_vdup_nv2sf->locus = builtins_locus;
@@ -1824,6 +1991,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv2si"));
 sym___builtin_neon_vdup_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv2si->do_not_print = 1;sym___builtin_neon_vdup_nv2si->locus = builtins_locus;
@@ -1834,6 +2002,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv4hi"));
 sym___builtin_neon_vdup_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv4hi->do_not_print = 1;sym___builtin_neon_vdup_nv4hi->locus = builtins_locus;
@@ -1844,6 +2013,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv4sf"));
 sym___builtin_neon_vdup_nv4sf->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv4sf->do_not_print = 1;sym___builtin_neon_vdup_nv4sf->locus = builtins_locus;
@@ -1854,6 +2024,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv4si"));
 sym___builtin_neon_vdup_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv4si->do_not_print = 1;sym___builtin_neon_vdup_nv4si->locus = builtins_locus;
@@ -1864,6 +2035,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv8hi"));
 sym___builtin_neon_vdup_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv8hi->do_not_print = 1;sym___builtin_neon_vdup_nv8hi->locus = builtins_locus;
@@ -1874,6 +2046,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vdup_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vdup_nv8qi"));
 sym___builtin_neon_vdup_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vdup_nv8qi->do_not_print = 1;sym___builtin_neon_vdup_nv8qi->locus = builtins_locus;
@@ -1884,6 +2057,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vdup_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextdi"));
 sym___builtin_neon_vextdi->kind = SK_FUNCTION;sym___builtin_neon_vextdi->do_not_print = 1;sym___builtin_neon_vextdi->locus = builtins_locus;
@@ -1896,6 +2070,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv16qi"));
 sym___builtin_neon_vextv16qi->kind = SK_FUNCTION;sym___builtin_neon_vextv16qi->do_not_print = 1;sym___builtin_neon_vextv16qi->locus = builtins_locus;
@@ -1908,6 +2083,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv2di"));
 sym___builtin_neon_vextv2di->kind = SK_FUNCTION;sym___builtin_neon_vextv2di->do_not_print = 1;sym___builtin_neon_vextv2di->locus = builtins_locus;
@@ -1920,6 +2096,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv2sf"));
 sym___builtin_neon_vextv2sf->kind = SK_FUNCTION;sym___builtin_neon_vextv2sf->do_not_print = 1;sym___builtin_neon_vextv2sf->locus = builtins_locus;
@@ -1932,6 +2109,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv2si"));
 sym___builtin_neon_vextv2si->kind = SK_FUNCTION;sym___builtin_neon_vextv2si->do_not_print = 1;sym___builtin_neon_vextv2si->locus = builtins_locus;
@@ -1944,6 +2122,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv4hi"));
 sym___builtin_neon_vextv4hi->kind = SK_FUNCTION;sym___builtin_neon_vextv4hi->do_not_print = 1;sym___builtin_neon_vextv4hi->locus = builtins_locus;
@@ -1956,6 +2135,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv4sf"));
 sym___builtin_neon_vextv4sf->kind = SK_FUNCTION;sym___builtin_neon_vextv4sf->do_not_print = 1;sym___builtin_neon_vextv4sf->locus = builtins_locus;
@@ -1968,6 +2148,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv4si"));
 sym___builtin_neon_vextv4si->kind = SK_FUNCTION;sym___builtin_neon_vextv4si->do_not_print = 1;sym___builtin_neon_vextv4si->locus = builtins_locus;
@@ -1980,6 +2161,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv8hi"));
 sym___builtin_neon_vextv8hi->kind = SK_FUNCTION;sym___builtin_neon_vextv8hi->do_not_print = 1;sym___builtin_neon_vextv8hi->locus = builtins_locus;
@@ -1992,6 +2174,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vextv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vextv8qi"));
 sym___builtin_neon_vextv8qi->kind = SK_FUNCTION;sym___builtin_neon_vextv8qi->do_not_print = 1;sym___builtin_neon_vextv8qi->locus = builtins_locus;
@@ -2004,6 +2187,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vextv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_highv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_highv16qi"));
 sym___builtin_neon_vget_highv16qi->kind = SK_FUNCTION;sym___builtin_neon_vget_highv16qi->do_not_print = 1;sym___builtin_neon_vget_highv16qi->locus = builtins_locus;
@@ -2014,6 +2198,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_highv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_highv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_highv2di"));
 sym___builtin_neon_vget_highv2di->kind = SK_FUNCTION;sym___builtin_neon_vget_highv2di->do_not_print = 1;sym___builtin_neon_vget_highv2di->locus = builtins_locus;
@@ -2024,6 +2209,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_highv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_highv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_highv4sf"));
 sym___builtin_neon_vget_highv4sf->kind = SK_FUNCTION;sym___builtin_neon_vget_highv4sf->do_not_print = 1;sym___builtin_neon_vget_highv4sf->locus = builtins_locus;
@@ -2034,6 +2220,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_highv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_highv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_highv4si"));
 sym___builtin_neon_vget_highv4si->kind = SK_FUNCTION;sym___builtin_neon_vget_highv4si->do_not_print = 1;sym___builtin_neon_vget_highv4si->locus = builtins_locus;
@@ -2044,6 +2231,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_highv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_highv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_highv8hi"));
 sym___builtin_neon_vget_highv8hi->kind = SK_FUNCTION;sym___builtin_neon_vget_highv8hi->do_not_print = 1;sym___builtin_neon_vget_highv8hi->locus = builtins_locus;
@@ -2054,6 +2242,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_highv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanedi"));
 sym___builtin_neon_vget_lanedi->kind = SK_FUNCTION;sym___builtin_neon_vget_lanedi->do_not_print = 1;sym___builtin_neon_vget_lanedi->locus = builtins_locus;
@@ -2065,6 +2254,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_laneuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_laneuv16qi"));
 sym___builtin_neon_vget_laneuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vget_laneuv16qi->do_not_print = 1;sym___builtin_neon_vget_laneuv16qi->locus = builtins_locus;
@@ -2076,6 +2266,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_laneuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_laneuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_laneuv2si"));
 sym___builtin_neon_vget_laneuv2si->kind = SK_FUNCTION;sym___builtin_neon_vget_laneuv2si->do_not_print = 1;sym___builtin_neon_vget_laneuv2si->locus = builtins_locus;
@@ -2087,6 +2278,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_laneuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_laneuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_laneuv4hi"));
 sym___builtin_neon_vget_laneuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vget_laneuv4hi->do_not_print = 1;sym___builtin_neon_vget_laneuv4hi->locus = builtins_locus;
@@ -2098,6 +2290,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_laneuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_laneuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_laneuv4si"));
 sym___builtin_neon_vget_laneuv4si->kind = SK_FUNCTION;sym___builtin_neon_vget_laneuv4si->do_not_print = 1;sym___builtin_neon_vget_laneuv4si->locus = builtins_locus;
@@ -2109,6 +2302,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_laneuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_laneuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_laneuv8hi"));
 sym___builtin_neon_vget_laneuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vget_laneuv8hi->do_not_print = 1;sym___builtin_neon_vget_laneuv8hi->locus = builtins_locus;
@@ -2120,6 +2314,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_laneuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_laneuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_laneuv8qi"));
 sym___builtin_neon_vget_laneuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vget_laneuv8qi->do_not_print = 1;sym___builtin_neon_vget_laneuv8qi->locus = builtins_locus;
@@ -2131,6 +2326,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_laneuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev16qi"));
 sym___builtin_neon_vget_lanev16qi->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev16qi->do_not_print = 1;sym___builtin_neon_vget_lanev16qi->locus = builtins_locus;
@@ -2142,6 +2338,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev2di"));
 sym___builtin_neon_vget_lanev2di->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev2di->do_not_print = 1;sym___builtin_neon_vget_lanev2di->locus = builtins_locus;
@@ -2153,6 +2350,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev2sf"));
 sym___builtin_neon_vget_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev2sf->do_not_print = 1;sym___builtin_neon_vget_lanev2sf->locus = builtins_locus;
@@ -2164,6 +2362,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev2si"));
 sym___builtin_neon_vget_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev2si->do_not_print = 1;sym___builtin_neon_vget_lanev2si->locus = builtins_locus;
@@ -2175,6 +2374,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev4hi"));
 sym___builtin_neon_vget_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev4hi->do_not_print = 1;sym___builtin_neon_vget_lanev4hi->locus = builtins_locus;
@@ -2186,6 +2386,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev4sf"));
 sym___builtin_neon_vget_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev4sf->do_not_print = 1;sym___builtin_neon_vget_lanev4sf->locus = builtins_locus;
@@ -2197,6 +2398,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev4si"));
 sym___builtin_neon_vget_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev4si->do_not_print = 1;sym___builtin_neon_vget_lanev4si->locus = builtins_locus;
@@ -2208,6 +2410,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev8hi"));
 sym___builtin_neon_vget_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev8hi->do_not_print = 1;sym___builtin_neon_vget_lanev8hi->locus = builtins_locus;
@@ -2219,6 +2422,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lanev8qi"));
 sym___builtin_neon_vget_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vget_lanev8qi->do_not_print = 1;sym___builtin_neon_vget_lanev8qi->locus = builtins_locus;
@@ -2230,6 +2434,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lowv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lowv16qi"));
 sym___builtin_neon_vget_lowv16qi->kind = SK_FUNCTION;sym___builtin_neon_vget_lowv16qi->do_not_print = 1;sym___builtin_neon_vget_lowv16qi->locus = builtins_locus;
@@ -2240,6 +2445,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lowv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lowv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lowv2di"));
 sym___builtin_neon_vget_lowv2di->kind = SK_FUNCTION;sym___builtin_neon_vget_lowv2di->do_not_print = 1;sym___builtin_neon_vget_lowv2di->locus = builtins_locus;
@@ -2250,6 +2456,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lowv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lowv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lowv4sf"));
 sym___builtin_neon_vget_lowv4sf->kind = SK_FUNCTION;sym___builtin_neon_vget_lowv4sf->do_not_print = 1;sym___builtin_neon_vget_lowv4sf->locus = builtins_locus;
@@ -2260,6 +2467,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lowv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lowv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lowv4si"));
 sym___builtin_neon_vget_lowv4si->kind = SK_FUNCTION;sym___builtin_neon_vget_lowv4si->do_not_print = 1;sym___builtin_neon_vget_lowv4si->locus = builtins_locus;
@@ -2270,6 +2478,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lowv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vget_lowv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vget_lowv8hi"));
 sym___builtin_neon_vget_lowv8hi->kind = SK_FUNCTION;sym___builtin_neon_vget_lowv8hi->do_not_print = 1;sym___builtin_neon_vget_lowv8hi->locus = builtins_locus;
@@ -2280,6 +2489,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vget_lowv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhaddsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhaddsv16qi"));
 sym___builtin_neon_vhaddsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vhaddsv16qi->do_not_print = 1;sym___builtin_neon_vhaddsv16qi->locus = builtins_locus;
@@ -2291,6 +2501,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhaddsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhaddsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhaddsv2si"));
 sym___builtin_neon_vhaddsv2si->kind = SK_FUNCTION;sym___builtin_neon_vhaddsv2si->do_not_print = 1;sym___builtin_neon_vhaddsv2si->locus = builtins_locus;
@@ -2302,6 +2513,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhaddsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhaddsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhaddsv4hi"));
 sym___builtin_neon_vhaddsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vhaddsv4hi->do_not_print = 1;sym___builtin_neon_vhaddsv4hi->locus = builtins_locus;
@@ -2313,6 +2525,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhaddsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhaddsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhaddsv4si"));
 sym___builtin_neon_vhaddsv4si->kind = SK_FUNCTION;sym___builtin_neon_vhaddsv4si->do_not_print = 1;sym___builtin_neon_vhaddsv4si->locus = builtins_locus;
@@ -2324,6 +2537,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhaddsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhaddsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhaddsv8hi"));
 sym___builtin_neon_vhaddsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vhaddsv8hi->do_not_print = 1;sym___builtin_neon_vhaddsv8hi->locus = builtins_locus;
@@ -2335,6 +2549,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhaddsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhaddsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhaddsv8qi"));
 sym___builtin_neon_vhaddsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vhaddsv8qi->do_not_print = 1;sym___builtin_neon_vhaddsv8qi->locus = builtins_locus;
@@ -2346,6 +2561,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhaddsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhadduv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhadduv16qi"));
 sym___builtin_neon_vhadduv16qi->kind = SK_FUNCTION;sym___builtin_neon_vhadduv16qi->do_not_print = 1;sym___builtin_neon_vhadduv16qi->locus = builtins_locus;
@@ -2357,6 +2573,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhadduv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhadduv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhadduv2si"));
 sym___builtin_neon_vhadduv2si->kind = SK_FUNCTION;sym___builtin_neon_vhadduv2si->do_not_print = 1;sym___builtin_neon_vhadduv2si->locus = builtins_locus;
@@ -2368,6 +2585,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhadduv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhadduv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhadduv4hi"));
 sym___builtin_neon_vhadduv4hi->kind = SK_FUNCTION;sym___builtin_neon_vhadduv4hi->do_not_print = 1;sym___builtin_neon_vhadduv4hi->locus = builtins_locus;
@@ -2379,6 +2597,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhadduv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhadduv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhadduv4si"));
 sym___builtin_neon_vhadduv4si->kind = SK_FUNCTION;sym___builtin_neon_vhadduv4si->do_not_print = 1;sym___builtin_neon_vhadduv4si->locus = builtins_locus;
@@ -2390,6 +2609,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhadduv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhadduv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhadduv8hi"));
 sym___builtin_neon_vhadduv8hi->kind = SK_FUNCTION;sym___builtin_neon_vhadduv8hi->do_not_print = 1;sym___builtin_neon_vhadduv8hi->locus = builtins_locus;
@@ -2401,6 +2621,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhadduv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhadduv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhadduv8qi"));
 sym___builtin_neon_vhadduv8qi->kind = SK_FUNCTION;sym___builtin_neon_vhadduv8qi->do_not_print = 1;sym___builtin_neon_vhadduv8qi->locus = builtins_locus;
@@ -2412,6 +2633,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhadduv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubsv16qi"));
 sym___builtin_neon_vhsubsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vhsubsv16qi->do_not_print = 1;sym___builtin_neon_vhsubsv16qi->locus = builtins_locus;
@@ -2423,6 +2645,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubsv2si"));
 sym___builtin_neon_vhsubsv2si->kind = SK_FUNCTION;sym___builtin_neon_vhsubsv2si->do_not_print = 1;sym___builtin_neon_vhsubsv2si->locus = builtins_locus;
@@ -2434,6 +2657,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubsv4hi"));
 sym___builtin_neon_vhsubsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vhsubsv4hi->do_not_print = 1;sym___builtin_neon_vhsubsv4hi->locus = builtins_locus;
@@ -2445,6 +2669,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubsv4si"));
 sym___builtin_neon_vhsubsv4si->kind = SK_FUNCTION;sym___builtin_neon_vhsubsv4si->do_not_print = 1;sym___builtin_neon_vhsubsv4si->locus = builtins_locus;
@@ -2456,6 +2681,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubsv8hi"));
 sym___builtin_neon_vhsubsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vhsubsv8hi->do_not_print = 1;sym___builtin_neon_vhsubsv8hi->locus = builtins_locus;
@@ -2467,6 +2693,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubsv8qi"));
 sym___builtin_neon_vhsubsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vhsubsv8qi->do_not_print = 1;sym___builtin_neon_vhsubsv8qi->locus = builtins_locus;
@@ -2478,6 +2705,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubuv16qi"));
 sym___builtin_neon_vhsubuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vhsubuv16qi->do_not_print = 1;sym___builtin_neon_vhsubuv16qi->locus = builtins_locus;
@@ -2489,6 +2717,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubuv2si"));
 sym___builtin_neon_vhsubuv2si->kind = SK_FUNCTION;sym___builtin_neon_vhsubuv2si->do_not_print = 1;sym___builtin_neon_vhsubuv2si->locus = builtins_locus;
@@ -2500,6 +2729,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubuv4hi"));
 sym___builtin_neon_vhsubuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vhsubuv4hi->do_not_print = 1;sym___builtin_neon_vhsubuv4hi->locus = builtins_locus;
@@ -2511,6 +2741,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubuv4si"));
 sym___builtin_neon_vhsubuv4si->kind = SK_FUNCTION;sym___builtin_neon_vhsubuv4si->do_not_print = 1;sym___builtin_neon_vhsubuv4si->locus = builtins_locus;
@@ -2522,6 +2753,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubuv8hi"));
 sym___builtin_neon_vhsubuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vhsubuv8hi->do_not_print = 1;sym___builtin_neon_vhsubuv8hi->locus = builtins_locus;
@@ -2533,6 +2765,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vhsubuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vhsubuv8qi"));
 sym___builtin_neon_vhsubuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vhsubuv8qi->do_not_print = 1;sym___builtin_neon_vhsubuv8qi->locus = builtins_locus;
@@ -2544,6 +2777,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vhsubuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1di"));
 sym___builtin_neon_vld1di->kind = SK_FUNCTION;sym___builtin_neon_vld1di->do_not_print = 1;sym___builtin_neon_vld1di->locus = builtins_locus;
@@ -2554,6 +2788,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupdi"));
 sym___builtin_neon_vld1_dupdi->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupdi->do_not_print = 1;sym___builtin_neon_vld1_dupdi->locus = builtins_locus;
@@ -2564,6 +2799,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv16qi"));
 sym___builtin_neon_vld1_dupv16qi->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv16qi->do_not_print = 1;sym___builtin_neon_vld1_dupv16qi->locus = builtins_locus;
@@ -2574,6 +2810,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv2di"));
 sym___builtin_neon_vld1_dupv2di->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv2di->do_not_print = 1;sym___builtin_neon_vld1_dupv2di->locus = builtins_locus;
@@ -2584,6 +2821,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv2sf"));
 sym___builtin_neon_vld1_dupv2sf->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv2sf->do_not_print = 1;sym___builtin_neon_vld1_dupv2sf->locus = builtins_locus;
@@ -2594,6 +2832,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv2si"));
 sym___builtin_neon_vld1_dupv2si->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv2si->do_not_print = 1;sym___builtin_neon_vld1_dupv2si->locus = builtins_locus;
@@ -2604,6 +2843,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv4hi"));
 sym___builtin_neon_vld1_dupv4hi->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv4hi->do_not_print = 1;sym___builtin_neon_vld1_dupv4hi->locus = builtins_locus;
@@ -2614,6 +2854,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv4sf"));
 sym___builtin_neon_vld1_dupv4sf->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv4sf->do_not_print = 1;sym___builtin_neon_vld1_dupv4sf->locus = builtins_locus;
@@ -2624,6 +2865,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv4si"));
 sym___builtin_neon_vld1_dupv4si->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv4si->do_not_print = 1;sym___builtin_neon_vld1_dupv4si->locus = builtins_locus;
@@ -2634,6 +2876,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv8hi"));
 sym___builtin_neon_vld1_dupv8hi->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv8hi->do_not_print = 1;sym___builtin_neon_vld1_dupv8hi->locus = builtins_locus;
@@ -2644,6 +2887,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_dupv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_dupv8qi"));
 sym___builtin_neon_vld1_dupv8qi->kind = SK_FUNCTION;sym___builtin_neon_vld1_dupv8qi->do_not_print = 1;sym___builtin_neon_vld1_dupv8qi->locus = builtins_locus;
@@ -2654,6 +2898,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_dupv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanedi"));
 sym___builtin_neon_vld1_lanedi->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanedi->do_not_print = 1;sym___builtin_neon_vld1_lanedi->locus = builtins_locus;
@@ -2666,6 +2911,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev16qi"));
 sym___builtin_neon_vld1_lanev16qi->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev16qi->do_not_print = 1;sym___builtin_neon_vld1_lanev16qi->locus = builtins_locus;
@@ -2678,6 +2924,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev2di"));
 sym___builtin_neon_vld1_lanev2di->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev2di->do_not_print = 1;sym___builtin_neon_vld1_lanev2di->locus = builtins_locus;
@@ -2690,6 +2937,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev2sf"));
 sym___builtin_neon_vld1_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev2sf->do_not_print = 1;sym___builtin_neon_vld1_lanev2sf->locus = builtins_locus;
@@ -2702,6 +2950,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev2si"));
 sym___builtin_neon_vld1_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev2si->do_not_print = 1;sym___builtin_neon_vld1_lanev2si->locus = builtins_locus;
@@ -2714,6 +2963,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev4hi"));
 sym___builtin_neon_vld1_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev4hi->do_not_print = 1;sym___builtin_neon_vld1_lanev4hi->locus = builtins_locus;
@@ -2726,6 +2976,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev4sf"));
 sym___builtin_neon_vld1_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev4sf->do_not_print = 1;sym___builtin_neon_vld1_lanev4sf->locus = builtins_locus;
@@ -2738,6 +2989,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev4si"));
 sym___builtin_neon_vld1_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev4si->do_not_print = 1;sym___builtin_neon_vld1_lanev4si->locus = builtins_locus;
@@ -2750,6 +3002,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev8hi"));
 sym___builtin_neon_vld1_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev8hi->do_not_print = 1;sym___builtin_neon_vld1_lanev8hi->locus = builtins_locus;
@@ -2762,6 +3015,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1_lanev8qi"));
 sym___builtin_neon_vld1_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vld1_lanev8qi->do_not_print = 1;sym___builtin_neon_vld1_lanev8qi->locus = builtins_locus;
@@ -2774,6 +3028,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v16qi"));
 sym___builtin_neon_vld1v16qi->kind = SK_FUNCTION;sym___builtin_neon_vld1v16qi->do_not_print = 1;sym___builtin_neon_vld1v16qi->locus = builtins_locus;
@@ -2784,6 +3039,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v2di"));
 sym___builtin_neon_vld1v2di->kind = SK_FUNCTION;sym___builtin_neon_vld1v2di->do_not_print = 1;sym___builtin_neon_vld1v2di->locus = builtins_locus;
@@ -2794,6 +3050,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v2sf"));
 sym___builtin_neon_vld1v2sf->kind = SK_FUNCTION;sym___builtin_neon_vld1v2sf->do_not_print = 1;sym___builtin_neon_vld1v2sf->locus = builtins_locus;
@@ -2804,6 +3061,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v2si"));
 sym___builtin_neon_vld1v2si->kind = SK_FUNCTION;sym___builtin_neon_vld1v2si->do_not_print = 1;sym___builtin_neon_vld1v2si->locus = builtins_locus;
@@ -2814,6 +3072,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v4hi"));
 sym___builtin_neon_vld1v4hi->kind = SK_FUNCTION;sym___builtin_neon_vld1v4hi->do_not_print = 1;sym___builtin_neon_vld1v4hi->locus = builtins_locus;
@@ -2824,6 +3083,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v4sf"));
 sym___builtin_neon_vld1v4sf->kind = SK_FUNCTION;sym___builtin_neon_vld1v4sf->do_not_print = 1;sym___builtin_neon_vld1v4sf->locus = builtins_locus;
@@ -2834,6 +3094,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v4si"));
 sym___builtin_neon_vld1v4si->kind = SK_FUNCTION;sym___builtin_neon_vld1v4si->do_not_print = 1;sym___builtin_neon_vld1v4si->locus = builtins_locus;
@@ -2844,6 +3105,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v8hi"));
 sym___builtin_neon_vld1v8hi->kind = SK_FUNCTION;sym___builtin_neon_vld1v8hi->do_not_print = 1;sym___builtin_neon_vld1v8hi->locus = builtins_locus;
@@ -2854,6 +3116,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld1v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld1v8qi"));
 sym___builtin_neon_vld1v8qi->kind = SK_FUNCTION;sym___builtin_neon_vld1v8qi->do_not_print = 1;sym___builtin_neon_vld1v8qi->locus = builtins_locus;
@@ -2864,6 +3127,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld1v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2di"));
 sym___builtin_neon_vld2di->kind = SK_FUNCTION;sym___builtin_neon_vld2di->do_not_print = 1;sym___builtin_neon_vld2di->locus = builtins_locus;
@@ -2874,6 +3138,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_dupdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_dupdi"));
 sym___builtin_neon_vld2_dupdi->kind = SK_FUNCTION;sym___builtin_neon_vld2_dupdi->do_not_print = 1;sym___builtin_neon_vld2_dupdi->locus = builtins_locus;
@@ -2884,6 +3149,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_dupdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_dupv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_dupv2sf"));
 sym___builtin_neon_vld2_dupv2sf->kind = SK_FUNCTION;sym___builtin_neon_vld2_dupv2sf->do_not_print = 1;sym___builtin_neon_vld2_dupv2sf->locus = builtins_locus;
@@ -2894,6 +3160,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_dupv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_dupv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_dupv2si"));
 sym___builtin_neon_vld2_dupv2si->kind = SK_FUNCTION;sym___builtin_neon_vld2_dupv2si->do_not_print = 1;sym___builtin_neon_vld2_dupv2si->locus = builtins_locus;
@@ -2904,6 +3171,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_dupv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_dupv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_dupv4hi"));
 sym___builtin_neon_vld2_dupv4hi->kind = SK_FUNCTION;sym___builtin_neon_vld2_dupv4hi->do_not_print = 1;sym___builtin_neon_vld2_dupv4hi->locus = builtins_locus;
@@ -2914,6 +3182,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_dupv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_dupv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_dupv8qi"));
 sym___builtin_neon_vld2_dupv8qi->kind = SK_FUNCTION;sym___builtin_neon_vld2_dupv8qi->do_not_print = 1;sym___builtin_neon_vld2_dupv8qi->locus = builtins_locus;
@@ -2924,6 +3193,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_dupv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev2sf"));
 sym___builtin_neon_vld2_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev2sf->do_not_print = 1;sym___builtin_neon_vld2_lanev2sf->locus = builtins_locus;
@@ -2936,6 +3206,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev2si"));
 sym___builtin_neon_vld2_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev2si->do_not_print = 1;sym___builtin_neon_vld2_lanev2si->locus = builtins_locus;
@@ -2948,6 +3219,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev4hi"));
 sym___builtin_neon_vld2_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev4hi->do_not_print = 1;sym___builtin_neon_vld2_lanev4hi->locus = builtins_locus;
@@ -2960,6 +3232,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev4sf"));
 sym___builtin_neon_vld2_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev4sf->do_not_print = 1;sym___builtin_neon_vld2_lanev4sf->locus = builtins_locus;
@@ -2972,6 +3245,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev4si"));
 sym___builtin_neon_vld2_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev4si->do_not_print = 1;sym___builtin_neon_vld2_lanev4si->locus = builtins_locus;
@@ -2984,6 +3258,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev8hi"));
 sym___builtin_neon_vld2_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev8hi->do_not_print = 1;sym___builtin_neon_vld2_lanev8hi->locus = builtins_locus;
@@ -2996,6 +3271,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2_lanev8qi"));
 sym___builtin_neon_vld2_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vld2_lanev8qi->do_not_print = 1;sym___builtin_neon_vld2_lanev8qi->locus = builtins_locus;
@@ -3008,6 +3284,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v16qi"));
 sym___builtin_neon_vld2v16qi->kind = SK_FUNCTION;sym___builtin_neon_vld2v16qi->do_not_print = 1;sym___builtin_neon_vld2v16qi->locus = builtins_locus;
@@ -3018,6 +3295,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v2sf"));
 sym___builtin_neon_vld2v2sf->kind = SK_FUNCTION;sym___builtin_neon_vld2v2sf->do_not_print = 1;sym___builtin_neon_vld2v2sf->locus = builtins_locus;
@@ -3028,6 +3306,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v2si"));
 sym___builtin_neon_vld2v2si->kind = SK_FUNCTION;sym___builtin_neon_vld2v2si->do_not_print = 1;sym___builtin_neon_vld2v2si->locus = builtins_locus;
@@ -3038,6 +3317,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v4hi"));
 sym___builtin_neon_vld2v4hi->kind = SK_FUNCTION;sym___builtin_neon_vld2v4hi->do_not_print = 1;sym___builtin_neon_vld2v4hi->locus = builtins_locus;
@@ -3048,6 +3328,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v4sf"));
 sym___builtin_neon_vld2v4sf->kind = SK_FUNCTION;sym___builtin_neon_vld2v4sf->do_not_print = 1;sym___builtin_neon_vld2v4sf->locus = builtins_locus;
@@ -3058,6 +3339,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v4si"));
 sym___builtin_neon_vld2v4si->kind = SK_FUNCTION;sym___builtin_neon_vld2v4si->do_not_print = 1;sym___builtin_neon_vld2v4si->locus = builtins_locus;
@@ -3068,6 +3350,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v8hi"));
 sym___builtin_neon_vld2v8hi->kind = SK_FUNCTION;sym___builtin_neon_vld2v8hi->do_not_print = 1;sym___builtin_neon_vld2v8hi->locus = builtins_locus;
@@ -3078,6 +3361,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld2v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld2v8qi"));
 sym___builtin_neon_vld2v8qi->kind = SK_FUNCTION;sym___builtin_neon_vld2v8qi->do_not_print = 1;sym___builtin_neon_vld2v8qi->locus = builtins_locus;
@@ -3088,6 +3372,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld2v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3di"));
 sym___builtin_neon_vld3di->kind = SK_FUNCTION;sym___builtin_neon_vld3di->do_not_print = 1;sym___builtin_neon_vld3di->locus = builtins_locus;
@@ -3098,6 +3383,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_dupdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_dupdi"));
 sym___builtin_neon_vld3_dupdi->kind = SK_FUNCTION;sym___builtin_neon_vld3_dupdi->do_not_print = 1;sym___builtin_neon_vld3_dupdi->locus = builtins_locus;
@@ -3108,6 +3394,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_dupdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_dupv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_dupv2sf"));
 sym___builtin_neon_vld3_dupv2sf->kind = SK_FUNCTION;sym___builtin_neon_vld3_dupv2sf->do_not_print = 1;sym___builtin_neon_vld3_dupv2sf->locus = builtins_locus;
@@ -3118,6 +3405,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_dupv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_dupv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_dupv2si"));
 sym___builtin_neon_vld3_dupv2si->kind = SK_FUNCTION;sym___builtin_neon_vld3_dupv2si->do_not_print = 1;sym___builtin_neon_vld3_dupv2si->locus = builtins_locus;
@@ -3128,6 +3416,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_dupv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_dupv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_dupv4hi"));
 sym___builtin_neon_vld3_dupv4hi->kind = SK_FUNCTION;sym___builtin_neon_vld3_dupv4hi->do_not_print = 1;sym___builtin_neon_vld3_dupv4hi->locus = builtins_locus;
@@ -3138,6 +3427,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_dupv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_dupv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_dupv8qi"));
 sym___builtin_neon_vld3_dupv8qi->kind = SK_FUNCTION;sym___builtin_neon_vld3_dupv8qi->do_not_print = 1;sym___builtin_neon_vld3_dupv8qi->locus = builtins_locus;
@@ -3148,6 +3438,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_dupv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev2sf"));
 sym___builtin_neon_vld3_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev2sf->do_not_print = 1;sym___builtin_neon_vld3_lanev2sf->locus = builtins_locus;
@@ -3160,6 +3451,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev2si"));
 sym___builtin_neon_vld3_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev2si->do_not_print = 1;sym___builtin_neon_vld3_lanev2si->locus = builtins_locus;
@@ -3172,6 +3464,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev4hi"));
 sym___builtin_neon_vld3_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev4hi->do_not_print = 1;sym___builtin_neon_vld3_lanev4hi->locus = builtins_locus;
@@ -3184,6 +3477,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev4sf"));
 sym___builtin_neon_vld3_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev4sf->do_not_print = 1;sym___builtin_neon_vld3_lanev4sf->locus = builtins_locus;
@@ -3196,6 +3490,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev4si"));
 sym___builtin_neon_vld3_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev4si->do_not_print = 1;sym___builtin_neon_vld3_lanev4si->locus = builtins_locus;
@@ -3208,6 +3503,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev8hi"));
 sym___builtin_neon_vld3_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev8hi->do_not_print = 1;sym___builtin_neon_vld3_lanev8hi->locus = builtins_locus;
@@ -3220,6 +3516,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3_lanev8qi"));
 sym___builtin_neon_vld3_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vld3_lanev8qi->do_not_print = 1;sym___builtin_neon_vld3_lanev8qi->locus = builtins_locus;
@@ -3232,6 +3529,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v16qi"));
 sym___builtin_neon_vld3v16qi->kind = SK_FUNCTION;sym___builtin_neon_vld3v16qi->do_not_print = 1;sym___builtin_neon_vld3v16qi->locus = builtins_locus;
@@ -3242,6 +3540,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v2sf"));
 sym___builtin_neon_vld3v2sf->kind = SK_FUNCTION;sym___builtin_neon_vld3v2sf->do_not_print = 1;sym___builtin_neon_vld3v2sf->locus = builtins_locus;
@@ -3252,6 +3551,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v2si"));
 sym___builtin_neon_vld3v2si->kind = SK_FUNCTION;sym___builtin_neon_vld3v2si->do_not_print = 1;sym___builtin_neon_vld3v2si->locus = builtins_locus;
@@ -3262,6 +3562,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v4hi"));
 sym___builtin_neon_vld3v4hi->kind = SK_FUNCTION;sym___builtin_neon_vld3v4hi->do_not_print = 1;sym___builtin_neon_vld3v4hi->locus = builtins_locus;
@@ -3272,6 +3573,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v4sf"));
 sym___builtin_neon_vld3v4sf->kind = SK_FUNCTION;sym___builtin_neon_vld3v4sf->do_not_print = 1;sym___builtin_neon_vld3v4sf->locus = builtins_locus;
@@ -3282,6 +3584,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v4si"));
 sym___builtin_neon_vld3v4si->kind = SK_FUNCTION;sym___builtin_neon_vld3v4si->do_not_print = 1;sym___builtin_neon_vld3v4si->locus = builtins_locus;
@@ -3292,6 +3595,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v8hi"));
 sym___builtin_neon_vld3v8hi->kind = SK_FUNCTION;sym___builtin_neon_vld3v8hi->do_not_print = 1;sym___builtin_neon_vld3v8hi->locus = builtins_locus;
@@ -3302,6 +3606,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld3v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld3v8qi"));
 sym___builtin_neon_vld3v8qi->kind = SK_FUNCTION;sym___builtin_neon_vld3v8qi->do_not_print = 1;sym___builtin_neon_vld3v8qi->locus = builtins_locus;
@@ -3312,6 +3617,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld3v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4di"));
 sym___builtin_neon_vld4di->kind = SK_FUNCTION;sym___builtin_neon_vld4di->do_not_print = 1;sym___builtin_neon_vld4di->locus = builtins_locus;
@@ -3322,6 +3628,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_dupdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_dupdi"));
 sym___builtin_neon_vld4_dupdi->kind = SK_FUNCTION;sym___builtin_neon_vld4_dupdi->do_not_print = 1;sym___builtin_neon_vld4_dupdi->locus = builtins_locus;
@@ -3332,6 +3639,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_dupdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_dupv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_dupv2sf"));
 sym___builtin_neon_vld4_dupv2sf->kind = SK_FUNCTION;sym___builtin_neon_vld4_dupv2sf->do_not_print = 1;sym___builtin_neon_vld4_dupv2sf->locus = builtins_locus;
@@ -3342,6 +3650,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_dupv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_dupv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_dupv2si"));
 sym___builtin_neon_vld4_dupv2si->kind = SK_FUNCTION;sym___builtin_neon_vld4_dupv2si->do_not_print = 1;sym___builtin_neon_vld4_dupv2si->locus = builtins_locus;
@@ -3352,6 +3661,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_dupv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_dupv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_dupv4hi"));
 sym___builtin_neon_vld4_dupv4hi->kind = SK_FUNCTION;sym___builtin_neon_vld4_dupv4hi->do_not_print = 1;sym___builtin_neon_vld4_dupv4hi->locus = builtins_locus;
@@ -3362,6 +3672,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_dupv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_dupv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_dupv8qi"));
 sym___builtin_neon_vld4_dupv8qi->kind = SK_FUNCTION;sym___builtin_neon_vld4_dupv8qi->do_not_print = 1;sym___builtin_neon_vld4_dupv8qi->locus = builtins_locus;
@@ -3372,6 +3683,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_dupv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev2sf"));
 sym___builtin_neon_vld4_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev2sf->do_not_print = 1;sym___builtin_neon_vld4_lanev2sf->locus = builtins_locus;
@@ -3384,6 +3696,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev2si"));
 sym___builtin_neon_vld4_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev2si->do_not_print = 1;sym___builtin_neon_vld4_lanev2si->locus = builtins_locus;
@@ -3396,6 +3709,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev4hi"));
 sym___builtin_neon_vld4_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev4hi->do_not_print = 1;sym___builtin_neon_vld4_lanev4hi->locus = builtins_locus;
@@ -3408,6 +3722,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev4sf"));
 sym___builtin_neon_vld4_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev4sf->do_not_print = 1;sym___builtin_neon_vld4_lanev4sf->locus = builtins_locus;
@@ -3420,6 +3735,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev4si"));
 sym___builtin_neon_vld4_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev4si->do_not_print = 1;sym___builtin_neon_vld4_lanev4si->locus = builtins_locus;
@@ -3432,6 +3748,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev8hi"));
 sym___builtin_neon_vld4_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev8hi->do_not_print = 1;sym___builtin_neon_vld4_lanev8hi->locus = builtins_locus;
@@ -3444,6 +3761,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4_lanev8qi"));
 sym___builtin_neon_vld4_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vld4_lanev8qi->do_not_print = 1;sym___builtin_neon_vld4_lanev8qi->locus = builtins_locus;
@@ -3456,6 +3774,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v16qi"));
 sym___builtin_neon_vld4v16qi->kind = SK_FUNCTION;sym___builtin_neon_vld4v16qi->do_not_print = 1;sym___builtin_neon_vld4v16qi->locus = builtins_locus;
@@ -3466,6 +3785,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v2sf"));
 sym___builtin_neon_vld4v2sf->kind = SK_FUNCTION;sym___builtin_neon_vld4v2sf->do_not_print = 1;sym___builtin_neon_vld4v2sf->locus = builtins_locus;
@@ -3476,6 +3796,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v2si"));
 sym___builtin_neon_vld4v2si->kind = SK_FUNCTION;sym___builtin_neon_vld4v2si->do_not_print = 1;sym___builtin_neon_vld4v2si->locus = builtins_locus;
@@ -3486,6 +3807,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v4hi"));
 sym___builtin_neon_vld4v4hi->kind = SK_FUNCTION;sym___builtin_neon_vld4v4hi->do_not_print = 1;sym___builtin_neon_vld4v4hi->locus = builtins_locus;
@@ -3496,6 +3818,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v4sf"));
 sym___builtin_neon_vld4v4sf->kind = SK_FUNCTION;sym___builtin_neon_vld4v4sf->do_not_print = 1;sym___builtin_neon_vld4v4sf->locus = builtins_locus;
@@ -3506,6 +3829,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v4si"));
 sym___builtin_neon_vld4v4si->kind = SK_FUNCTION;sym___builtin_neon_vld4v4si->do_not_print = 1;sym___builtin_neon_vld4v4si->locus = builtins_locus;
@@ -3516,6 +3840,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v8hi"));
 sym___builtin_neon_vld4v8hi->kind = SK_FUNCTION;sym___builtin_neon_vld4v8hi->do_not_print = 1;sym___builtin_neon_vld4v8hi->locus = builtins_locus;
@@ -3526,6 +3851,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vld4v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vld4v8qi"));
 sym___builtin_neon_vld4v8qi->kind = SK_FUNCTION;sym___builtin_neon_vld4v8qi->do_not_print = 1;sym___builtin_neon_vld4v8qi->locus = builtins_locus;
@@ -3536,6 +3862,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vld4v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxfv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxfv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxfv2sf"));
 sym___builtin_neon_vmaxfv2sf->kind = SK_FUNCTION;sym___builtin_neon_vmaxfv2sf->do_not_print = 1;sym___builtin_neon_vmaxfv2sf->locus = builtins_locus;
@@ -3547,6 +3874,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxfv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxfv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxfv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxfv4sf"));
 sym___builtin_neon_vmaxfv4sf->kind = SK_FUNCTION;sym___builtin_neon_vmaxfv4sf->do_not_print = 1;sym___builtin_neon_vmaxfv4sf->locus = builtins_locus;
@@ -3558,6 +3886,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxfv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxsv16qi"));
 sym___builtin_neon_vmaxsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vmaxsv16qi->do_not_print = 1;sym___builtin_neon_vmaxsv16qi->locus = builtins_locus;
@@ -3569,6 +3898,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxsv2si"));
 sym___builtin_neon_vmaxsv2si->kind = SK_FUNCTION;sym___builtin_neon_vmaxsv2si->do_not_print = 1;sym___builtin_neon_vmaxsv2si->locus = builtins_locus;
@@ -3580,6 +3910,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxsv4hi"));
 sym___builtin_neon_vmaxsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmaxsv4hi->do_not_print = 1;sym___builtin_neon_vmaxsv4hi->locus = builtins_locus;
@@ -3591,6 +3922,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxsv4si"));
 sym___builtin_neon_vmaxsv4si->kind = SK_FUNCTION;sym___builtin_neon_vmaxsv4si->do_not_print = 1;sym___builtin_neon_vmaxsv4si->locus = builtins_locus;
@@ -3602,6 +3934,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxsv8hi"));
 sym___builtin_neon_vmaxsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmaxsv8hi->do_not_print = 1;sym___builtin_neon_vmaxsv8hi->locus = builtins_locus;
@@ -3613,6 +3946,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxsv8qi"));
 sym___builtin_neon_vmaxsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmaxsv8qi->do_not_print = 1;sym___builtin_neon_vmaxsv8qi->locus = builtins_locus;
@@ -3624,6 +3958,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxuv16qi"));
 sym___builtin_neon_vmaxuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vmaxuv16qi->do_not_print = 1;sym___builtin_neon_vmaxuv16qi->locus = builtins_locus;
@@ -3635,6 +3970,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxuv2si"));
 sym___builtin_neon_vmaxuv2si->kind = SK_FUNCTION;sym___builtin_neon_vmaxuv2si->do_not_print = 1;sym___builtin_neon_vmaxuv2si->locus = builtins_locus;
@@ -3646,6 +3982,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxuv4hi"));
 sym___builtin_neon_vmaxuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmaxuv4hi->do_not_print = 1;sym___builtin_neon_vmaxuv4hi->locus = builtins_locus;
@@ -3657,6 +3994,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxuv4si"));
 sym___builtin_neon_vmaxuv4si->kind = SK_FUNCTION;sym___builtin_neon_vmaxuv4si->do_not_print = 1;sym___builtin_neon_vmaxuv4si->locus = builtins_locus;
@@ -3668,6 +4006,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxuv8hi"));
 sym___builtin_neon_vmaxuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmaxuv8hi->do_not_print = 1;sym___builtin_neon_vmaxuv8hi->locus = builtins_locus;
@@ -3679,6 +4018,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmaxuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmaxuv8qi"));
 sym___builtin_neon_vmaxuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmaxuv8qi->do_not_print = 1;sym___builtin_neon_vmaxuv8qi->locus = builtins_locus;
@@ -3690,6 +4030,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmaxuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminfv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminfv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminfv2sf"));
 sym___builtin_neon_vminfv2sf->kind = SK_FUNCTION;sym___builtin_neon_vminfv2sf->do_not_print = 1;sym___builtin_neon_vminfv2sf->locus = builtins_locus;
@@ -3701,6 +4042,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminfv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminfv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminfv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminfv4sf"));
 sym___builtin_neon_vminfv4sf->kind = SK_FUNCTION;sym___builtin_neon_vminfv4sf->do_not_print = 1;sym___builtin_neon_vminfv4sf->locus = builtins_locus;
@@ -3712,6 +4054,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminfv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminsv16qi"));
 sym___builtin_neon_vminsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vminsv16qi->do_not_print = 1;sym___builtin_neon_vminsv16qi->locus = builtins_locus;
@@ -3723,6 +4066,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminsv2si"));
 sym___builtin_neon_vminsv2si->kind = SK_FUNCTION;sym___builtin_neon_vminsv2si->do_not_print = 1;sym___builtin_neon_vminsv2si->locus = builtins_locus;
@@ -3734,6 +4078,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminsv4hi"));
 sym___builtin_neon_vminsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vminsv4hi->do_not_print = 1;sym___builtin_neon_vminsv4hi->locus = builtins_locus;
@@ -3745,6 +4090,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminsv4si"));
 sym___builtin_neon_vminsv4si->kind = SK_FUNCTION;sym___builtin_neon_vminsv4si->do_not_print = 1;sym___builtin_neon_vminsv4si->locus = builtins_locus;
@@ -3756,6 +4102,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminsv8hi"));
 sym___builtin_neon_vminsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vminsv8hi->do_not_print = 1;sym___builtin_neon_vminsv8hi->locus = builtins_locus;
@@ -3767,6 +4114,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminsv8qi"));
 sym___builtin_neon_vminsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vminsv8qi->do_not_print = 1;sym___builtin_neon_vminsv8qi->locus = builtins_locus;
@@ -3778,6 +4126,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminuv16qi"));
 sym___builtin_neon_vminuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vminuv16qi->do_not_print = 1;sym___builtin_neon_vminuv16qi->locus = builtins_locus;
@@ -3789,6 +4138,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminuv2si"));
 sym___builtin_neon_vminuv2si->kind = SK_FUNCTION;sym___builtin_neon_vminuv2si->do_not_print = 1;sym___builtin_neon_vminuv2si->locus = builtins_locus;
@@ -3800,6 +4150,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminuv4hi"));
 sym___builtin_neon_vminuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vminuv4hi->do_not_print = 1;sym___builtin_neon_vminuv4hi->locus = builtins_locus;
@@ -3811,6 +4162,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminuv4si"));
 sym___builtin_neon_vminuv4si->kind = SK_FUNCTION;sym___builtin_neon_vminuv4si->do_not_print = 1;sym___builtin_neon_vminuv4si->locus = builtins_locus;
@@ -3822,6 +4174,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminuv8hi"));
 sym___builtin_neon_vminuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vminuv8hi->do_not_print = 1;sym___builtin_neon_vminuv8hi->locus = builtins_locus;
@@ -3833,6 +4186,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vminuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vminuv8qi"));
 sym___builtin_neon_vminuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vminuv8qi->do_not_print = 1;sym___builtin_neon_vminuv8qi->locus = builtins_locus;
@@ -3844,6 +4198,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vminuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_lanev2sf"));
 sym___builtin_neon_vmla_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vmla_lanev2sf->do_not_print = 1;sym___builtin_neon_vmla_lanev2sf->locus = builtins_locus;
@@ -3857,6 +4212,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_lanev2si"));
 sym___builtin_neon_vmla_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmla_lanev2si->do_not_print = 1;sym___builtin_neon_vmla_lanev2si->locus = builtins_locus;
@@ -3870,6 +4226,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_lanev4hi"));
 sym___builtin_neon_vmla_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmla_lanev4hi->do_not_print = 1;sym___builtin_neon_vmla_lanev4hi->locus = builtins_locus;
@@ -3883,6 +4240,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_lanev4sf"));
 sym___builtin_neon_vmla_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vmla_lanev4sf->do_not_print = 1;sym___builtin_neon_vmla_lanev4sf->locus = builtins_locus;
@@ -3896,6 +4254,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_lanev4si"));
 sym___builtin_neon_vmla_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vmla_lanev4si->do_not_print = 1;sym___builtin_neon_vmla_lanev4si->locus = builtins_locus;
@@ -3909,6 +4268,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_lanev8hi"));
 sym___builtin_neon_vmla_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vmla_lanev8hi->do_not_print = 1;sym___builtin_neon_vmla_lanev8hi->locus = builtins_locus;
@@ -3922,6 +4282,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlals_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlals_lanev2si"));
 sym___builtin_neon_vmlals_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmlals_lanev2si->do_not_print = 1;sym___builtin_neon_vmlals_lanev2si->locus = builtins_locus;
@@ -3935,6 +4296,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlals_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlals_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlals_lanev4hi"));
 sym___builtin_neon_vmlals_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlals_lanev4hi->do_not_print = 1;sym___builtin_neon_vmlals_lanev4hi->locus = builtins_locus;
@@ -3948,6 +4310,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlals_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlals_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlals_nv2si"));
 sym___builtin_neon_vmlals_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlals_nv2si->do_not_print = 1;sym___builtin_neon_vmlals_nv2si->locus = builtins_locus;
@@ -3960,6 +4323,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlals_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlals_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlals_nv4hi"));
 sym___builtin_neon_vmlals_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlals_nv4hi->do_not_print = 1;sym___builtin_neon_vmlals_nv4hi->locus = builtins_locus;
@@ -3972,6 +4336,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlals_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalsv2si"));
 sym___builtin_neon_vmlalsv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlalsv2si->do_not_print = 1;sym___builtin_neon_vmlalsv2si->locus = builtins_locus;
@@ -3984,6 +4349,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalsv4hi"));
 sym___builtin_neon_vmlalsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlalsv4hi->do_not_print = 1;sym___builtin_neon_vmlalsv4hi->locus = builtins_locus;
@@ -3996,6 +4362,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalsv8qi"));
 sym___builtin_neon_vmlalsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmlalsv8qi->do_not_print = 1;sym___builtin_neon_vmlalsv8qi->locus = builtins_locus;
@@ -4008,6 +4375,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalu_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalu_lanev2si"));
 sym___builtin_neon_vmlalu_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmlalu_lanev2si->do_not_print = 1;sym___builtin_neon_vmlalu_lanev2si->locus = builtins_locus;
@@ -4021,6 +4389,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalu_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalu_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalu_lanev4hi"));
 sym___builtin_neon_vmlalu_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlalu_lanev4hi->do_not_print = 1;sym___builtin_neon_vmlalu_lanev4hi->locus = builtins_locus;
@@ -4034,6 +4403,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalu_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalu_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalu_nv2si"));
 sym___builtin_neon_vmlalu_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlalu_nv2si->do_not_print = 1;sym___builtin_neon_vmlalu_nv2si->locus = builtins_locus;
@@ -4046,6 +4416,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalu_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlalu_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlalu_nv4hi"));
 sym___builtin_neon_vmlalu_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlalu_nv4hi->do_not_print = 1;sym___builtin_neon_vmlalu_nv4hi->locus = builtins_locus;
@@ -4058,6 +4429,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlalu_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlaluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlaluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlaluv2si"));
 sym___builtin_neon_vmlaluv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlaluv2si->do_not_print = 1;sym___builtin_neon_vmlaluv2si->locus = builtins_locus;
@@ -4070,6 +4442,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlaluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlaluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlaluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlaluv4hi"));
 sym___builtin_neon_vmlaluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlaluv4hi->do_not_print = 1;sym___builtin_neon_vmlaluv4hi->locus = builtins_locus;
@@ -4082,6 +4455,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlaluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlaluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlaluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlaluv8qi"));
 sym___builtin_neon_vmlaluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmlaluv8qi->do_not_print = 1;sym___builtin_neon_vmlaluv8qi->locus = builtins_locus;
@@ -4094,6 +4468,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlaluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_nv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_nv2sf"));
 sym___builtin_neon_vmla_nv2sf->kind = SK_FUNCTION;sym___builtin_neon_vmla_nv2sf->do_not_print = 1;sym___builtin_neon_vmla_nv2sf->locus = builtins_locus;
@@ -4106,6 +4481,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_nv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_nv2si"));
 sym___builtin_neon_vmla_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmla_nv2si->do_not_print = 1;sym___builtin_neon_vmla_nv2si->locus = builtins_locus;
@@ -4118,6 +4494,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_nv4hi"));
 sym___builtin_neon_vmla_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmla_nv4hi->do_not_print = 1;sym___builtin_neon_vmla_nv4hi->locus = builtins_locus;
@@ -4130,6 +4507,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_nv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_nv4sf"));
 sym___builtin_neon_vmla_nv4sf->kind = SK_FUNCTION;sym___builtin_neon_vmla_nv4sf->do_not_print = 1;sym___builtin_neon_vmla_nv4sf->locus = builtins_locus;
@@ -4142,6 +4520,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_nv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_nv4si"));
 sym___builtin_neon_vmla_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vmla_nv4si->do_not_print = 1;sym___builtin_neon_vmla_nv4si->locus = builtins_locus;
@@ -4154,6 +4533,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmla_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmla_nv8hi"));
 sym___builtin_neon_vmla_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmla_nv8hi->do_not_print = 1;sym___builtin_neon_vmla_nv8hi->locus = builtins_locus;
@@ -4166,6 +4546,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmla_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav16qi"));
 sym___builtin_neon_vmlav16qi->kind = SK_FUNCTION;sym___builtin_neon_vmlav16qi->do_not_print = 1;sym___builtin_neon_vmlav16qi->locus = builtins_locus;
@@ -4178,6 +4559,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav2sf"));
 sym___builtin_neon_vmlav2sf->kind = SK_FUNCTION;sym___builtin_neon_vmlav2sf->do_not_print = 1;sym___builtin_neon_vmlav2sf->locus = builtins_locus;
@@ -4190,6 +4572,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav2si"));
 sym___builtin_neon_vmlav2si->kind = SK_FUNCTION;sym___builtin_neon_vmlav2si->do_not_print = 1;sym___builtin_neon_vmlav2si->locus = builtins_locus;
@@ -4202,6 +4585,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav4hi"));
 sym___builtin_neon_vmlav4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlav4hi->do_not_print = 1;sym___builtin_neon_vmlav4hi->locus = builtins_locus;
@@ -4214,6 +4598,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav4sf"));
 sym___builtin_neon_vmlav4sf->kind = SK_FUNCTION;sym___builtin_neon_vmlav4sf->do_not_print = 1;sym___builtin_neon_vmlav4sf->locus = builtins_locus;
@@ -4226,6 +4611,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav4si"));
 sym___builtin_neon_vmlav4si->kind = SK_FUNCTION;sym___builtin_neon_vmlav4si->do_not_print = 1;sym___builtin_neon_vmlav4si->locus = builtins_locus;
@@ -4238,6 +4624,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav8hi"));
 sym___builtin_neon_vmlav8hi->kind = SK_FUNCTION;sym___builtin_neon_vmlav8hi->do_not_print = 1;sym___builtin_neon_vmlav8hi->locus = builtins_locus;
@@ -4250,6 +4637,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlav8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlav8qi"));
 sym___builtin_neon_vmlav8qi->kind = SK_FUNCTION;sym___builtin_neon_vmlav8qi->do_not_print = 1;sym___builtin_neon_vmlav8qi->locus = builtins_locus;
@@ -4262,6 +4650,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlav8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_lanev2sf"));
 sym___builtin_neon_vmls_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vmls_lanev2sf->do_not_print = 1;sym___builtin_neon_vmls_lanev2sf->locus = builtins_locus;
@@ -4275,6 +4664,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_lanev2si"));
 sym___builtin_neon_vmls_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmls_lanev2si->do_not_print = 1;sym___builtin_neon_vmls_lanev2si->locus = builtins_locus;
@@ -4288,6 +4678,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_lanev4hi"));
 sym___builtin_neon_vmls_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmls_lanev4hi->do_not_print = 1;sym___builtin_neon_vmls_lanev4hi->locus = builtins_locus;
@@ -4301,6 +4692,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_lanev4sf"));
 sym___builtin_neon_vmls_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vmls_lanev4sf->do_not_print = 1;sym___builtin_neon_vmls_lanev4sf->locus = builtins_locus;
@@ -4314,6 +4706,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_lanev4si"));
 sym___builtin_neon_vmls_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vmls_lanev4si->do_not_print = 1;sym___builtin_neon_vmls_lanev4si->locus = builtins_locus;
@@ -4327,6 +4720,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_lanev8hi"));
 sym___builtin_neon_vmls_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vmls_lanev8hi->do_not_print = 1;sym___builtin_neon_vmls_lanev8hi->locus = builtins_locus;
@@ -4340,6 +4734,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsls_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsls_lanev2si"));
 sym___builtin_neon_vmlsls_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmlsls_lanev2si->do_not_print = 1;sym___builtin_neon_vmlsls_lanev2si->locus = builtins_locus;
@@ -4353,6 +4748,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsls_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsls_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsls_lanev4hi"));
 sym___builtin_neon_vmlsls_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlsls_lanev4hi->do_not_print = 1;sym___builtin_neon_vmlsls_lanev4hi->locus = builtins_locus;
@@ -4366,6 +4762,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsls_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsls_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsls_nv2si"));
 sym___builtin_neon_vmlsls_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlsls_nv2si->do_not_print = 1;sym___builtin_neon_vmlsls_nv2si->locus = builtins_locus;
@@ -4378,6 +4775,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsls_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsls_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsls_nv4hi"));
 sym___builtin_neon_vmlsls_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlsls_nv4hi->do_not_print = 1;sym___builtin_neon_vmlsls_nv4hi->locus = builtins_locus;
@@ -4390,6 +4788,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsls_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslsv2si"));
 sym___builtin_neon_vmlslsv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlslsv2si->do_not_print = 1;sym___builtin_neon_vmlslsv2si->locus = builtins_locus;
@@ -4402,6 +4801,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslsv4hi"));
 sym___builtin_neon_vmlslsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlslsv4hi->do_not_print = 1;sym___builtin_neon_vmlslsv4hi->locus = builtins_locus;
@@ -4414,6 +4814,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslsv8qi"));
 sym___builtin_neon_vmlslsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmlslsv8qi->do_not_print = 1;sym___builtin_neon_vmlslsv8qi->locus = builtins_locus;
@@ -4426,6 +4827,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslu_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslu_lanev2si"));
 sym___builtin_neon_vmlslu_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmlslu_lanev2si->do_not_print = 1;sym___builtin_neon_vmlslu_lanev2si->locus = builtins_locus;
@@ -4439,6 +4841,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslu_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslu_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslu_lanev4hi"));
 sym___builtin_neon_vmlslu_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlslu_lanev4hi->do_not_print = 1;sym___builtin_neon_vmlslu_lanev4hi->locus = builtins_locus;
@@ -4452,6 +4855,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslu_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslu_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslu_nv2si"));
 sym___builtin_neon_vmlslu_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlslu_nv2si->do_not_print = 1;sym___builtin_neon_vmlslu_nv2si->locus = builtins_locus;
@@ -4464,6 +4868,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslu_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlslu_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlslu_nv4hi"));
 sym___builtin_neon_vmlslu_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlslu_nv4hi->do_not_print = 1;sym___builtin_neon_vmlslu_nv4hi->locus = builtins_locus;
@@ -4476,6 +4881,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlslu_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsluv2si"));
 sym___builtin_neon_vmlsluv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlsluv2si->do_not_print = 1;sym___builtin_neon_vmlsluv2si->locus = builtins_locus;
@@ -4488,6 +4894,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsluv4hi"));
 sym___builtin_neon_vmlsluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlsluv4hi->do_not_print = 1;sym___builtin_neon_vmlsluv4hi->locus = builtins_locus;
@@ -4500,6 +4907,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsluv8qi"));
 sym___builtin_neon_vmlsluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmlsluv8qi->do_not_print = 1;sym___builtin_neon_vmlsluv8qi->locus = builtins_locus;
@@ -4512,6 +4920,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_nv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_nv2sf"));
 sym___builtin_neon_vmls_nv2sf->kind = SK_FUNCTION;sym___builtin_neon_vmls_nv2sf->do_not_print = 1;sym___builtin_neon_vmls_nv2sf->locus = builtins_locus;
@@ -4524,6 +4933,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_nv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_nv2si"));
 sym___builtin_neon_vmls_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmls_nv2si->do_not_print = 1;sym___builtin_neon_vmls_nv2si->locus = builtins_locus;
@@ -4536,6 +4946,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_nv4hi"));
 sym___builtin_neon_vmls_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmls_nv4hi->do_not_print = 1;sym___builtin_neon_vmls_nv4hi->locus = builtins_locus;
@@ -4548,6 +4959,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_nv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_nv4sf"));
 sym___builtin_neon_vmls_nv4sf->kind = SK_FUNCTION;sym___builtin_neon_vmls_nv4sf->do_not_print = 1;sym___builtin_neon_vmls_nv4sf->locus = builtins_locus;
@@ -4560,6 +4972,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_nv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_nv4si"));
 sym___builtin_neon_vmls_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vmls_nv4si->do_not_print = 1;sym___builtin_neon_vmls_nv4si->locus = builtins_locus;
@@ -4572,6 +4985,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmls_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmls_nv8hi"));
 sym___builtin_neon_vmls_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmls_nv8hi->do_not_print = 1;sym___builtin_neon_vmls_nv8hi->locus = builtins_locus;
@@ -4584,6 +4998,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmls_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv16qi"));
 sym___builtin_neon_vmlsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vmlsv16qi->do_not_print = 1;sym___builtin_neon_vmlsv16qi->locus = builtins_locus;
@@ -4596,6 +5011,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv2sf"));
 sym___builtin_neon_vmlsv2sf->kind = SK_FUNCTION;sym___builtin_neon_vmlsv2sf->do_not_print = 1;sym___builtin_neon_vmlsv2sf->locus = builtins_locus;
@@ -4608,6 +5024,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv2si"));
 sym___builtin_neon_vmlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vmlsv2si->do_not_print = 1;sym___builtin_neon_vmlsv2si->locus = builtins_locus;
@@ -4620,6 +5037,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv4hi"));
 sym___builtin_neon_vmlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmlsv4hi->do_not_print = 1;sym___builtin_neon_vmlsv4hi->locus = builtins_locus;
@@ -4632,6 +5050,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv4sf"));
 sym___builtin_neon_vmlsv4sf->kind = SK_FUNCTION;sym___builtin_neon_vmlsv4sf->do_not_print = 1;sym___builtin_neon_vmlsv4sf->locus = builtins_locus;
@@ -4644,6 +5063,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv4si"));
 sym___builtin_neon_vmlsv4si->kind = SK_FUNCTION;sym___builtin_neon_vmlsv4si->do_not_print = 1;sym___builtin_neon_vmlsv4si->locus = builtins_locus;
@@ -4656,6 +5076,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv8hi"));
 sym___builtin_neon_vmlsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmlsv8hi->do_not_print = 1;sym___builtin_neon_vmlsv8hi->locus = builtins_locus;
@@ -4668,6 +5089,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmlsv8qi"));
 sym___builtin_neon_vmlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmlsv8qi->do_not_print = 1;sym___builtin_neon_vmlsv8qi->locus = builtins_locus;
@@ -4680,6 +5102,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovlsv2si"));
 sym___builtin_neon_vmovlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vmovlsv2si->do_not_print = 1;sym___builtin_neon_vmovlsv2si->locus = builtins_locus;
@@ -4690,6 +5113,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovlsv4hi"));
 sym___builtin_neon_vmovlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmovlsv4hi->do_not_print = 1;sym___builtin_neon_vmovlsv4hi->locus = builtins_locus;
@@ -4700,6 +5124,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovlsv8qi"));
 sym___builtin_neon_vmovlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmovlsv8qi->do_not_print = 1;sym___builtin_neon_vmovlsv8qi->locus = builtins_locus;
@@ -4710,6 +5135,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovluv2si"));
 sym___builtin_neon_vmovluv2si->kind = SK_FUNCTION;sym___builtin_neon_vmovluv2si->do_not_print = 1;sym___builtin_neon_vmovluv2si->locus = builtins_locus;
@@ -4720,6 +5146,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovluv4hi"));
 sym___builtin_neon_vmovluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmovluv4hi->do_not_print = 1;sym___builtin_neon_vmovluv4hi->locus = builtins_locus;
@@ -4730,6 +5157,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovluv8qi"));
 sym___builtin_neon_vmovluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmovluv8qi->do_not_print = 1;sym___builtin_neon_vmovluv8qi->locus = builtins_locus;
@@ -4740,6 +5168,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovnv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovnv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovnv2di"));
 sym___builtin_neon_vmovnv2di->kind = SK_FUNCTION;sym___builtin_neon_vmovnv2di->do_not_print = 1;sym___builtin_neon_vmovnv2di->locus = builtins_locus;
@@ -4750,6 +5179,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovnv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovnv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovnv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovnv4si"));
 sym___builtin_neon_vmovnv4si->kind = SK_FUNCTION;sym___builtin_neon_vmovnv4si->do_not_print = 1;sym___builtin_neon_vmovnv4si->locus = builtins_locus;
@@ -4760,6 +5190,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovnv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovnv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmovnv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmovnv8hi"));
 sym___builtin_neon_vmovnv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmovnv8hi->do_not_print = 1;sym___builtin_neon_vmovnv8hi->locus = builtins_locus;
@@ -4770,6 +5201,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmovnv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulfv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulfv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulfv2sf"));
 sym___builtin_neon_vmulfv2sf->kind = SK_FUNCTION;sym___builtin_neon_vmulfv2sf->do_not_print = 1;sym___builtin_neon_vmulfv2sf->locus = builtins_locus;
@@ -4781,6 +5213,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulfv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulfv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulfv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulfv4sf"));
 sym___builtin_neon_vmulfv4sf->kind = SK_FUNCTION;sym___builtin_neon_vmulfv4sf->do_not_print = 1;sym___builtin_neon_vmulfv4sf->locus = builtins_locus;
@@ -4792,6 +5225,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulfv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_lanev2sf"));
 sym___builtin_neon_vmul_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vmul_lanev2sf->do_not_print = 1;sym___builtin_neon_vmul_lanev2sf->locus = builtins_locus;
@@ -4804,6 +5238,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_lanev2si"));
 sym___builtin_neon_vmul_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmul_lanev2si->do_not_print = 1;sym___builtin_neon_vmul_lanev2si->locus = builtins_locus;
@@ -4816,6 +5251,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_lanev4hi"));
 sym___builtin_neon_vmul_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmul_lanev4hi->do_not_print = 1;sym___builtin_neon_vmul_lanev4hi->locus = builtins_locus;
@@ -4828,6 +5264,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_lanev4sf"));
 sym___builtin_neon_vmul_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vmul_lanev4sf->do_not_print = 1;sym___builtin_neon_vmul_lanev4sf->locus = builtins_locus;
@@ -4840,6 +5277,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_lanev4si"));
 sym___builtin_neon_vmul_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vmul_lanev4si->do_not_print = 1;sym___builtin_neon_vmul_lanev4si->locus = builtins_locus;
@@ -4852,6 +5290,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_lanev8hi"));
 sym___builtin_neon_vmul_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vmul_lanev8hi->do_not_print = 1;sym___builtin_neon_vmul_lanev8hi->locus = builtins_locus;
@@ -4864,6 +5303,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullpv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullpv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullpv8qi"));
 sym___builtin_neon_vmullpv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmullpv8qi->do_not_print = 1;sym___builtin_neon_vmullpv8qi->locus = builtins_locus;
@@ -4875,6 +5315,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullpv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulls_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulls_lanev2si"));
 sym___builtin_neon_vmulls_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmulls_lanev2si->do_not_print = 1;sym___builtin_neon_vmulls_lanev2si->locus = builtins_locus;
@@ -4887,6 +5328,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulls_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulls_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulls_lanev4hi"));
 sym___builtin_neon_vmulls_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmulls_lanev4hi->do_not_print = 1;sym___builtin_neon_vmulls_lanev4hi->locus = builtins_locus;
@@ -4899,6 +5341,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulls_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulls_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulls_nv2si"));
 sym___builtin_neon_vmulls_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmulls_nv2si->do_not_print = 1;sym___builtin_neon_vmulls_nv2si->locus = builtins_locus;
@@ -4910,6 +5353,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulls_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulls_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulls_nv4hi"));
 sym___builtin_neon_vmulls_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmulls_nv4hi->do_not_print = 1;sym___builtin_neon_vmulls_nv4hi->locus = builtins_locus;
@@ -4921,6 +5365,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulls_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullsv2si"));
 sym___builtin_neon_vmullsv2si->kind = SK_FUNCTION;sym___builtin_neon_vmullsv2si->do_not_print = 1;sym___builtin_neon_vmullsv2si->locus = builtins_locus;
@@ -4932,6 +5377,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullsv4hi"));
 sym___builtin_neon_vmullsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmullsv4hi->do_not_print = 1;sym___builtin_neon_vmullsv4hi->locus = builtins_locus;
@@ -4943,6 +5389,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullsv8qi"));
 sym___builtin_neon_vmullsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmullsv8qi->do_not_print = 1;sym___builtin_neon_vmullsv8qi->locus = builtins_locus;
@@ -4954,6 +5401,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullu_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullu_lanev2si"));
 sym___builtin_neon_vmullu_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vmullu_lanev2si->do_not_print = 1;sym___builtin_neon_vmullu_lanev2si->locus = builtins_locus;
@@ -4966,6 +5414,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullu_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullu_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullu_lanev4hi"));
 sym___builtin_neon_vmullu_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vmullu_lanev4hi->do_not_print = 1;sym___builtin_neon_vmullu_lanev4hi->locus = builtins_locus;
@@ -4978,6 +5427,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullu_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullu_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullu_nv2si"));
 sym___builtin_neon_vmullu_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmullu_nv2si->do_not_print = 1;sym___builtin_neon_vmullu_nv2si->locus = builtins_locus;
@@ -4989,6 +5439,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullu_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmullu_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmullu_nv4hi"));
 sym___builtin_neon_vmullu_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmullu_nv4hi->do_not_print = 1;sym___builtin_neon_vmullu_nv4hi->locus = builtins_locus;
@@ -5000,6 +5451,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmullu_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulluv2si"));
 sym___builtin_neon_vmulluv2si->kind = SK_FUNCTION;sym___builtin_neon_vmulluv2si->do_not_print = 1;sym___builtin_neon_vmulluv2si->locus = builtins_locus;
@@ -5011,6 +5463,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulluv4hi"));
 sym___builtin_neon_vmulluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmulluv4hi->do_not_print = 1;sym___builtin_neon_vmulluv4hi->locus = builtins_locus;
@@ -5022,6 +5475,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulluv8qi"));
 sym___builtin_neon_vmulluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmulluv8qi->do_not_print = 1;sym___builtin_neon_vmulluv8qi->locus = builtins_locus;
@@ -5033,6 +5487,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_nv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_nv2sf"));
 sym___builtin_neon_vmul_nv2sf->kind = SK_FUNCTION;sym___builtin_neon_vmul_nv2sf->do_not_print = 1;sym___builtin_neon_vmul_nv2sf->locus = builtins_locus;
@@ -5044,6 +5499,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_nv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_nv2si"));
 sym___builtin_neon_vmul_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vmul_nv2si->do_not_print = 1;sym___builtin_neon_vmul_nv2si->locus = builtins_locus;
@@ -5055,6 +5511,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_nv4hi"));
 sym___builtin_neon_vmul_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmul_nv4hi->do_not_print = 1;sym___builtin_neon_vmul_nv4hi->locus = builtins_locus;
@@ -5066,6 +5523,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_nv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_nv4sf"));
 sym___builtin_neon_vmul_nv4sf->kind = SK_FUNCTION;sym___builtin_neon_vmul_nv4sf->do_not_print = 1;sym___builtin_neon_vmul_nv4sf->locus = builtins_locus;
@@ -5077,6 +5535,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_nv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_nv4si"));
 sym___builtin_neon_vmul_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vmul_nv4si->do_not_print = 1;sym___builtin_neon_vmul_nv4si->locus = builtins_locus;
@@ -5088,6 +5547,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmul_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmul_nv8hi"));
 sym___builtin_neon_vmul_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmul_nv8hi->do_not_print = 1;sym___builtin_neon_vmul_nv8hi->locus = builtins_locus;
@@ -5099,6 +5559,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmul_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulpv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulpv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulpv16qi"));
 sym___builtin_neon_vmulpv16qi->kind = SK_FUNCTION;sym___builtin_neon_vmulpv16qi->do_not_print = 1;sym___builtin_neon_vmulpv16qi->locus = builtins_locus;
@@ -5110,6 +5571,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulpv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulpv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmulpv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmulpv8qi"));
 sym___builtin_neon_vmulpv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmulpv8qi->do_not_print = 1;sym___builtin_neon_vmulpv8qi->locus = builtins_locus;
@@ -5121,6 +5583,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmulpv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmvnv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmvnv16qi"));
 sym___builtin_neon_vmvnv16qi->kind = SK_FUNCTION;sym___builtin_neon_vmvnv16qi->do_not_print = 1;sym___builtin_neon_vmvnv16qi->locus = builtins_locus;
@@ -5131,6 +5594,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmvnv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmvnv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmvnv2si"));
 sym___builtin_neon_vmvnv2si->kind = SK_FUNCTION;sym___builtin_neon_vmvnv2si->do_not_print = 1;sym___builtin_neon_vmvnv2si->locus = builtins_locus;
@@ -5141,6 +5605,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmvnv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmvnv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmvnv4hi"));
 sym___builtin_neon_vmvnv4hi->kind = SK_FUNCTION;sym___builtin_neon_vmvnv4hi->do_not_print = 1;sym___builtin_neon_vmvnv4hi->locus = builtins_locus;
@@ -5151,6 +5616,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmvnv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmvnv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmvnv4si"));
 sym___builtin_neon_vmvnv4si->kind = SK_FUNCTION;sym___builtin_neon_vmvnv4si->do_not_print = 1;sym___builtin_neon_vmvnv4si->locus = builtins_locus;
@@ -5161,6 +5627,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmvnv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmvnv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmvnv8hi"));
 sym___builtin_neon_vmvnv8hi->kind = SK_FUNCTION;sym___builtin_neon_vmvnv8hi->do_not_print = 1;sym___builtin_neon_vmvnv8hi->locus = builtins_locus;
@@ -5171,6 +5638,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmvnv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vmvnv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vmvnv8qi"));
 sym___builtin_neon_vmvnv8qi->kind = SK_FUNCTION;sym___builtin_neon_vmvnv8qi->do_not_print = 1;sym___builtin_neon_vmvnv8qi->locus = builtins_locus;
@@ -5181,6 +5649,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vmvnv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv16qi"));
 sym___builtin_neon_vnegv16qi->kind = SK_FUNCTION;sym___builtin_neon_vnegv16qi->do_not_print = 1;sym___builtin_neon_vnegv16qi->locus = builtins_locus;
@@ -5191,6 +5660,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv2sf"));
 sym___builtin_neon_vnegv2sf->kind = SK_FUNCTION;sym___builtin_neon_vnegv2sf->do_not_print = 1;sym___builtin_neon_vnegv2sf->locus = builtins_locus;
@@ -5201,6 +5671,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv2si"));
 sym___builtin_neon_vnegv2si->kind = SK_FUNCTION;sym___builtin_neon_vnegv2si->do_not_print = 1;sym___builtin_neon_vnegv2si->locus = builtins_locus;
@@ -5211,6 +5682,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv4hi"));
 sym___builtin_neon_vnegv4hi->kind = SK_FUNCTION;sym___builtin_neon_vnegv4hi->do_not_print = 1;sym___builtin_neon_vnegv4hi->locus = builtins_locus;
@@ -5221,6 +5693,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv4sf"));
 sym___builtin_neon_vnegv4sf->kind = SK_FUNCTION;sym___builtin_neon_vnegv4sf->do_not_print = 1;sym___builtin_neon_vnegv4sf->locus = builtins_locus;
@@ -5231,6 +5704,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv4si"));
 sym___builtin_neon_vnegv4si->kind = SK_FUNCTION;sym___builtin_neon_vnegv4si->do_not_print = 1;sym___builtin_neon_vnegv4si->locus = builtins_locus;
@@ -5241,6 +5715,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv8hi"));
 sym___builtin_neon_vnegv8hi->kind = SK_FUNCTION;sym___builtin_neon_vnegv8hi->do_not_print = 1;sym___builtin_neon_vnegv8hi->locus = builtins_locus;
@@ -5251,6 +5726,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vnegv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vnegv8qi"));
 sym___builtin_neon_vnegv8qi->kind = SK_FUNCTION;sym___builtin_neon_vnegv8qi->do_not_print = 1;sym___builtin_neon_vnegv8qi->locus = builtins_locus;
@@ -5261,6 +5737,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vnegv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadalsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadalsv16qi"));
 sym___builtin_neon_vpadalsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vpadalsv16qi->do_not_print = 1;sym___builtin_neon_vpadalsv16qi->locus = builtins_locus;
@@ -5272,6 +5749,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadalsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadalsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadalsv2si"));
 sym___builtin_neon_vpadalsv2si->kind = SK_FUNCTION;sym___builtin_neon_vpadalsv2si->do_not_print = 1;sym___builtin_neon_vpadalsv2si->locus = builtins_locus;
@@ -5283,6 +5761,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadalsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadalsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadalsv4hi"));
 sym___builtin_neon_vpadalsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpadalsv4hi->do_not_print = 1;sym___builtin_neon_vpadalsv4hi->locus = builtins_locus;
@@ -5294,6 +5773,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadalsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadalsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadalsv4si"));
 sym___builtin_neon_vpadalsv4si->kind = SK_FUNCTION;sym___builtin_neon_vpadalsv4si->do_not_print = 1;sym___builtin_neon_vpadalsv4si->locus = builtins_locus;
@@ -5305,6 +5785,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadalsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadalsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadalsv8hi"));
 sym___builtin_neon_vpadalsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vpadalsv8hi->do_not_print = 1;sym___builtin_neon_vpadalsv8hi->locus = builtins_locus;
@@ -5316,6 +5797,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadalsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadalsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadalsv8qi"));
 sym___builtin_neon_vpadalsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpadalsv8qi->do_not_print = 1;sym___builtin_neon_vpadalsv8qi->locus = builtins_locus;
@@ -5327,6 +5809,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadalsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadaluv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadaluv16qi"));
 sym___builtin_neon_vpadaluv16qi->kind = SK_FUNCTION;sym___builtin_neon_vpadaluv16qi->do_not_print = 1;sym___builtin_neon_vpadaluv16qi->locus = builtins_locus;
@@ -5338,6 +5821,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadaluv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadaluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadaluv2si"));
 sym___builtin_neon_vpadaluv2si->kind = SK_FUNCTION;sym___builtin_neon_vpadaluv2si->do_not_print = 1;sym___builtin_neon_vpadaluv2si->locus = builtins_locus;
@@ -5349,6 +5833,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadaluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadaluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadaluv4hi"));
 sym___builtin_neon_vpadaluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpadaluv4hi->do_not_print = 1;sym___builtin_neon_vpadaluv4hi->locus = builtins_locus;
@@ -5360,6 +5845,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadaluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadaluv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadaluv4si"));
 sym___builtin_neon_vpadaluv4si->kind = SK_FUNCTION;sym___builtin_neon_vpadaluv4si->do_not_print = 1;sym___builtin_neon_vpadaluv4si->locus = builtins_locus;
@@ -5371,6 +5857,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadaluv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadaluv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadaluv8hi"));
 sym___builtin_neon_vpadaluv8hi->kind = SK_FUNCTION;sym___builtin_neon_vpadaluv8hi->do_not_print = 1;sym___builtin_neon_vpadaluv8hi->locus = builtins_locus;
@@ -5382,6 +5869,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadaluv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpadaluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpadaluv8qi"));
 sym___builtin_neon_vpadaluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpadaluv8qi->do_not_print = 1;sym___builtin_neon_vpadaluv8qi->locus = builtins_locus;
@@ -5393,6 +5881,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpadaluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddlsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddlsv16qi"));
 sym___builtin_neon_vpaddlsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vpaddlsv16qi->do_not_print = 1;sym___builtin_neon_vpaddlsv16qi->locus = builtins_locus;
@@ -5403,6 +5892,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddlsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddlsv2si"));
 sym___builtin_neon_vpaddlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vpaddlsv2si->do_not_print = 1;sym___builtin_neon_vpaddlsv2si->locus = builtins_locus;
@@ -5413,6 +5903,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddlsv4hi"));
 sym___builtin_neon_vpaddlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpaddlsv4hi->do_not_print = 1;sym___builtin_neon_vpaddlsv4hi->locus = builtins_locus;
@@ -5423,6 +5914,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddlsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddlsv4si"));
 sym___builtin_neon_vpaddlsv4si->kind = SK_FUNCTION;sym___builtin_neon_vpaddlsv4si->do_not_print = 1;sym___builtin_neon_vpaddlsv4si->locus = builtins_locus;
@@ -5433,6 +5925,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddlsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddlsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddlsv8hi"));
 sym___builtin_neon_vpaddlsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vpaddlsv8hi->do_not_print = 1;sym___builtin_neon_vpaddlsv8hi->locus = builtins_locus;
@@ -5443,6 +5936,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddlsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddlsv8qi"));
 sym___builtin_neon_vpaddlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpaddlsv8qi->do_not_print = 1;sym___builtin_neon_vpaddlsv8qi->locus = builtins_locus;
@@ -5453,6 +5947,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddluv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddluv16qi"));
 sym___builtin_neon_vpaddluv16qi->kind = SK_FUNCTION;sym___builtin_neon_vpaddluv16qi->do_not_print = 1;sym___builtin_neon_vpaddluv16qi->locus = builtins_locus;
@@ -5463,6 +5958,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddluv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddluv2si"));
 sym___builtin_neon_vpaddluv2si->kind = SK_FUNCTION;sym___builtin_neon_vpaddluv2si->do_not_print = 1;sym___builtin_neon_vpaddluv2si->locus = builtins_locus;
@@ -5473,6 +5969,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddluv4hi"));
 sym___builtin_neon_vpaddluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpaddluv4hi->do_not_print = 1;sym___builtin_neon_vpaddluv4hi->locus = builtins_locus;
@@ -5483,6 +5980,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddluv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddluv4si"));
 sym___builtin_neon_vpaddluv4si->kind = SK_FUNCTION;sym___builtin_neon_vpaddluv4si->do_not_print = 1;sym___builtin_neon_vpaddluv4si->locus = builtins_locus;
@@ -5493,6 +5991,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddluv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddluv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddluv8hi"));
 sym___builtin_neon_vpaddluv8hi->kind = SK_FUNCTION;sym___builtin_neon_vpaddluv8hi->do_not_print = 1;sym___builtin_neon_vpaddluv8hi->locus = builtins_locus;
@@ -5503,6 +6002,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddluv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddluv8qi"));
 sym___builtin_neon_vpaddluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpaddluv8qi->do_not_print = 1;sym___builtin_neon_vpaddluv8qi->locus = builtins_locus;
@@ -5513,6 +6013,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddv2sf"));
 sym___builtin_neon_vpaddv2sf->kind = SK_FUNCTION;sym___builtin_neon_vpaddv2sf->do_not_print = 1;sym___builtin_neon_vpaddv2sf->locus = builtins_locus;
@@ -5524,6 +6025,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddv2si"));
 sym___builtin_neon_vpaddv2si->kind = SK_FUNCTION;sym___builtin_neon_vpaddv2si->do_not_print = 1;sym___builtin_neon_vpaddv2si->locus = builtins_locus;
@@ -5535,6 +6037,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddv4hi"));
 sym___builtin_neon_vpaddv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpaddv4hi->do_not_print = 1;sym___builtin_neon_vpaddv4hi->locus = builtins_locus;
@@ -5546,6 +6049,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpaddv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpaddv8qi"));
 sym___builtin_neon_vpaddv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpaddv8qi->do_not_print = 1;sym___builtin_neon_vpaddv8qi->locus = builtins_locus;
@@ -5557,6 +6061,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpaddv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxfv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxfv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxfv2sf"));
 sym___builtin_neon_vpmaxfv2sf->kind = SK_FUNCTION;sym___builtin_neon_vpmaxfv2sf->do_not_print = 1;sym___builtin_neon_vpmaxfv2sf->locus = builtins_locus;
@@ -5568,6 +6073,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxfv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxsv2si"));
 sym___builtin_neon_vpmaxsv2si->kind = SK_FUNCTION;sym___builtin_neon_vpmaxsv2si->do_not_print = 1;sym___builtin_neon_vpmaxsv2si->locus = builtins_locus;
@@ -5579,6 +6085,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxsv4hi"));
 sym___builtin_neon_vpmaxsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpmaxsv4hi->do_not_print = 1;sym___builtin_neon_vpmaxsv4hi->locus = builtins_locus;
@@ -5590,6 +6097,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxsv8qi"));
 sym___builtin_neon_vpmaxsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpmaxsv8qi->do_not_print = 1;sym___builtin_neon_vpmaxsv8qi->locus = builtins_locus;
@@ -5601,6 +6109,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxuv2si"));
 sym___builtin_neon_vpmaxuv2si->kind = SK_FUNCTION;sym___builtin_neon_vpmaxuv2si->do_not_print = 1;sym___builtin_neon_vpmaxuv2si->locus = builtins_locus;
@@ -5612,6 +6121,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxuv4hi"));
 sym___builtin_neon_vpmaxuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpmaxuv4hi->do_not_print = 1;sym___builtin_neon_vpmaxuv4hi->locus = builtins_locus;
@@ -5623,6 +6133,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpmaxuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpmaxuv8qi"));
 sym___builtin_neon_vpmaxuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpmaxuv8qi->do_not_print = 1;sym___builtin_neon_vpmaxuv8qi->locus = builtins_locus;
@@ -5634,6 +6145,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpmaxuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminfv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminfv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminfv2sf"));
 sym___builtin_neon_vpminfv2sf->kind = SK_FUNCTION;sym___builtin_neon_vpminfv2sf->do_not_print = 1;sym___builtin_neon_vpminfv2sf->locus = builtins_locus;
@@ -5645,6 +6157,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminfv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminsv2si"));
 sym___builtin_neon_vpminsv2si->kind = SK_FUNCTION;sym___builtin_neon_vpminsv2si->do_not_print = 1;sym___builtin_neon_vpminsv2si->locus = builtins_locus;
@@ -5656,6 +6169,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminsv4hi"));
 sym___builtin_neon_vpminsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpminsv4hi->do_not_print = 1;sym___builtin_neon_vpminsv4hi->locus = builtins_locus;
@@ -5667,6 +6181,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminsv8qi"));
 sym___builtin_neon_vpminsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpminsv8qi->do_not_print = 1;sym___builtin_neon_vpminsv8qi->locus = builtins_locus;
@@ -5678,6 +6193,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminuv2si"));
 sym___builtin_neon_vpminuv2si->kind = SK_FUNCTION;sym___builtin_neon_vpminuv2si->do_not_print = 1;sym___builtin_neon_vpminuv2si->locus = builtins_locus;
@@ -5689,6 +6205,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminuv4hi"));
 sym___builtin_neon_vpminuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vpminuv4hi->do_not_print = 1;sym___builtin_neon_vpminuv4hi->locus = builtins_locus;
@@ -5700,6 +6217,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vpminuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vpminuv8qi"));
 sym___builtin_neon_vpminuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vpminuv8qi->do_not_print = 1;sym___builtin_neon_vpminuv8qi->locus = builtins_locus;
@@ -5711,6 +6229,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vpminuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqabsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqabsv16qi"));
 sym___builtin_neon_vqabsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqabsv16qi->do_not_print = 1;sym___builtin_neon_vqabsv16qi->locus = builtins_locus;
@@ -5721,6 +6240,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqabsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqabsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqabsv2si"));
 sym___builtin_neon_vqabsv2si->kind = SK_FUNCTION;sym___builtin_neon_vqabsv2si->do_not_print = 1;sym___builtin_neon_vqabsv2si->locus = builtins_locus;
@@ -5731,6 +6251,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqabsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqabsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqabsv4hi"));
 sym___builtin_neon_vqabsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqabsv4hi->do_not_print = 1;sym___builtin_neon_vqabsv4hi->locus = builtins_locus;
@@ -5741,6 +6262,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqabsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqabsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqabsv4si"));
 sym___builtin_neon_vqabsv4si->kind = SK_FUNCTION;sym___builtin_neon_vqabsv4si->do_not_print = 1;sym___builtin_neon_vqabsv4si->locus = builtins_locus;
@@ -5751,6 +6273,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqabsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqabsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqabsv8hi"));
 sym___builtin_neon_vqabsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqabsv8hi->do_not_print = 1;sym___builtin_neon_vqabsv8hi->locus = builtins_locus;
@@ -5761,6 +6284,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqabsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqabsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqabsv8qi"));
 sym___builtin_neon_vqabsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqabsv8qi->do_not_print = 1;sym___builtin_neon_vqabsv8qi->locus = builtins_locus;
@@ -5771,6 +6295,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqabsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsdi"));
 sym___builtin_neon_vqaddsdi->kind = SK_FUNCTION;sym___builtin_neon_vqaddsdi->do_not_print = 1;sym___builtin_neon_vqaddsdi->locus = builtins_locus;
@@ -5782,6 +6307,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv16qi"));
 sym___builtin_neon_vqaddsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv16qi->do_not_print = 1;sym___builtin_neon_vqaddsv16qi->locus = builtins_locus;
@@ -5793,6 +6319,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv2di"));
 sym___builtin_neon_vqaddsv2di->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv2di->do_not_print = 1;sym___builtin_neon_vqaddsv2di->locus = builtins_locus;
@@ -5804,6 +6331,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv2si"));
 sym___builtin_neon_vqaddsv2si->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv2si->do_not_print = 1;sym___builtin_neon_vqaddsv2si->locus = builtins_locus;
@@ -5815,6 +6343,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv4hi"));
 sym___builtin_neon_vqaddsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv4hi->do_not_print = 1;sym___builtin_neon_vqaddsv4hi->locus = builtins_locus;
@@ -5826,6 +6355,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv4si"));
 sym___builtin_neon_vqaddsv4si->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv4si->do_not_print = 1;sym___builtin_neon_vqaddsv4si->locus = builtins_locus;
@@ -5837,6 +6367,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv8hi"));
 sym___builtin_neon_vqaddsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv8hi->do_not_print = 1;sym___builtin_neon_vqaddsv8hi->locus = builtins_locus;
@@ -5848,6 +6379,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddsv8qi"));
 sym___builtin_neon_vqaddsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqaddsv8qi->do_not_print = 1;sym___builtin_neon_vqaddsv8qi->locus = builtins_locus;
@@ -5859,6 +6391,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddudi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqaddudi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqaddudi"));
 sym___builtin_neon_vqaddudi->kind = SK_FUNCTION;sym___builtin_neon_vqaddudi->do_not_print = 1;sym___builtin_neon_vqaddudi->locus = builtins_locus;
@@ -5870,6 +6403,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqaddudi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv16qi"));
 sym___builtin_neon_vqadduv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqadduv16qi->do_not_print = 1;sym___builtin_neon_vqadduv16qi->locus = builtins_locus;
@@ -5881,6 +6415,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv2di"));
 sym___builtin_neon_vqadduv2di->kind = SK_FUNCTION;sym___builtin_neon_vqadduv2di->do_not_print = 1;sym___builtin_neon_vqadduv2di->locus = builtins_locus;
@@ -5892,6 +6427,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv2si"));
 sym___builtin_neon_vqadduv2si->kind = SK_FUNCTION;sym___builtin_neon_vqadduv2si->do_not_print = 1;sym___builtin_neon_vqadduv2si->locus = builtins_locus;
@@ -5903,6 +6439,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv4hi"));
 sym___builtin_neon_vqadduv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqadduv4hi->do_not_print = 1;sym___builtin_neon_vqadduv4hi->locus = builtins_locus;
@@ -5914,6 +6451,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv4si"));
 sym___builtin_neon_vqadduv4si->kind = SK_FUNCTION;sym___builtin_neon_vqadduv4si->do_not_print = 1;sym___builtin_neon_vqadduv4si->locus = builtins_locus;
@@ -5925,6 +6463,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv8hi"));
 sym___builtin_neon_vqadduv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqadduv8hi->do_not_print = 1;sym___builtin_neon_vqadduv8hi->locus = builtins_locus;
@@ -5936,6 +6475,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqadduv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqadduv8qi"));
 sym___builtin_neon_vqadduv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqadduv8qi->do_not_print = 1;sym___builtin_neon_vqadduv8qi->locus = builtins_locus;
@@ -5947,6 +6487,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqadduv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlal_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlal_lanev2si"));
 sym___builtin_neon_vqdmlal_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmlal_lanev2si->do_not_print = 1;sym___builtin_neon_vqdmlal_lanev2si->locus = builtins_locus;
@@ -5960,6 +6501,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlal_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlal_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlal_lanev4hi"));
 sym___builtin_neon_vqdmlal_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmlal_lanev4hi->do_not_print = 1;sym___builtin_neon_vqdmlal_lanev4hi->locus = builtins_locus;
@@ -5973,6 +6515,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlal_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlal_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlal_nv2si"));
 sym___builtin_neon_vqdmlal_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmlal_nv2si->do_not_print = 1;sym___builtin_neon_vqdmlal_nv2si->locus = builtins_locus;
@@ -5985,6 +6528,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlal_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlal_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlal_nv4hi"));
 sym___builtin_neon_vqdmlal_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmlal_nv4hi->do_not_print = 1;sym___builtin_neon_vqdmlal_nv4hi->locus = builtins_locus;
@@ -5997,6 +6541,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlal_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlalv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlalv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlalv2si"));
 sym___builtin_neon_vqdmlalv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmlalv2si->do_not_print = 1;sym___builtin_neon_vqdmlalv2si->locus = builtins_locus;
@@ -6009,6 +6554,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlalv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlalv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlalv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlalv4hi"));
 sym___builtin_neon_vqdmlalv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmlalv4hi->do_not_print = 1;sym___builtin_neon_vqdmlalv4hi->locus = builtins_locus;
@@ -6021,6 +6567,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlalv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlsl_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlsl_lanev2si"));
 sym___builtin_neon_vqdmlsl_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmlsl_lanev2si->do_not_print = 1;sym___builtin_neon_vqdmlsl_lanev2si->locus = builtins_locus;
@@ -6034,6 +6581,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlsl_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlsl_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlsl_lanev4hi"));
 sym___builtin_neon_vqdmlsl_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmlsl_lanev4hi->do_not_print = 1;sym___builtin_neon_vqdmlsl_lanev4hi->locus = builtins_locus;
@@ -6047,6 +6595,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlsl_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlsl_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlsl_nv2si"));
 sym___builtin_neon_vqdmlsl_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmlsl_nv2si->do_not_print = 1;sym___builtin_neon_vqdmlsl_nv2si->locus = builtins_locus;
@@ -6059,6 +6608,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlsl_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlsl_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlsl_nv4hi"));
 sym___builtin_neon_vqdmlsl_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmlsl_nv4hi->do_not_print = 1;sym___builtin_neon_vqdmlsl_nv4hi->locus = builtins_locus;
@@ -6071,6 +6621,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlsl_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlslv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlslv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlslv2si"));
 sym___builtin_neon_vqdmlslv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmlslv2si->do_not_print = 1;sym___builtin_neon_vqdmlslv2si->locus = builtins_locus;
@@ -6083,6 +6634,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlslv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlslv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmlslv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmlslv4hi"));
 sym___builtin_neon_vqdmlslv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmlslv4hi->do_not_print = 1;sym___builtin_neon_vqdmlslv4hi->locus = builtins_locus;
@@ -6095,6 +6647,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmlslv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_lanev2si"));
 sym___builtin_neon_vqdmulh_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_lanev2si->do_not_print = 1;sym___builtin_neon_vqdmulh_lanev2si->locus = builtins_locus;
@@ -6107,6 +6660,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_lanev4hi"));
 sym___builtin_neon_vqdmulh_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_lanev4hi->do_not_print = 1;sym___builtin_neon_vqdmulh_lanev4hi->locus = builtins_locus;
@@ -6119,6 +6673,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_lanev4si"));
 sym___builtin_neon_vqdmulh_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_lanev4si->do_not_print = 1;sym___builtin_neon_vqdmulh_lanev4si->locus = builtins_locus;
@@ -6131,6 +6686,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_lanev8hi"));
 sym___builtin_neon_vqdmulh_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_lanev8hi->do_not_print = 1;sym___builtin_neon_vqdmulh_lanev8hi->locus = builtins_locus;
@@ -6143,6 +6699,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_nv2si"));
 sym___builtin_neon_vqdmulh_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_nv2si->do_not_print = 1;sym___builtin_neon_vqdmulh_nv2si->locus = builtins_locus;
@@ -6154,6 +6711,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_nv4hi"));
 sym___builtin_neon_vqdmulh_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_nv4hi->do_not_print = 1;sym___builtin_neon_vqdmulh_nv4hi->locus = builtins_locus;
@@ -6165,6 +6723,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_nv4si"));
 sym___builtin_neon_vqdmulh_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_nv4si->do_not_print = 1;sym___builtin_neon_vqdmulh_nv4si->locus = builtins_locus;
@@ -6176,6 +6735,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulh_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulh_nv8hi"));
 sym___builtin_neon_vqdmulh_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmulh_nv8hi->do_not_print = 1;sym___builtin_neon_vqdmulh_nv8hi->locus = builtins_locus;
@@ -6187,6 +6747,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulh_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulhv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulhv2si"));
 sym___builtin_neon_vqdmulhv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmulhv2si->do_not_print = 1;sym___builtin_neon_vqdmulhv2si->locus = builtins_locus;
@@ -6198,6 +6759,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulhv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulhv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulhv4hi"));
 sym___builtin_neon_vqdmulhv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmulhv4hi->do_not_print = 1;sym___builtin_neon_vqdmulhv4hi->locus = builtins_locus;
@@ -6209,6 +6771,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulhv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulhv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulhv4si"));
 sym___builtin_neon_vqdmulhv4si->kind = SK_FUNCTION;sym___builtin_neon_vqdmulhv4si->do_not_print = 1;sym___builtin_neon_vqdmulhv4si->locus = builtins_locus;
@@ -6220,6 +6783,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulhv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmulhv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmulhv8hi"));
 sym___builtin_neon_vqdmulhv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmulhv8hi->do_not_print = 1;sym___builtin_neon_vqdmulhv8hi->locus = builtins_locus;
@@ -6231,6 +6795,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmulhv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmull_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmull_lanev2si"));
 sym___builtin_neon_vqdmull_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmull_lanev2si->do_not_print = 1;sym___builtin_neon_vqdmull_lanev2si->locus = builtins_locus;
@@ -6243,6 +6808,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmull_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmull_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmull_lanev4hi"));
 sym___builtin_neon_vqdmull_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmull_lanev4hi->do_not_print = 1;sym___builtin_neon_vqdmull_lanev4hi->locus = builtins_locus;
@@ -6255,6 +6821,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmull_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmull_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmull_nv2si"));
 sym___builtin_neon_vqdmull_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmull_nv2si->do_not_print = 1;sym___builtin_neon_vqdmull_nv2si->locus = builtins_locus;
@@ -6266,6 +6833,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmull_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmull_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmull_nv4hi"));
 sym___builtin_neon_vqdmull_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmull_nv4hi->do_not_print = 1;sym___builtin_neon_vqdmull_nv4hi->locus = builtins_locus;
@@ -6277,6 +6845,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmull_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmullv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmullv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmullv2si"));
 sym___builtin_neon_vqdmullv2si->kind = SK_FUNCTION;sym___builtin_neon_vqdmullv2si->do_not_print = 1;sym___builtin_neon_vqdmullv2si->locus = builtins_locus;
@@ -6288,6 +6857,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmullv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmullv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqdmullv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqdmullv4hi"));
 sym___builtin_neon_vqdmullv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqdmullv4hi->do_not_print = 1;sym___builtin_neon_vqdmullv4hi->locus = builtins_locus;
@@ -6299,6 +6869,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqdmullv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovnsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovnsv2di"));
 sym___builtin_neon_vqmovnsv2di->kind = SK_FUNCTION;sym___builtin_neon_vqmovnsv2di->do_not_print = 1;sym___builtin_neon_vqmovnsv2di->locus = builtins_locus;
@@ -6309,6 +6880,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovnsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovnsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovnsv4si"));
 sym___builtin_neon_vqmovnsv4si->kind = SK_FUNCTION;sym___builtin_neon_vqmovnsv4si->do_not_print = 1;sym___builtin_neon_vqmovnsv4si->locus = builtins_locus;
@@ -6319,6 +6891,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovnsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovnsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovnsv8hi"));
 sym___builtin_neon_vqmovnsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqmovnsv8hi->do_not_print = 1;sym___builtin_neon_vqmovnsv8hi->locus = builtins_locus;
@@ -6329,6 +6902,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovnsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnuv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovnuv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovnuv2di"));
 sym___builtin_neon_vqmovnuv2di->kind = SK_FUNCTION;sym___builtin_neon_vqmovnuv2di->do_not_print = 1;sym___builtin_neon_vqmovnuv2di->locus = builtins_locus;
@@ -6339,6 +6913,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovnuv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovnuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovnuv4si"));
 sym___builtin_neon_vqmovnuv4si->kind = SK_FUNCTION;sym___builtin_neon_vqmovnuv4si->do_not_print = 1;sym___builtin_neon_vqmovnuv4si->locus = builtins_locus;
@@ -6349,6 +6924,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovnuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovnuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovnuv8hi"));
 sym___builtin_neon_vqmovnuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqmovnuv8hi->do_not_print = 1;sym___builtin_neon_vqmovnuv8hi->locus = builtins_locus;
@@ -6359,6 +6935,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovnuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovunv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovunv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovunv2di"));
 sym___builtin_neon_vqmovunv2di->kind = SK_FUNCTION;sym___builtin_neon_vqmovunv2di->do_not_print = 1;sym___builtin_neon_vqmovunv2di->locus = builtins_locus;
@@ -6369,6 +6946,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovunv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovunv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovunv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovunv4si"));
 sym___builtin_neon_vqmovunv4si->kind = SK_FUNCTION;sym___builtin_neon_vqmovunv4si->do_not_print = 1;sym___builtin_neon_vqmovunv4si->locus = builtins_locus;
@@ -6379,6 +6957,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovunv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovunv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqmovunv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqmovunv8hi"));
 sym___builtin_neon_vqmovunv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqmovunv8hi->do_not_print = 1;sym___builtin_neon_vqmovunv8hi->locus = builtins_locus;
@@ -6389,6 +6968,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqmovunv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqnegv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqnegv16qi"));
 sym___builtin_neon_vqnegv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqnegv16qi->do_not_print = 1;sym___builtin_neon_vqnegv16qi->locus = builtins_locus;
@@ -6399,6 +6979,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqnegv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqnegv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqnegv2si"));
 sym___builtin_neon_vqnegv2si->kind = SK_FUNCTION;sym___builtin_neon_vqnegv2si->do_not_print = 1;sym___builtin_neon_vqnegv2si->locus = builtins_locus;
@@ -6409,6 +6990,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqnegv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqnegv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqnegv4hi"));
 sym___builtin_neon_vqnegv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqnegv4hi->do_not_print = 1;sym___builtin_neon_vqnegv4hi->locus = builtins_locus;
@@ -6419,6 +7001,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqnegv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqnegv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqnegv4si"));
 sym___builtin_neon_vqnegv4si->kind = SK_FUNCTION;sym___builtin_neon_vqnegv4si->do_not_print = 1;sym___builtin_neon_vqnegv4si->locus = builtins_locus;
@@ -6429,6 +7012,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqnegv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqnegv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqnegv8hi"));
 sym___builtin_neon_vqnegv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqnegv8hi->do_not_print = 1;sym___builtin_neon_vqnegv8hi->locus = builtins_locus;
@@ -6439,6 +7023,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqnegv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqnegv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqnegv8qi"));
 sym___builtin_neon_vqnegv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqnegv8qi->do_not_print = 1;sym___builtin_neon_vqnegv8qi->locus = builtins_locus;
@@ -6449,6 +7034,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqnegv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_lanev2si"));
 sym___builtin_neon_vqrdmulh_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_lanev2si->do_not_print = 1;sym___builtin_neon_vqrdmulh_lanev2si->locus = builtins_locus;
@@ -6461,6 +7047,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_lanev4hi"));
 sym___builtin_neon_vqrdmulh_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_lanev4hi->do_not_print = 1;sym___builtin_neon_vqrdmulh_lanev4hi->locus = builtins_locus;
@@ -6473,6 +7060,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_lanev4si"));
 sym___builtin_neon_vqrdmulh_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_lanev4si->do_not_print = 1;sym___builtin_neon_vqrdmulh_lanev4si->locus = builtins_locus;
@@ -6485,6 +7073,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_lanev8hi"));
 sym___builtin_neon_vqrdmulh_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_lanev8hi->do_not_print = 1;sym___builtin_neon_vqrdmulh_lanev8hi->locus = builtins_locus;
@@ -6497,6 +7086,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_nv2si"));
 sym___builtin_neon_vqrdmulh_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_nv2si->do_not_print = 1;sym___builtin_neon_vqrdmulh_nv2si->locus = builtins_locus;
@@ -6508,6 +7098,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_nv4hi"));
 sym___builtin_neon_vqrdmulh_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_nv4hi->do_not_print = 1;sym___builtin_neon_vqrdmulh_nv4hi->locus = builtins_locus;
@@ -6519,6 +7110,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_nv4si"));
 sym___builtin_neon_vqrdmulh_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_nv4si->do_not_print = 1;sym___builtin_neon_vqrdmulh_nv4si->locus = builtins_locus;
@@ -6530,6 +7122,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulh_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulh_nv8hi"));
 sym___builtin_neon_vqrdmulh_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulh_nv8hi->do_not_print = 1;sym___builtin_neon_vqrdmulh_nv8hi->locus = builtins_locus;
@@ -6541,6 +7134,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulh_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulhv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulhv2si"));
 sym___builtin_neon_vqrdmulhv2si->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulhv2si->do_not_print = 1;sym___builtin_neon_vqrdmulhv2si->locus = builtins_locus;
@@ -6552,6 +7146,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulhv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulhv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulhv4hi"));
 sym___builtin_neon_vqrdmulhv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulhv4hi->do_not_print = 1;sym___builtin_neon_vqrdmulhv4hi->locus = builtins_locus;
@@ -6563,6 +7158,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulhv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulhv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulhv4si"));
 sym___builtin_neon_vqrdmulhv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulhv4si->do_not_print = 1;sym___builtin_neon_vqrdmulhv4si->locus = builtins_locus;
@@ -6574,6 +7170,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulhv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrdmulhv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrdmulhv8hi"));
 sym___builtin_neon_vqrdmulhv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrdmulhv8hi->do_not_print = 1;sym___builtin_neon_vqrdmulhv8hi->locus = builtins_locus;
@@ -6585,6 +7182,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrdmulhv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsdi"));
 sym___builtin_neon_vqrshlsdi->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsdi->do_not_print = 1;sym___builtin_neon_vqrshlsdi->locus = builtins_locus;
@@ -6596,6 +7194,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv16qi"));
 sym___builtin_neon_vqrshlsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv16qi->do_not_print = 1;sym___builtin_neon_vqrshlsv16qi->locus = builtins_locus;
@@ -6607,6 +7206,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv2di"));
 sym___builtin_neon_vqrshlsv2di->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv2di->do_not_print = 1;sym___builtin_neon_vqrshlsv2di->locus = builtins_locus;
@@ -6618,6 +7218,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv2si"));
 sym___builtin_neon_vqrshlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv2si->do_not_print = 1;sym___builtin_neon_vqrshlsv2si->locus = builtins_locus;
@@ -6629,6 +7230,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv4hi"));
 sym___builtin_neon_vqrshlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv4hi->do_not_print = 1;sym___builtin_neon_vqrshlsv4hi->locus = builtins_locus;
@@ -6640,6 +7242,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv4si"));
 sym___builtin_neon_vqrshlsv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv4si->do_not_print = 1;sym___builtin_neon_vqrshlsv4si->locus = builtins_locus;
@@ -6651,6 +7254,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv8hi"));
 sym___builtin_neon_vqrshlsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv8hi->do_not_print = 1;sym___builtin_neon_vqrshlsv8hi->locus = builtins_locus;
@@ -6662,6 +7266,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshlsv8qi"));
 sym___builtin_neon_vqrshlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqrshlsv8qi->do_not_print = 1;sym___builtin_neon_vqrshlsv8qi->locus = builtins_locus;
@@ -6673,6 +7278,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshludi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshludi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshludi"));
 sym___builtin_neon_vqrshludi->kind = SK_FUNCTION;sym___builtin_neon_vqrshludi->do_not_print = 1;sym___builtin_neon_vqrshludi->locus = builtins_locus;
@@ -6684,6 +7290,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshludi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv16qi"));
 sym___builtin_neon_vqrshluv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv16qi->do_not_print = 1;sym___builtin_neon_vqrshluv16qi->locus = builtins_locus;
@@ -6695,6 +7302,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv2di"));
 sym___builtin_neon_vqrshluv2di->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv2di->do_not_print = 1;sym___builtin_neon_vqrshluv2di->locus = builtins_locus;
@@ -6706,6 +7314,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv2si"));
 sym___builtin_neon_vqrshluv2si->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv2si->do_not_print = 1;sym___builtin_neon_vqrshluv2si->locus = builtins_locus;
@@ -6717,6 +7326,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv4hi"));
 sym___builtin_neon_vqrshluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv4hi->do_not_print = 1;sym___builtin_neon_vqrshluv4hi->locus = builtins_locus;
@@ -6728,6 +7338,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv4si"));
 sym___builtin_neon_vqrshluv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv4si->do_not_print = 1;sym___builtin_neon_vqrshluv4si->locus = builtins_locus;
@@ -6739,6 +7350,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv8hi"));
 sym___builtin_neon_vqrshluv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv8hi->do_not_print = 1;sym___builtin_neon_vqrshluv8hi->locus = builtins_locus;
@@ -6750,6 +7362,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshluv8qi"));
 sym___builtin_neon_vqrshluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqrshluv8qi->do_not_print = 1;sym___builtin_neon_vqrshluv8qi->locus = builtins_locus;
@@ -6761,6 +7374,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrns_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrns_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrns_nv2di"));
 sym___builtin_neon_vqrshrns_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqrshrns_nv2di->do_not_print = 1;sym___builtin_neon_vqrshrns_nv2di->locus = builtins_locus;
@@ -6772,6 +7386,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrns_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrns_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrns_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrns_nv4si"));
 sym___builtin_neon_vqrshrns_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrshrns_nv4si->do_not_print = 1;sym___builtin_neon_vqrshrns_nv4si->locus = builtins_locus;
@@ -6783,6 +7398,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrns_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrns_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrns_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrns_nv8hi"));
 sym___builtin_neon_vqrshrns_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshrns_nv8hi->do_not_print = 1;sym___builtin_neon_vqrshrns_nv8hi->locus = builtins_locus;
@@ -6794,6 +7410,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrns_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrnu_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrnu_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrnu_nv2di"));
 sym___builtin_neon_vqrshrnu_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqrshrnu_nv2di->do_not_print = 1;sym___builtin_neon_vqrshrnu_nv2di->locus = builtins_locus;
@@ -6805,6 +7422,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrnu_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrnu_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrnu_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrnu_nv4si"));
 sym___builtin_neon_vqrshrnu_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrshrnu_nv4si->do_not_print = 1;sym___builtin_neon_vqrshrnu_nv4si->locus = builtins_locus;
@@ -6816,6 +7434,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrnu_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrnu_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrnu_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrnu_nv8hi"));
 sym___builtin_neon_vqrshrnu_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshrnu_nv8hi->do_not_print = 1;sym___builtin_neon_vqrshrnu_nv8hi->locus = builtins_locus;
@@ -6827,6 +7446,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrnu_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrun_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrun_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrun_nv2di"));
 sym___builtin_neon_vqrshrun_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqrshrun_nv2di->do_not_print = 1;sym___builtin_neon_vqrshrun_nv2di->locus = builtins_locus;
@@ -6838,6 +7458,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrun_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrun_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrun_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrun_nv4si"));
 sym___builtin_neon_vqrshrun_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqrshrun_nv4si->do_not_print = 1;sym___builtin_neon_vqrshrun_nv4si->locus = builtins_locus;
@@ -6849,6 +7470,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrun_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrun_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqrshrun_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqrshrun_nv8hi"));
 sym___builtin_neon_vqrshrun_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqrshrun_nv8hi->do_not_print = 1;sym___builtin_neon_vqrshrun_nv8hi->locus = builtins_locus;
@@ -6860,6 +7482,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqrshrun_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsdi"));
 sym___builtin_neon_vqshlsdi->kind = SK_FUNCTION;sym___builtin_neon_vqshlsdi->do_not_print = 1;sym___builtin_neon_vqshlsdi->locus = builtins_locus;
@@ -6871,6 +7494,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_ndi"));
 sym___builtin_neon_vqshl_s_ndi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_ndi->do_not_print = 1;sym___builtin_neon_vqshl_s_ndi->locus = builtins_locus;
@@ -6882,6 +7506,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv16qi"));
 sym___builtin_neon_vqshl_s_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv16qi->do_not_print = 1;sym___builtin_neon_vqshl_s_nv16qi->locus = builtins_locus;
@@ -6893,6 +7518,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv2di"));
 sym___builtin_neon_vqshl_s_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv2di->do_not_print = 1;sym___builtin_neon_vqshl_s_nv2di->locus = builtins_locus;
@@ -6904,6 +7530,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv2si"));
 sym___builtin_neon_vqshl_s_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv2si->do_not_print = 1;sym___builtin_neon_vqshl_s_nv2si->locus = builtins_locus;
@@ -6915,6 +7542,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv4hi"));
 sym___builtin_neon_vqshl_s_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv4hi->do_not_print = 1;sym___builtin_neon_vqshl_s_nv4hi->locus = builtins_locus;
@@ -6926,6 +7554,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv4si"));
 sym___builtin_neon_vqshl_s_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv4si->do_not_print = 1;sym___builtin_neon_vqshl_s_nv4si->locus = builtins_locus;
@@ -6937,6 +7566,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv8hi"));
 sym___builtin_neon_vqshl_s_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv8hi->do_not_print = 1;sym___builtin_neon_vqshl_s_nv8hi->locus = builtins_locus;
@@ -6948,6 +7578,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_s_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_s_nv8qi"));
 sym___builtin_neon_vqshl_s_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_s_nv8qi->do_not_print = 1;sym___builtin_neon_vqshl_s_nv8qi->locus = builtins_locus;
@@ -6959,6 +7590,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_s_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv16qi"));
 sym___builtin_neon_vqshlsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv16qi->do_not_print = 1;sym___builtin_neon_vqshlsv16qi->locus = builtins_locus;
@@ -6970,6 +7602,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv2di"));
 sym___builtin_neon_vqshlsv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv2di->do_not_print = 1;sym___builtin_neon_vqshlsv2di->locus = builtins_locus;
@@ -6981,6 +7614,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv2si"));
 sym___builtin_neon_vqshlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv2si->do_not_print = 1;sym___builtin_neon_vqshlsv2si->locus = builtins_locus;
@@ -6992,6 +7626,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv4hi"));
 sym___builtin_neon_vqshlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv4hi->do_not_print = 1;sym___builtin_neon_vqshlsv4hi->locus = builtins_locus;
@@ -7003,6 +7638,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv4si"));
 sym___builtin_neon_vqshlsv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv4si->do_not_print = 1;sym___builtin_neon_vqshlsv4si->locus = builtins_locus;
@@ -7014,6 +7650,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv8hi"));
 sym___builtin_neon_vqshlsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv8hi->do_not_print = 1;sym___builtin_neon_vqshlsv8hi->locus = builtins_locus;
@@ -7025,6 +7662,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlsv8qi"));
 sym___builtin_neon_vqshlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqshlsv8qi->do_not_print = 1;sym___builtin_neon_vqshlsv8qi->locus = builtins_locus;
@@ -7036,6 +7674,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshludi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshludi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshludi"));
 sym___builtin_neon_vqshludi->kind = SK_FUNCTION;sym___builtin_neon_vqshludi->do_not_print = 1;sym___builtin_neon_vqshludi->locus = builtins_locus;
@@ -7047,6 +7686,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshludi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_ndi"));
 sym___builtin_neon_vqshl_u_ndi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_ndi->do_not_print = 1;sym___builtin_neon_vqshl_u_ndi->locus = builtins_locus;
@@ -7058,6 +7698,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_ndi"));
 sym___builtin_neon_vqshlu_ndi->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_ndi->do_not_print = 1;sym___builtin_neon_vqshlu_ndi->locus = builtins_locus;
@@ -7069,6 +7710,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv16qi"));
 sym___builtin_neon_vqshl_u_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv16qi->do_not_print = 1;sym___builtin_neon_vqshl_u_nv16qi->locus = builtins_locus;
@@ -7080,6 +7722,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv16qi"));
 sym___builtin_neon_vqshlu_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv16qi->do_not_print = 1;sym___builtin_neon_vqshlu_nv16qi->locus = builtins_locus;
@@ -7091,6 +7734,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv2di"));
 sym___builtin_neon_vqshl_u_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv2di->do_not_print = 1;sym___builtin_neon_vqshl_u_nv2di->locus = builtins_locus;
@@ -7102,6 +7746,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv2di"));
 sym___builtin_neon_vqshlu_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv2di->do_not_print = 1;sym___builtin_neon_vqshlu_nv2di->locus = builtins_locus;
@@ -7113,6 +7758,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv2si"));
 sym___builtin_neon_vqshl_u_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv2si->do_not_print = 1;sym___builtin_neon_vqshl_u_nv2si->locus = builtins_locus;
@@ -7124,6 +7770,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv2si"));
 sym___builtin_neon_vqshlu_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv2si->do_not_print = 1;sym___builtin_neon_vqshlu_nv2si->locus = builtins_locus;
@@ -7135,6 +7782,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv4hi"));
 sym___builtin_neon_vqshl_u_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv4hi->do_not_print = 1;sym___builtin_neon_vqshl_u_nv4hi->locus = builtins_locus;
@@ -7146,6 +7794,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv4hi"));
 sym___builtin_neon_vqshlu_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv4hi->do_not_print = 1;sym___builtin_neon_vqshlu_nv4hi->locus = builtins_locus;
@@ -7157,6 +7806,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv4si"));
 sym___builtin_neon_vqshl_u_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv4si->do_not_print = 1;sym___builtin_neon_vqshl_u_nv4si->locus = builtins_locus;
@@ -7168,6 +7818,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv4si"));
 sym___builtin_neon_vqshlu_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv4si->do_not_print = 1;sym___builtin_neon_vqshlu_nv4si->locus = builtins_locus;
@@ -7179,6 +7830,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv8hi"));
 sym___builtin_neon_vqshl_u_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv8hi->do_not_print = 1;sym___builtin_neon_vqshl_u_nv8hi->locus = builtins_locus;
@@ -7190,6 +7842,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv8hi"));
 sym___builtin_neon_vqshlu_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv8hi->do_not_print = 1;sym___builtin_neon_vqshlu_nv8hi->locus = builtins_locus;
@@ -7201,6 +7854,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshl_u_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshl_u_nv8qi"));
 sym___builtin_neon_vqshl_u_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqshl_u_nv8qi->do_not_print = 1;sym___builtin_neon_vqshl_u_nv8qi->locus = builtins_locus;
@@ -7212,6 +7866,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshl_u_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshlu_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshlu_nv8qi"));
 sym___builtin_neon_vqshlu_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqshlu_nv8qi->do_not_print = 1;sym___builtin_neon_vqshlu_nv8qi->locus = builtins_locus;
@@ -7223,6 +7878,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshlu_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv16qi"));
 sym___builtin_neon_vqshluv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqshluv16qi->do_not_print = 1;sym___builtin_neon_vqshluv16qi->locus = builtins_locus;
@@ -7234,6 +7890,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv2di"));
 sym___builtin_neon_vqshluv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshluv2di->do_not_print = 1;sym___builtin_neon_vqshluv2di->locus = builtins_locus;
@@ -7245,6 +7902,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv2si"));
 sym___builtin_neon_vqshluv2si->kind = SK_FUNCTION;sym___builtin_neon_vqshluv2si->do_not_print = 1;sym___builtin_neon_vqshluv2si->locus = builtins_locus;
@@ -7256,6 +7914,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv4hi"));
 sym___builtin_neon_vqshluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqshluv4hi->do_not_print = 1;sym___builtin_neon_vqshluv4hi->locus = builtins_locus;
@@ -7267,6 +7926,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv4si"));
 sym___builtin_neon_vqshluv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshluv4si->do_not_print = 1;sym___builtin_neon_vqshluv4si->locus = builtins_locus;
@@ -7278,6 +7938,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv8hi"));
 sym___builtin_neon_vqshluv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshluv8hi->do_not_print = 1;sym___builtin_neon_vqshluv8hi->locus = builtins_locus;
@@ -7289,6 +7950,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshluv8qi"));
 sym___builtin_neon_vqshluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqshluv8qi->do_not_print = 1;sym___builtin_neon_vqshluv8qi->locus = builtins_locus;
@@ -7300,6 +7962,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrns_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrns_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrns_nv2di"));
 sym___builtin_neon_vqshrns_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshrns_nv2di->do_not_print = 1;sym___builtin_neon_vqshrns_nv2di->locus = builtins_locus;
@@ -7311,6 +7974,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrns_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrns_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrns_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrns_nv4si"));
 sym___builtin_neon_vqshrns_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshrns_nv4si->do_not_print = 1;sym___builtin_neon_vqshrns_nv4si->locus = builtins_locus;
@@ -7322,6 +7986,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrns_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrns_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrns_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrns_nv8hi"));
 sym___builtin_neon_vqshrns_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshrns_nv8hi->do_not_print = 1;sym___builtin_neon_vqshrns_nv8hi->locus = builtins_locus;
@@ -7333,6 +7998,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrns_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrnu_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrnu_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrnu_nv2di"));
 sym___builtin_neon_vqshrnu_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshrnu_nv2di->do_not_print = 1;sym___builtin_neon_vqshrnu_nv2di->locus = builtins_locus;
@@ -7344,6 +8010,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrnu_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrnu_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrnu_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrnu_nv4si"));
 sym___builtin_neon_vqshrnu_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshrnu_nv4si->do_not_print = 1;sym___builtin_neon_vqshrnu_nv4si->locus = builtins_locus;
@@ -7355,6 +8022,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrnu_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrnu_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrnu_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrnu_nv8hi"));
 sym___builtin_neon_vqshrnu_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshrnu_nv8hi->do_not_print = 1;sym___builtin_neon_vqshrnu_nv8hi->locus = builtins_locus;
@@ -7366,6 +8034,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrnu_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrun_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrun_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrun_nv2di"));
 sym___builtin_neon_vqshrun_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vqshrun_nv2di->do_not_print = 1;sym___builtin_neon_vqshrun_nv2di->locus = builtins_locus;
@@ -7377,6 +8046,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrun_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrun_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrun_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrun_nv4si"));
 sym___builtin_neon_vqshrun_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vqshrun_nv4si->do_not_print = 1;sym___builtin_neon_vqshrun_nv4si->locus = builtins_locus;
@@ -7388,6 +8058,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrun_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrun_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqshrun_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqshrun_nv8hi"));
 sym___builtin_neon_vqshrun_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqshrun_nv8hi->do_not_print = 1;sym___builtin_neon_vqshrun_nv8hi->locus = builtins_locus;
@@ -7399,6 +8070,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqshrun_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsdi"));
 sym___builtin_neon_vqsubsdi->kind = SK_FUNCTION;sym___builtin_neon_vqsubsdi->do_not_print = 1;sym___builtin_neon_vqsubsdi->locus = builtins_locus;
@@ -7410,6 +8082,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv16qi"));
 sym___builtin_neon_vqsubsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv16qi->do_not_print = 1;sym___builtin_neon_vqsubsv16qi->locus = builtins_locus;
@@ -7421,6 +8094,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv2di"));
 sym___builtin_neon_vqsubsv2di->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv2di->do_not_print = 1;sym___builtin_neon_vqsubsv2di->locus = builtins_locus;
@@ -7432,6 +8106,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv2si"));
 sym___builtin_neon_vqsubsv2si->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv2si->do_not_print = 1;sym___builtin_neon_vqsubsv2si->locus = builtins_locus;
@@ -7443,6 +8118,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv4hi"));
 sym___builtin_neon_vqsubsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv4hi->do_not_print = 1;sym___builtin_neon_vqsubsv4hi->locus = builtins_locus;
@@ -7454,6 +8130,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv4si"));
 sym___builtin_neon_vqsubsv4si->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv4si->do_not_print = 1;sym___builtin_neon_vqsubsv4si->locus = builtins_locus;
@@ -7465,6 +8142,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv8hi"));
 sym___builtin_neon_vqsubsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv8hi->do_not_print = 1;sym___builtin_neon_vqsubsv8hi->locus = builtins_locus;
@@ -7476,6 +8154,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubsv8qi"));
 sym___builtin_neon_vqsubsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqsubsv8qi->do_not_print = 1;sym___builtin_neon_vqsubsv8qi->locus = builtins_locus;
@@ -7487,6 +8166,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubudi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubudi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubudi"));
 sym___builtin_neon_vqsubudi->kind = SK_FUNCTION;sym___builtin_neon_vqsubudi->do_not_print = 1;sym___builtin_neon_vqsubudi->locus = builtins_locus;
@@ -7498,6 +8178,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubudi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv16qi"));
 sym___builtin_neon_vqsubuv16qi->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv16qi->do_not_print = 1;sym___builtin_neon_vqsubuv16qi->locus = builtins_locus;
@@ -7509,6 +8190,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv2di"));
 sym___builtin_neon_vqsubuv2di->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv2di->do_not_print = 1;sym___builtin_neon_vqsubuv2di->locus = builtins_locus;
@@ -7520,6 +8202,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv2si"));
 sym___builtin_neon_vqsubuv2si->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv2si->do_not_print = 1;sym___builtin_neon_vqsubuv2si->locus = builtins_locus;
@@ -7531,6 +8214,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv4hi"));
 sym___builtin_neon_vqsubuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv4hi->do_not_print = 1;sym___builtin_neon_vqsubuv4hi->locus = builtins_locus;
@@ -7542,6 +8226,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv4si"));
 sym___builtin_neon_vqsubuv4si->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv4si->do_not_print = 1;sym___builtin_neon_vqsubuv4si->locus = builtins_locus;
@@ -7553,6 +8238,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv8hi"));
 sym___builtin_neon_vqsubuv8hi->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv8hi->do_not_print = 1;sym___builtin_neon_vqsubuv8hi->locus = builtins_locus;
@@ -7564,6 +8250,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vqsubuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vqsubuv8qi"));
 sym___builtin_neon_vqsubuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vqsubuv8qi->do_not_print = 1;sym___builtin_neon_vqsubuv8qi->locus = builtins_locus;
@@ -7575,6 +8262,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vqsubuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vraddhnv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vraddhnv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vraddhnv2di"));
 sym___builtin_neon_vraddhnv2di->kind = SK_FUNCTION;sym___builtin_neon_vraddhnv2di->do_not_print = 1;sym___builtin_neon_vraddhnv2di->locus = builtins_locus;
@@ -7586,6 +8274,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vraddhnv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vraddhnv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vraddhnv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vraddhnv4si"));
 sym___builtin_neon_vraddhnv4si->kind = SK_FUNCTION;sym___builtin_neon_vraddhnv4si->do_not_print = 1;sym___builtin_neon_vraddhnv4si->locus = builtins_locus;
@@ -7597,6 +8286,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vraddhnv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vraddhnv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vraddhnv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vraddhnv8hi"));
 sym___builtin_neon_vraddhnv8hi->kind = SK_FUNCTION;sym___builtin_neon_vraddhnv8hi->do_not_print = 1;sym___builtin_neon_vraddhnv8hi->locus = builtins_locus;
@@ -7608,6 +8298,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vraddhnv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrecpev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrecpev2sf"));
 sym___builtin_neon_vrecpev2sf->kind = SK_FUNCTION;sym___builtin_neon_vrecpev2sf->do_not_print = 1;sym___builtin_neon_vrecpev2sf->locus = builtins_locus;
@@ -7618,6 +8309,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrecpev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrecpev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrecpev2si"));
 sym___builtin_neon_vrecpev2si->kind = SK_FUNCTION;sym___builtin_neon_vrecpev2si->do_not_print = 1;sym___builtin_neon_vrecpev2si->locus = builtins_locus;
@@ -7628,6 +8320,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrecpev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrecpev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrecpev4sf"));
 sym___builtin_neon_vrecpev4sf->kind = SK_FUNCTION;sym___builtin_neon_vrecpev4sf->do_not_print = 1;sym___builtin_neon_vrecpev4sf->locus = builtins_locus;
@@ -7638,6 +8331,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrecpev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrecpev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrecpev4si"));
 sym___builtin_neon_vrecpev4si->kind = SK_FUNCTION;sym___builtin_neon_vrecpev4si->do_not_print = 1;sym___builtin_neon_vrecpev4si->locus = builtins_locus;
@@ -7648,6 +8342,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrecpev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpsv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrecpsv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrecpsv2sf"));
 sym___builtin_neon_vrecpsv2sf->kind = SK_FUNCTION;sym___builtin_neon_vrecpsv2sf->do_not_print = 1;sym___builtin_neon_vrecpsv2sf->locus = builtins_locus;
@@ -7659,6 +8354,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrecpsv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpsv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrecpsv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrecpsv4sf"));
 sym___builtin_neon_vrecpsv4sf->kind = SK_FUNCTION;sym___builtin_neon_vrecpsv4sf->do_not_print = 1;sym___builtin_neon_vrecpsv4sf->locus = builtins_locus;
@@ -7670,6 +8366,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrecpsv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdidi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretdidi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretdidi"));
 sym___builtin_neon_vreinterpretdidi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretdidi->do_not_print = 1;sym___builtin_neon_vreinterpretdidi->locus = builtins_locus;
@@ -7680,6 +8377,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretdidi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretdiv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretdiv2sf"));
 sym___builtin_neon_vreinterpretdiv2sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretdiv2sf->do_not_print = 1;sym___builtin_neon_vreinterpretdiv2sf->locus = builtins_locus;
@@ -7690,6 +8388,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretdiv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretdiv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretdiv2si"));
 sym___builtin_neon_vreinterpretdiv2si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretdiv2si->do_not_print = 1;sym___builtin_neon_vreinterpretdiv2si->locus = builtins_locus;
@@ -7700,6 +8399,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretdiv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretdiv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretdiv4hi"));
 sym___builtin_neon_vreinterpretdiv4hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretdiv4hi->do_not_print = 1;sym___builtin_neon_vreinterpretdiv4hi->locus = builtins_locus;
@@ -7710,6 +8410,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretdiv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretdiv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretdiv8qi"));
 sym___builtin_neon_vreinterpretdiv8qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretdiv8qi->do_not_print = 1;sym___builtin_neon_vreinterpretdiv8qi->locus = builtins_locus;
@@ -7720,6 +8421,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretdiv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv16qiv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv16qiv16qi"));
 sym___builtin_neon_vreinterpretv16qiv16qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv16qiv16qi->do_not_print = 1;sym___builtin_neon_vreinterpretv16qiv16qi->locus = builtins_locus;
@@ -7730,6 +8432,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv16qiv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv16qiv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv16qiv2di"));
 sym___builtin_neon_vreinterpretv16qiv2di->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv16qiv2di->do_not_print = 1;sym___builtin_neon_vreinterpretv16qiv2di->locus = builtins_locus;
@@ -7740,6 +8443,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv16qiv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv16qiv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv16qiv4sf"));
 sym___builtin_neon_vreinterpretv16qiv4sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv16qiv4sf->do_not_print = 1;sym___builtin_neon_vreinterpretv16qiv4sf->locus = builtins_locus;
@@ -7750,6 +8454,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv16qiv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv16qiv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv16qiv4si"));
 sym___builtin_neon_vreinterpretv16qiv4si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv16qiv4si->do_not_print = 1;sym___builtin_neon_vreinterpretv16qiv4si->locus = builtins_locus;
@@ -7760,6 +8465,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv16qiv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv16qiv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv16qiv8hi"));
 sym___builtin_neon_vreinterpretv16qiv8hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv16qiv8hi->do_not_print = 1;sym___builtin_neon_vreinterpretv16qiv8hi->locus = builtins_locus;
@@ -7770,6 +8476,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv16qiv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2div16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2div16qi"));
 sym___builtin_neon_vreinterpretv2div16qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2div16qi->do_not_print = 1;sym___builtin_neon_vreinterpretv2div16qi->locus = builtins_locus;
@@ -7780,6 +8487,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2div16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2div2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2div2di"));
 sym___builtin_neon_vreinterpretv2div2di->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2div2di->do_not_print = 1;sym___builtin_neon_vreinterpretv2div2di->locus = builtins_locus;
@@ -7790,6 +8498,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2div2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2div4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2div4sf"));
 sym___builtin_neon_vreinterpretv2div4sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2div4sf->do_not_print = 1;sym___builtin_neon_vreinterpretv2div4sf->locus = builtins_locus;
@@ -7800,6 +8509,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2div4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2div4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2div4si"));
 sym___builtin_neon_vreinterpretv2div4si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2div4si->do_not_print = 1;sym___builtin_neon_vreinterpretv2div4si->locus = builtins_locus;
@@ -7810,6 +8520,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2div4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2div8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2div8hi"));
 sym___builtin_neon_vreinterpretv2div8hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2div8hi->do_not_print = 1;sym___builtin_neon_vreinterpretv2div8hi->locus = builtins_locus;
@@ -7820,6 +8531,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2div8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2sfdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2sfdi"));
 sym___builtin_neon_vreinterpretv2sfdi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2sfdi->do_not_print = 1;sym___builtin_neon_vreinterpretv2sfdi->locus = builtins_locus;
@@ -7830,6 +8542,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2sfdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2sfv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2sfv2si"));
 sym___builtin_neon_vreinterpretv2sfv2si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2sfv2si->do_not_print = 1;sym___builtin_neon_vreinterpretv2sfv2si->locus = builtins_locus;
@@ -7840,6 +8553,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2sfv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2sfv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2sfv4hi"));
 sym___builtin_neon_vreinterpretv2sfv4hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2sfv4hi->do_not_print = 1;sym___builtin_neon_vreinterpretv2sfv4hi->locus = builtins_locus;
@@ -7850,6 +8564,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2sfv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2sfv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2sfv8qi"));
 sym___builtin_neon_vreinterpretv2sfv8qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2sfv8qi->do_not_print = 1;sym___builtin_neon_vreinterpretv2sfv8qi->locus = builtins_locus;
@@ -7860,6 +8575,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2sfv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sidi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2sidi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2sidi"));
 sym___builtin_neon_vreinterpretv2sidi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2sidi->do_not_print = 1;sym___builtin_neon_vreinterpretv2sidi->locus = builtins_locus;
@@ -7870,6 +8586,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2sidi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2siv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2siv2sf"));
 sym___builtin_neon_vreinterpretv2siv2sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2siv2sf->do_not_print = 1;sym___builtin_neon_vreinterpretv2siv2sf->locus = builtins_locus;
@@ -7880,6 +8597,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2siv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2siv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2siv2si"));
 sym___builtin_neon_vreinterpretv2siv2si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2siv2si->do_not_print = 1;sym___builtin_neon_vreinterpretv2siv2si->locus = builtins_locus;
@@ -7890,6 +8608,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2siv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2siv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2siv4hi"));
 sym___builtin_neon_vreinterpretv2siv4hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2siv4hi->do_not_print = 1;sym___builtin_neon_vreinterpretv2siv4hi->locus = builtins_locus;
@@ -7900,6 +8619,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2siv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv2siv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv2siv8qi"));
 sym___builtin_neon_vreinterpretv2siv8qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv2siv8qi->do_not_print = 1;sym___builtin_neon_vreinterpretv2siv8qi->locus = builtins_locus;
@@ -7910,6 +8630,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv2siv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hidi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4hidi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4hidi"));
 sym___builtin_neon_vreinterpretv4hidi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4hidi->do_not_print = 1;sym___builtin_neon_vreinterpretv4hidi->locus = builtins_locus;
@@ -7920,6 +8641,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4hidi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4hiv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4hiv2sf"));
 sym___builtin_neon_vreinterpretv4hiv2sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4hiv2sf->do_not_print = 1;sym___builtin_neon_vreinterpretv4hiv2sf->locus = builtins_locus;
@@ -7930,6 +8652,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4hiv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4hiv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4hiv2si"));
 sym___builtin_neon_vreinterpretv4hiv2si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4hiv2si->do_not_print = 1;sym___builtin_neon_vreinterpretv4hiv2si->locus = builtins_locus;
@@ -7940,6 +8663,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4hiv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4hiv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4hiv4hi"));
 sym___builtin_neon_vreinterpretv4hiv4hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4hiv4hi->do_not_print = 1;sym___builtin_neon_vreinterpretv4hiv4hi->locus = builtins_locus;
@@ -7950,6 +8674,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4hiv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4hiv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4hiv8qi"));
 sym___builtin_neon_vreinterpretv4hiv8qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4hiv8qi->do_not_print = 1;sym___builtin_neon_vreinterpretv4hiv8qi->locus = builtins_locus;
@@ -7960,6 +8685,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4hiv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4sfv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4sfv16qi"));
 sym___builtin_neon_vreinterpretv4sfv16qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4sfv16qi->do_not_print = 1;sym___builtin_neon_vreinterpretv4sfv16qi->locus = builtins_locus;
@@ -7970,6 +8696,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4sfv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4sfv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4sfv2di"));
 sym___builtin_neon_vreinterpretv4sfv2di->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4sfv2di->do_not_print = 1;sym___builtin_neon_vreinterpretv4sfv2di->locus = builtins_locus;
@@ -7980,6 +8707,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4sfv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4sfv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4sfv4si"));
 sym___builtin_neon_vreinterpretv4sfv4si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4sfv4si->do_not_print = 1;sym___builtin_neon_vreinterpretv4sfv4si->locus = builtins_locus;
@@ -7990,6 +8718,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4sfv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4sfv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4sfv8hi"));
 sym___builtin_neon_vreinterpretv4sfv8hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4sfv8hi->do_not_print = 1;sym___builtin_neon_vreinterpretv4sfv8hi->locus = builtins_locus;
@@ -8000,6 +8729,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4sfv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4siv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4siv16qi"));
 sym___builtin_neon_vreinterpretv4siv16qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4siv16qi->do_not_print = 1;sym___builtin_neon_vreinterpretv4siv16qi->locus = builtins_locus;
@@ -8010,6 +8740,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4siv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4siv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4siv2di"));
 sym___builtin_neon_vreinterpretv4siv2di->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4siv2di->do_not_print = 1;sym___builtin_neon_vreinterpretv4siv2di->locus = builtins_locus;
@@ -8020,6 +8751,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4siv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4siv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4siv4sf"));
 sym___builtin_neon_vreinterpretv4siv4sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4siv4sf->do_not_print = 1;sym___builtin_neon_vreinterpretv4siv4sf->locus = builtins_locus;
@@ -8030,6 +8762,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4siv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4siv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4siv4si"));
 sym___builtin_neon_vreinterpretv4siv4si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4siv4si->do_not_print = 1;sym___builtin_neon_vreinterpretv4siv4si->locus = builtins_locus;
@@ -8040,6 +8773,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4siv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv4siv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv4siv8hi"));
 sym___builtin_neon_vreinterpretv4siv8hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv4siv8hi->do_not_print = 1;sym___builtin_neon_vreinterpretv4siv8hi->locus = builtins_locus;
@@ -8050,6 +8784,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv4siv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8hiv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8hiv16qi"));
 sym___builtin_neon_vreinterpretv8hiv16qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8hiv16qi->do_not_print = 1;sym___builtin_neon_vreinterpretv8hiv16qi->locus = builtins_locus;
@@ -8060,6 +8795,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8hiv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8hiv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8hiv2di"));
 sym___builtin_neon_vreinterpretv8hiv2di->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8hiv2di->do_not_print = 1;sym___builtin_neon_vreinterpretv8hiv2di->locus = builtins_locus;
@@ -8070,6 +8806,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8hiv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8hiv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8hiv4sf"));
 sym___builtin_neon_vreinterpretv8hiv4sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8hiv4sf->do_not_print = 1;sym___builtin_neon_vreinterpretv8hiv4sf->locus = builtins_locus;
@@ -8080,6 +8817,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8hiv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8hiv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8hiv4si"));
 sym___builtin_neon_vreinterpretv8hiv4si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8hiv4si->do_not_print = 1;sym___builtin_neon_vreinterpretv8hiv4si->locus = builtins_locus;
@@ -8090,6 +8828,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8hiv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8hiv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8hiv8hi"));
 sym___builtin_neon_vreinterpretv8hiv8hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8hiv8hi->do_not_print = 1;sym___builtin_neon_vreinterpretv8hiv8hi->locus = builtins_locus;
@@ -8100,6 +8839,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8hiv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qidi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8qidi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8qidi"));
 sym___builtin_neon_vreinterpretv8qidi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8qidi->do_not_print = 1;sym___builtin_neon_vreinterpretv8qidi->locus = builtins_locus;
@@ -8110,6 +8850,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8qidi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8qiv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8qiv2sf"));
 sym___builtin_neon_vreinterpretv8qiv2sf->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8qiv2sf->do_not_print = 1;sym___builtin_neon_vreinterpretv8qiv2sf->locus = builtins_locus;
@@ -8120,6 +8861,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8qiv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8qiv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8qiv2si"));
 sym___builtin_neon_vreinterpretv8qiv2si->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8qiv2si->do_not_print = 1;sym___builtin_neon_vreinterpretv8qiv2si->locus = builtins_locus;
@@ -8130,6 +8872,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8qiv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8qiv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8qiv4hi"));
 sym___builtin_neon_vreinterpretv8qiv4hi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8qiv4hi->do_not_print = 1;sym___builtin_neon_vreinterpretv8qiv4hi->locus = builtins_locus;
@@ -8140,6 +8883,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8qiv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vreinterpretv8qiv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vreinterpretv8qiv8qi"));
 sym___builtin_neon_vreinterpretv8qiv8qi->kind = SK_FUNCTION;sym___builtin_neon_vreinterpretv8qiv8qi->do_not_print = 1;sym___builtin_neon_vreinterpretv8qiv8qi->locus = builtins_locus;
@@ -8150,6 +8894,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vreinterpretv8qiv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhaddsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhaddsv16qi"));
 sym___builtin_neon_vrhaddsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrhaddsv16qi->do_not_print = 1;sym___builtin_neon_vrhaddsv16qi->locus = builtins_locus;
@@ -8161,6 +8906,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhaddsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhaddsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhaddsv2si"));
 sym___builtin_neon_vrhaddsv2si->kind = SK_FUNCTION;sym___builtin_neon_vrhaddsv2si->do_not_print = 1;sym___builtin_neon_vrhaddsv2si->locus = builtins_locus;
@@ -8172,6 +8918,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhaddsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhaddsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhaddsv4hi"));
 sym___builtin_neon_vrhaddsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrhaddsv4hi->do_not_print = 1;sym___builtin_neon_vrhaddsv4hi->locus = builtins_locus;
@@ -8183,6 +8930,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhaddsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhaddsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhaddsv4si"));
 sym___builtin_neon_vrhaddsv4si->kind = SK_FUNCTION;sym___builtin_neon_vrhaddsv4si->do_not_print = 1;sym___builtin_neon_vrhaddsv4si->locus = builtins_locus;
@@ -8194,6 +8942,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhaddsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhaddsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhaddsv8hi"));
 sym___builtin_neon_vrhaddsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrhaddsv8hi->do_not_print = 1;sym___builtin_neon_vrhaddsv8hi->locus = builtins_locus;
@@ -8205,6 +8954,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhaddsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhaddsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhaddsv8qi"));
 sym___builtin_neon_vrhaddsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrhaddsv8qi->do_not_print = 1;sym___builtin_neon_vrhaddsv8qi->locus = builtins_locus;
@@ -8216,6 +8966,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhaddsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhadduv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhadduv16qi"));
 sym___builtin_neon_vrhadduv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrhadduv16qi->do_not_print = 1;sym___builtin_neon_vrhadduv16qi->locus = builtins_locus;
@@ -8227,6 +8978,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhadduv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhadduv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhadduv2si"));
 sym___builtin_neon_vrhadduv2si->kind = SK_FUNCTION;sym___builtin_neon_vrhadduv2si->do_not_print = 1;sym___builtin_neon_vrhadduv2si->locus = builtins_locus;
@@ -8238,6 +8990,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhadduv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhadduv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhadduv4hi"));
 sym___builtin_neon_vrhadduv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrhadduv4hi->do_not_print = 1;sym___builtin_neon_vrhadduv4hi->locus = builtins_locus;
@@ -8249,6 +9002,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhadduv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhadduv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhadduv4si"));
 sym___builtin_neon_vrhadduv4si->kind = SK_FUNCTION;sym___builtin_neon_vrhadduv4si->do_not_print = 1;sym___builtin_neon_vrhadduv4si->locus = builtins_locus;
@@ -8260,6 +9014,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhadduv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhadduv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhadduv8hi"));
 sym___builtin_neon_vrhadduv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrhadduv8hi->do_not_print = 1;sym___builtin_neon_vrhadduv8hi->locus = builtins_locus;
@@ -8271,6 +9026,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhadduv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrhadduv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrhadduv8qi"));
 sym___builtin_neon_vrhadduv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrhadduv8qi->do_not_print = 1;sym___builtin_neon_vrhadduv8qi->locus = builtins_locus;
@@ -8282,6 +9038,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrhadduv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsdi"));
 sym___builtin_neon_vrshlsdi->kind = SK_FUNCTION;sym___builtin_neon_vrshlsdi->do_not_print = 1;sym___builtin_neon_vrshlsdi->locus = builtins_locus;
@@ -8293,6 +9050,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv16qi"));
 sym___builtin_neon_vrshlsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv16qi->do_not_print = 1;sym___builtin_neon_vrshlsv16qi->locus = builtins_locus;
@@ -8304,6 +9062,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv2di"));
 sym___builtin_neon_vrshlsv2di->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv2di->do_not_print = 1;sym___builtin_neon_vrshlsv2di->locus = builtins_locus;
@@ -8315,6 +9074,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv2si"));
 sym___builtin_neon_vrshlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv2si->do_not_print = 1;sym___builtin_neon_vrshlsv2si->locus = builtins_locus;
@@ -8326,6 +9086,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv4hi"));
 sym___builtin_neon_vrshlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv4hi->do_not_print = 1;sym___builtin_neon_vrshlsv4hi->locus = builtins_locus;
@@ -8337,6 +9098,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv4si"));
 sym___builtin_neon_vrshlsv4si->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv4si->do_not_print = 1;sym___builtin_neon_vrshlsv4si->locus = builtins_locus;
@@ -8348,6 +9110,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv8hi"));
 sym___builtin_neon_vrshlsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv8hi->do_not_print = 1;sym___builtin_neon_vrshlsv8hi->locus = builtins_locus;
@@ -8359,6 +9122,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshlsv8qi"));
 sym___builtin_neon_vrshlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrshlsv8qi->do_not_print = 1;sym___builtin_neon_vrshlsv8qi->locus = builtins_locus;
@@ -8370,6 +9134,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshludi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshludi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshludi"));
 sym___builtin_neon_vrshludi->kind = SK_FUNCTION;sym___builtin_neon_vrshludi->do_not_print = 1;sym___builtin_neon_vrshludi->locus = builtins_locus;
@@ -8381,6 +9146,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshludi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv16qi"));
 sym___builtin_neon_vrshluv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrshluv16qi->do_not_print = 1;sym___builtin_neon_vrshluv16qi->locus = builtins_locus;
@@ -8392,6 +9158,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv2di"));
 sym___builtin_neon_vrshluv2di->kind = SK_FUNCTION;sym___builtin_neon_vrshluv2di->do_not_print = 1;sym___builtin_neon_vrshluv2di->locus = builtins_locus;
@@ -8403,6 +9170,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv2si"));
 sym___builtin_neon_vrshluv2si->kind = SK_FUNCTION;sym___builtin_neon_vrshluv2si->do_not_print = 1;sym___builtin_neon_vrshluv2si->locus = builtins_locus;
@@ -8414,6 +9182,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv4hi"));
 sym___builtin_neon_vrshluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrshluv4hi->do_not_print = 1;sym___builtin_neon_vrshluv4hi->locus = builtins_locus;
@@ -8425,6 +9194,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv4si"));
 sym___builtin_neon_vrshluv4si->kind = SK_FUNCTION;sym___builtin_neon_vrshluv4si->do_not_print = 1;sym___builtin_neon_vrshluv4si->locus = builtins_locus;
@@ -8436,6 +9206,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv8hi"));
 sym___builtin_neon_vrshluv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrshluv8hi->do_not_print = 1;sym___builtin_neon_vrshluv8hi->locus = builtins_locus;
@@ -8447,6 +9218,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshluv8qi"));
 sym___builtin_neon_vrshluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrshluv8qi->do_not_print = 1;sym___builtin_neon_vrshluv8qi->locus = builtins_locus;
@@ -8458,6 +9230,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrn_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrn_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrn_nv2di"));
 sym___builtin_neon_vrshrn_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vrshrn_nv2di->do_not_print = 1;sym___builtin_neon_vrshrn_nv2di->locus = builtins_locus;
@@ -8469,6 +9242,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrn_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrn_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrn_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrn_nv4si"));
 sym___builtin_neon_vrshrn_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vrshrn_nv4si->do_not_print = 1;sym___builtin_neon_vrshrn_nv4si->locus = builtins_locus;
@@ -8480,6 +9254,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrn_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrn_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrn_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrn_nv8hi"));
 sym___builtin_neon_vrshrn_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrshrn_nv8hi->do_not_print = 1;sym___builtin_neon_vrshrn_nv8hi->locus = builtins_locus;
@@ -8491,6 +9266,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrn_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_ndi"));
 sym___builtin_neon_vrshrs_ndi->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_ndi->do_not_print = 1;sym___builtin_neon_vrshrs_ndi->locus = builtins_locus;
@@ -8502,6 +9278,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv16qi"));
 sym___builtin_neon_vrshrs_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv16qi->do_not_print = 1;sym___builtin_neon_vrshrs_nv16qi->locus = builtins_locus;
@@ -8513,6 +9290,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv2di"));
 sym___builtin_neon_vrshrs_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv2di->do_not_print = 1;sym___builtin_neon_vrshrs_nv2di->locus = builtins_locus;
@@ -8524,6 +9302,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv2si"));
 sym___builtin_neon_vrshrs_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv2si->do_not_print = 1;sym___builtin_neon_vrshrs_nv2si->locus = builtins_locus;
@@ -8535,6 +9314,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv4hi"));
 sym___builtin_neon_vrshrs_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv4hi->do_not_print = 1;sym___builtin_neon_vrshrs_nv4hi->locus = builtins_locus;
@@ -8546,6 +9326,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv4si"));
 sym___builtin_neon_vrshrs_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv4si->do_not_print = 1;sym___builtin_neon_vrshrs_nv4si->locus = builtins_locus;
@@ -8557,6 +9338,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv8hi"));
 sym___builtin_neon_vrshrs_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv8hi->do_not_print = 1;sym___builtin_neon_vrshrs_nv8hi->locus = builtins_locus;
@@ -8568,6 +9350,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshrs_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshrs_nv8qi"));
 sym___builtin_neon_vrshrs_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrshrs_nv8qi->do_not_print = 1;sym___builtin_neon_vrshrs_nv8qi->locus = builtins_locus;
@@ -8579,6 +9362,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshrs_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_ndi"));
 sym___builtin_neon_vrshru_ndi->kind = SK_FUNCTION;sym___builtin_neon_vrshru_ndi->do_not_print = 1;sym___builtin_neon_vrshru_ndi->locus = builtins_locus;
@@ -8590,6 +9374,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv16qi"));
 sym___builtin_neon_vrshru_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv16qi->do_not_print = 1;sym___builtin_neon_vrshru_nv16qi->locus = builtins_locus;
@@ -8601,6 +9386,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv2di"));
 sym___builtin_neon_vrshru_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv2di->do_not_print = 1;sym___builtin_neon_vrshru_nv2di->locus = builtins_locus;
@@ -8612,6 +9398,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv2si"));
 sym___builtin_neon_vrshru_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv2si->do_not_print = 1;sym___builtin_neon_vrshru_nv2si->locus = builtins_locus;
@@ -8623,6 +9410,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv4hi"));
 sym___builtin_neon_vrshru_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv4hi->do_not_print = 1;sym___builtin_neon_vrshru_nv4hi->locus = builtins_locus;
@@ -8634,6 +9422,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv4si"));
 sym___builtin_neon_vrshru_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv4si->do_not_print = 1;sym___builtin_neon_vrshru_nv4si->locus = builtins_locus;
@@ -8645,6 +9434,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv8hi"));
 sym___builtin_neon_vrshru_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv8hi->do_not_print = 1;sym___builtin_neon_vrshru_nv8hi->locus = builtins_locus;
@@ -8656,6 +9446,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrshru_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrshru_nv8qi"));
 sym___builtin_neon_vrshru_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrshru_nv8qi->do_not_print = 1;sym___builtin_neon_vrshru_nv8qi->locus = builtins_locus;
@@ -8667,6 +9458,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrshru_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsqrtev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsqrtev2sf"));
 sym___builtin_neon_vrsqrtev2sf->kind = SK_FUNCTION;sym___builtin_neon_vrsqrtev2sf->do_not_print = 1;sym___builtin_neon_vrsqrtev2sf->locus = builtins_locus;
@@ -8677,6 +9469,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsqrtev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsqrtev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsqrtev2si"));
 sym___builtin_neon_vrsqrtev2si->kind = SK_FUNCTION;sym___builtin_neon_vrsqrtev2si->do_not_print = 1;sym___builtin_neon_vrsqrtev2si->locus = builtins_locus;
@@ -8687,6 +9480,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsqrtev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsqrtev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsqrtev4sf"));
 sym___builtin_neon_vrsqrtev4sf->kind = SK_FUNCTION;sym___builtin_neon_vrsqrtev4sf->do_not_print = 1;sym___builtin_neon_vrsqrtev4sf->locus = builtins_locus;
@@ -8697,6 +9491,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsqrtev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsqrtev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsqrtev4si"));
 sym___builtin_neon_vrsqrtev4si->kind = SK_FUNCTION;sym___builtin_neon_vrsqrtev4si->do_not_print = 1;sym___builtin_neon_vrsqrtev4si->locus = builtins_locus;
@@ -8707,6 +9502,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsqrtev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtsv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsqrtsv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsqrtsv2sf"));
 sym___builtin_neon_vrsqrtsv2sf->kind = SK_FUNCTION;sym___builtin_neon_vrsqrtsv2sf->do_not_print = 1;sym___builtin_neon_vrsqrtsv2sf->locus = builtins_locus;
@@ -8718,6 +9514,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsqrtsv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtsv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsqrtsv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsqrtsv4sf"));
 sym___builtin_neon_vrsqrtsv4sf->kind = SK_FUNCTION;sym___builtin_neon_vrsqrtsv4sf->do_not_print = 1;sym___builtin_neon_vrsqrtsv4sf->locus = builtins_locus;
@@ -8729,6 +9526,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsqrtsv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_ndi"));
 sym___builtin_neon_vrsras_ndi->kind = SK_FUNCTION;sym___builtin_neon_vrsras_ndi->do_not_print = 1;sym___builtin_neon_vrsras_ndi->locus = builtins_locus;
@@ -8741,6 +9539,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv16qi"));
 sym___builtin_neon_vrsras_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv16qi->do_not_print = 1;sym___builtin_neon_vrsras_nv16qi->locus = builtins_locus;
@@ -8753,6 +9552,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv2di"));
 sym___builtin_neon_vrsras_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv2di->do_not_print = 1;sym___builtin_neon_vrsras_nv2di->locus = builtins_locus;
@@ -8765,6 +9565,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv2si"));
 sym___builtin_neon_vrsras_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv2si->do_not_print = 1;sym___builtin_neon_vrsras_nv2si->locus = builtins_locus;
@@ -8777,6 +9578,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv4hi"));
 sym___builtin_neon_vrsras_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv4hi->do_not_print = 1;sym___builtin_neon_vrsras_nv4hi->locus = builtins_locus;
@@ -8789,6 +9591,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv4si"));
 sym___builtin_neon_vrsras_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv4si->do_not_print = 1;sym___builtin_neon_vrsras_nv4si->locus = builtins_locus;
@@ -8801,6 +9604,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv8hi"));
 sym___builtin_neon_vrsras_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv8hi->do_not_print = 1;sym___builtin_neon_vrsras_nv8hi->locus = builtins_locus;
@@ -8813,6 +9617,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsras_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsras_nv8qi"));
 sym___builtin_neon_vrsras_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrsras_nv8qi->do_not_print = 1;sym___builtin_neon_vrsras_nv8qi->locus = builtins_locus;
@@ -8825,6 +9630,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsras_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_ndi"));
 sym___builtin_neon_vrsrau_ndi->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_ndi->do_not_print = 1;sym___builtin_neon_vrsrau_ndi->locus = builtins_locus;
@@ -8837,6 +9643,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv16qi"));
 sym___builtin_neon_vrsrau_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv16qi->do_not_print = 1;sym___builtin_neon_vrsrau_nv16qi->locus = builtins_locus;
@@ -8849,6 +9656,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv2di"));
 sym___builtin_neon_vrsrau_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv2di->do_not_print = 1;sym___builtin_neon_vrsrau_nv2di->locus = builtins_locus;
@@ -8861,6 +9669,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv2si"));
 sym___builtin_neon_vrsrau_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv2si->do_not_print = 1;sym___builtin_neon_vrsrau_nv2si->locus = builtins_locus;
@@ -8873,6 +9682,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv4hi"));
 sym___builtin_neon_vrsrau_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv4hi->do_not_print = 1;sym___builtin_neon_vrsrau_nv4hi->locus = builtins_locus;
@@ -8885,6 +9695,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv4si"));
 sym___builtin_neon_vrsrau_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv4si->do_not_print = 1;sym___builtin_neon_vrsrau_nv4si->locus = builtins_locus;
@@ -8897,6 +9708,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv8hi"));
 sym___builtin_neon_vrsrau_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv8hi->do_not_print = 1;sym___builtin_neon_vrsrau_nv8hi->locus = builtins_locus;
@@ -8909,6 +9721,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsrau_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsrau_nv8qi"));
 sym___builtin_neon_vrsrau_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vrsrau_nv8qi->do_not_print = 1;sym___builtin_neon_vrsrau_nv8qi->locus = builtins_locus;
@@ -8921,6 +9734,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsrau_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsubhnv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsubhnv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsubhnv2di"));
 sym___builtin_neon_vrsubhnv2di->kind = SK_FUNCTION;sym___builtin_neon_vrsubhnv2di->do_not_print = 1;sym___builtin_neon_vrsubhnv2di->locus = builtins_locus;
@@ -8932,6 +9746,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsubhnv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsubhnv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsubhnv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsubhnv4si"));
 sym___builtin_neon_vrsubhnv4si->kind = SK_FUNCTION;sym___builtin_neon_vrsubhnv4si->do_not_print = 1;sym___builtin_neon_vrsubhnv4si->locus = builtins_locus;
@@ -8943,6 +9758,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsubhnv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsubhnv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vrsubhnv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vrsubhnv8hi"));
 sym___builtin_neon_vrsubhnv8hi->kind = SK_FUNCTION;sym___builtin_neon_vrsubhnv8hi->do_not_print = 1;sym___builtin_neon_vrsubhnv8hi->locus = builtins_locus;
@@ -8954,6 +9770,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vrsubhnv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanedi"));
 sym___builtin_neon_vset_lanedi->kind = SK_FUNCTION;sym___builtin_neon_vset_lanedi->do_not_print = 1;sym___builtin_neon_vset_lanedi->locus = builtins_locus;
@@ -8966,6 +9783,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev16qi"));
 sym___builtin_neon_vset_lanev16qi->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev16qi->do_not_print = 1;sym___builtin_neon_vset_lanev16qi->locus = builtins_locus;
@@ -8978,6 +9796,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev2di"));
 sym___builtin_neon_vset_lanev2di->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev2di->do_not_print = 1;sym___builtin_neon_vset_lanev2di->locus = builtins_locus;
@@ -8990,6 +9809,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev2sf"));
 sym___builtin_neon_vset_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev2sf->do_not_print = 1;sym___builtin_neon_vset_lanev2sf->locus = builtins_locus;
@@ -9002,6 +9822,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev2si"));
 sym___builtin_neon_vset_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev2si->do_not_print = 1;sym___builtin_neon_vset_lanev2si->locus = builtins_locus;
@@ -9014,6 +9835,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev4hi"));
 sym___builtin_neon_vset_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev4hi->do_not_print = 1;sym___builtin_neon_vset_lanev4hi->locus = builtins_locus;
@@ -9026,6 +9848,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev4sf"));
 sym___builtin_neon_vset_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev4sf->do_not_print = 1;sym___builtin_neon_vset_lanev4sf->locus = builtins_locus;
@@ -9038,6 +9861,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev4si"));
 sym___builtin_neon_vset_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev4si->do_not_print = 1;sym___builtin_neon_vset_lanev4si->locus = builtins_locus;
@@ -9050,6 +9874,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev8hi"));
 sym___builtin_neon_vset_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev8hi->do_not_print = 1;sym___builtin_neon_vset_lanev8hi->locus = builtins_locus;
@@ -9062,6 +9887,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vset_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vset_lanev8qi"));
 sym___builtin_neon_vset_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vset_lanev8qi->do_not_print = 1;sym___builtin_neon_vset_lanev8qi->locus = builtins_locus;
@@ -9074,6 +9900,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vset_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlls_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlls_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlls_nv2si"));
 sym___builtin_neon_vshlls_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vshlls_nv2si->do_not_print = 1;sym___builtin_neon_vshlls_nv2si->locus = builtins_locus;
@@ -9085,6 +9912,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlls_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlls_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlls_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlls_nv4hi"));
 sym___builtin_neon_vshlls_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshlls_nv4hi->do_not_print = 1;sym___builtin_neon_vshlls_nv4hi->locus = builtins_locus;
@@ -9096,6 +9924,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlls_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlls_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlls_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlls_nv8qi"));
 sym___builtin_neon_vshlls_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshlls_nv8qi->do_not_print = 1;sym___builtin_neon_vshlls_nv8qi->locus = builtins_locus;
@@ -9107,6 +9936,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlls_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshllu_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshllu_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshllu_nv2si"));
 sym___builtin_neon_vshllu_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vshllu_nv2si->do_not_print = 1;sym___builtin_neon_vshllu_nv2si->locus = builtins_locus;
@@ -9118,6 +9948,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshllu_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshllu_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshllu_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshllu_nv4hi"));
 sym___builtin_neon_vshllu_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshllu_nv4hi->do_not_print = 1;sym___builtin_neon_vshllu_nv4hi->locus = builtins_locus;
@@ -9129,6 +9960,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshllu_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshllu_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshllu_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshllu_nv8qi"));
 sym___builtin_neon_vshllu_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshllu_nv8qi->do_not_print = 1;sym___builtin_neon_vshllu_nv8qi->locus = builtins_locus;
@@ -9140,6 +9972,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshllu_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_ndi"));
 sym___builtin_neon_vshl_ndi->kind = SK_FUNCTION;sym___builtin_neon_vshl_ndi->do_not_print = 1;sym___builtin_neon_vshl_ndi->locus = builtins_locus;
@@ -9151,6 +9984,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv16qi"));
 sym___builtin_neon_vshl_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv16qi->do_not_print = 1;sym___builtin_neon_vshl_nv16qi->locus = builtins_locus;
@@ -9162,6 +9996,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv2di"));
 sym___builtin_neon_vshl_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv2di->do_not_print = 1;sym___builtin_neon_vshl_nv2di->locus = builtins_locus;
@@ -9173,6 +10008,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv2si"));
 sym___builtin_neon_vshl_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv2si->do_not_print = 1;sym___builtin_neon_vshl_nv2si->locus = builtins_locus;
@@ -9184,6 +10020,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv4hi"));
 sym___builtin_neon_vshl_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv4hi->do_not_print = 1;sym___builtin_neon_vshl_nv4hi->locus = builtins_locus;
@@ -9195,6 +10032,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv4si"));
 sym___builtin_neon_vshl_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv4si->do_not_print = 1;sym___builtin_neon_vshl_nv4si->locus = builtins_locus;
@@ -9206,6 +10044,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv8hi"));
 sym___builtin_neon_vshl_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv8hi->do_not_print = 1;sym___builtin_neon_vshl_nv8hi->locus = builtins_locus;
@@ -9217,6 +10056,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshl_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshl_nv8qi"));
 sym___builtin_neon_vshl_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshl_nv8qi->do_not_print = 1;sym___builtin_neon_vshl_nv8qi->locus = builtins_locus;
@@ -9228,6 +10068,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshl_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsdi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsdi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsdi"));
 sym___builtin_neon_vshlsdi->kind = SK_FUNCTION;sym___builtin_neon_vshlsdi->do_not_print = 1;sym___builtin_neon_vshlsdi->locus = builtins_locus;
@@ -9239,6 +10080,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsdi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv16qi"));
 sym___builtin_neon_vshlsv16qi->kind = SK_FUNCTION;sym___builtin_neon_vshlsv16qi->do_not_print = 1;sym___builtin_neon_vshlsv16qi->locus = builtins_locus;
@@ -9250,6 +10092,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv2di"));
 sym___builtin_neon_vshlsv2di->kind = SK_FUNCTION;sym___builtin_neon_vshlsv2di->do_not_print = 1;sym___builtin_neon_vshlsv2di->locus = builtins_locus;
@@ -9261,6 +10104,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv2si"));
 sym___builtin_neon_vshlsv2si->kind = SK_FUNCTION;sym___builtin_neon_vshlsv2si->do_not_print = 1;sym___builtin_neon_vshlsv2si->locus = builtins_locus;
@@ -9272,6 +10116,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv4hi"));
 sym___builtin_neon_vshlsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshlsv4hi->do_not_print = 1;sym___builtin_neon_vshlsv4hi->locus = builtins_locus;
@@ -9283,6 +10128,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv4si"));
 sym___builtin_neon_vshlsv4si->kind = SK_FUNCTION;sym___builtin_neon_vshlsv4si->do_not_print = 1;sym___builtin_neon_vshlsv4si->locus = builtins_locus;
@@ -9294,6 +10140,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv8hi"));
 sym___builtin_neon_vshlsv8hi->kind = SK_FUNCTION;sym___builtin_neon_vshlsv8hi->do_not_print = 1;sym___builtin_neon_vshlsv8hi->locus = builtins_locus;
@@ -9305,6 +10152,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshlsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshlsv8qi"));
 sym___builtin_neon_vshlsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshlsv8qi->do_not_print = 1;sym___builtin_neon_vshlsv8qi->locus = builtins_locus;
@@ -9316,6 +10164,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshlsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshludi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshludi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshludi"));
 sym___builtin_neon_vshludi->kind = SK_FUNCTION;sym___builtin_neon_vshludi->do_not_print = 1;sym___builtin_neon_vshludi->locus = builtins_locus;
@@ -9327,6 +10176,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshludi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv16qi"));
 sym___builtin_neon_vshluv16qi->kind = SK_FUNCTION;sym___builtin_neon_vshluv16qi->do_not_print = 1;sym___builtin_neon_vshluv16qi->locus = builtins_locus;
@@ -9338,6 +10188,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv2di"));
 sym___builtin_neon_vshluv2di->kind = SK_FUNCTION;sym___builtin_neon_vshluv2di->do_not_print = 1;sym___builtin_neon_vshluv2di->locus = builtins_locus;
@@ -9349,6 +10200,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv2si"));
 sym___builtin_neon_vshluv2si->kind = SK_FUNCTION;sym___builtin_neon_vshluv2si->do_not_print = 1;sym___builtin_neon_vshluv2si->locus = builtins_locus;
@@ -9360,6 +10212,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv4hi"));
 sym___builtin_neon_vshluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshluv4hi->do_not_print = 1;sym___builtin_neon_vshluv4hi->locus = builtins_locus;
@@ -9371,6 +10224,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv4si"));
 sym___builtin_neon_vshluv4si->kind = SK_FUNCTION;sym___builtin_neon_vshluv4si->do_not_print = 1;sym___builtin_neon_vshluv4si->locus = builtins_locus;
@@ -9382,6 +10236,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv8hi"));
 sym___builtin_neon_vshluv8hi->kind = SK_FUNCTION;sym___builtin_neon_vshluv8hi->do_not_print = 1;sym___builtin_neon_vshluv8hi->locus = builtins_locus;
@@ -9393,6 +10248,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshluv8qi"));
 sym___builtin_neon_vshluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshluv8qi->do_not_print = 1;sym___builtin_neon_vshluv8qi->locus = builtins_locus;
@@ -9404,6 +10260,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrn_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrn_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrn_nv2di"));
 sym___builtin_neon_vshrn_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vshrn_nv2di->do_not_print = 1;sym___builtin_neon_vshrn_nv2di->locus = builtins_locus;
@@ -9415,6 +10272,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrn_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrn_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrn_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrn_nv4si"));
 sym___builtin_neon_vshrn_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vshrn_nv4si->do_not_print = 1;sym___builtin_neon_vshrn_nv4si->locus = builtins_locus;
@@ -9426,6 +10284,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrn_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrn_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrn_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrn_nv8hi"));
 sym___builtin_neon_vshrn_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vshrn_nv8hi->do_not_print = 1;sym___builtin_neon_vshrn_nv8hi->locus = builtins_locus;
@@ -9437,6 +10296,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrn_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_ndi"));
 sym___builtin_neon_vshrs_ndi->kind = SK_FUNCTION;sym___builtin_neon_vshrs_ndi->do_not_print = 1;sym___builtin_neon_vshrs_ndi->locus = builtins_locus;
@@ -9448,6 +10308,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv16qi"));
 sym___builtin_neon_vshrs_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv16qi->do_not_print = 1;sym___builtin_neon_vshrs_nv16qi->locus = builtins_locus;
@@ -9459,6 +10320,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv2di"));
 sym___builtin_neon_vshrs_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv2di->do_not_print = 1;sym___builtin_neon_vshrs_nv2di->locus = builtins_locus;
@@ -9470,6 +10332,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv2si"));
 sym___builtin_neon_vshrs_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv2si->do_not_print = 1;sym___builtin_neon_vshrs_nv2si->locus = builtins_locus;
@@ -9481,6 +10344,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv4hi"));
 sym___builtin_neon_vshrs_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv4hi->do_not_print = 1;sym___builtin_neon_vshrs_nv4hi->locus = builtins_locus;
@@ -9492,6 +10356,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv4si"));
 sym___builtin_neon_vshrs_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv4si->do_not_print = 1;sym___builtin_neon_vshrs_nv4si->locus = builtins_locus;
@@ -9503,6 +10368,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv8hi"));
 sym___builtin_neon_vshrs_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv8hi->do_not_print = 1;sym___builtin_neon_vshrs_nv8hi->locus = builtins_locus;
@@ -9514,6 +10380,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshrs_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshrs_nv8qi"));
 sym___builtin_neon_vshrs_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshrs_nv8qi->do_not_print = 1;sym___builtin_neon_vshrs_nv8qi->locus = builtins_locus;
@@ -9525,6 +10392,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshrs_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_ndi"));
 sym___builtin_neon_vshru_ndi->kind = SK_FUNCTION;sym___builtin_neon_vshru_ndi->do_not_print = 1;sym___builtin_neon_vshru_ndi->locus = builtins_locus;
@@ -9536,6 +10404,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv16qi"));
 sym___builtin_neon_vshru_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv16qi->do_not_print = 1;sym___builtin_neon_vshru_nv16qi->locus = builtins_locus;
@@ -9547,6 +10416,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv2di"));
 sym___builtin_neon_vshru_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv2di->do_not_print = 1;sym___builtin_neon_vshru_nv2di->locus = builtins_locus;
@@ -9558,6 +10428,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv2si"));
 sym___builtin_neon_vshru_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv2si->do_not_print = 1;sym___builtin_neon_vshru_nv2si->locus = builtins_locus;
@@ -9569,6 +10440,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv4hi"));
 sym___builtin_neon_vshru_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv4hi->do_not_print = 1;sym___builtin_neon_vshru_nv4hi->locus = builtins_locus;
@@ -9580,6 +10452,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv4si"));
 sym___builtin_neon_vshru_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv4si->do_not_print = 1;sym___builtin_neon_vshru_nv4si->locus = builtins_locus;
@@ -9591,6 +10464,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv8hi"));
 sym___builtin_neon_vshru_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv8hi->do_not_print = 1;sym___builtin_neon_vshru_nv8hi->locus = builtins_locus;
@@ -9602,6 +10476,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vshru_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vshru_nv8qi"));
 sym___builtin_neon_vshru_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vshru_nv8qi->do_not_print = 1;sym___builtin_neon_vshru_nv8qi->locus = builtins_locus;
@@ -9613,6 +10488,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vshru_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_ndi"));
 sym___builtin_neon_vsli_ndi->kind = SK_FUNCTION;sym___builtin_neon_vsli_ndi->do_not_print = 1;sym___builtin_neon_vsli_ndi->locus = builtins_locus;
@@ -9625,6 +10501,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv16qi"));
 sym___builtin_neon_vsli_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv16qi->do_not_print = 1;sym___builtin_neon_vsli_nv16qi->locus = builtins_locus;
@@ -9637,6 +10514,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv2di"));
 sym___builtin_neon_vsli_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv2di->do_not_print = 1;sym___builtin_neon_vsli_nv2di->locus = builtins_locus;
@@ -9649,6 +10527,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv2si"));
 sym___builtin_neon_vsli_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv2si->do_not_print = 1;sym___builtin_neon_vsli_nv2si->locus = builtins_locus;
@@ -9661,6 +10540,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv4hi"));
 sym___builtin_neon_vsli_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv4hi->do_not_print = 1;sym___builtin_neon_vsli_nv4hi->locus = builtins_locus;
@@ -9673,6 +10553,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv4si"));
 sym___builtin_neon_vsli_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv4si->do_not_print = 1;sym___builtin_neon_vsli_nv4si->locus = builtins_locus;
@@ -9685,6 +10566,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv8hi"));
 sym___builtin_neon_vsli_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv8hi->do_not_print = 1;sym___builtin_neon_vsli_nv8hi->locus = builtins_locus;
@@ -9697,6 +10579,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsli_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsli_nv8qi"));
 sym___builtin_neon_vsli_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsli_nv8qi->do_not_print = 1;sym___builtin_neon_vsli_nv8qi->locus = builtins_locus;
@@ -9709,6 +10592,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsli_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_ndi"));
 sym___builtin_neon_vsras_ndi->kind = SK_FUNCTION;sym___builtin_neon_vsras_ndi->do_not_print = 1;sym___builtin_neon_vsras_ndi->locus = builtins_locus;
@@ -9721,6 +10605,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv16qi"));
 sym___builtin_neon_vsras_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv16qi->do_not_print = 1;sym___builtin_neon_vsras_nv16qi->locus = builtins_locus;
@@ -9733,6 +10618,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv2di"));
 sym___builtin_neon_vsras_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv2di->do_not_print = 1;sym___builtin_neon_vsras_nv2di->locus = builtins_locus;
@@ -9745,6 +10631,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv2si"));
 sym___builtin_neon_vsras_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv2si->do_not_print = 1;sym___builtin_neon_vsras_nv2si->locus = builtins_locus;
@@ -9757,6 +10644,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv4hi"));
 sym___builtin_neon_vsras_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv4hi->do_not_print = 1;sym___builtin_neon_vsras_nv4hi->locus = builtins_locus;
@@ -9769,6 +10657,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv4si"));
 sym___builtin_neon_vsras_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv4si->do_not_print = 1;sym___builtin_neon_vsras_nv4si->locus = builtins_locus;
@@ -9781,6 +10670,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv8hi"));
 sym___builtin_neon_vsras_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv8hi->do_not_print = 1;sym___builtin_neon_vsras_nv8hi->locus = builtins_locus;
@@ -9793,6 +10683,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsras_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsras_nv8qi"));
 sym___builtin_neon_vsras_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsras_nv8qi->do_not_print = 1;sym___builtin_neon_vsras_nv8qi->locus = builtins_locus;
@@ -9805,6 +10696,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsras_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_ndi"));
 sym___builtin_neon_vsrau_ndi->kind = SK_FUNCTION;sym___builtin_neon_vsrau_ndi->do_not_print = 1;sym___builtin_neon_vsrau_ndi->locus = builtins_locus;
@@ -9817,6 +10709,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv16qi"));
 sym___builtin_neon_vsrau_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv16qi->do_not_print = 1;sym___builtin_neon_vsrau_nv16qi->locus = builtins_locus;
@@ -9829,6 +10722,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv2di"));
 sym___builtin_neon_vsrau_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv2di->do_not_print = 1;sym___builtin_neon_vsrau_nv2di->locus = builtins_locus;
@@ -9841,6 +10735,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv2si"));
 sym___builtin_neon_vsrau_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv2si->do_not_print = 1;sym___builtin_neon_vsrau_nv2si->locus = builtins_locus;
@@ -9853,6 +10748,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv4hi"));
 sym___builtin_neon_vsrau_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv4hi->do_not_print = 1;sym___builtin_neon_vsrau_nv4hi->locus = builtins_locus;
@@ -9865,6 +10761,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv4si"));
 sym___builtin_neon_vsrau_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv4si->do_not_print = 1;sym___builtin_neon_vsrau_nv4si->locus = builtins_locus;
@@ -9877,6 +10774,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv8hi"));
 sym___builtin_neon_vsrau_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv8hi->do_not_print = 1;sym___builtin_neon_vsrau_nv8hi->locus = builtins_locus;
@@ -9889,6 +10787,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsrau_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsrau_nv8qi"));
 sym___builtin_neon_vsrau_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsrau_nv8qi->do_not_print = 1;sym___builtin_neon_vsrau_nv8qi->locus = builtins_locus;
@@ -9901,6 +10800,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsrau_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_ndi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_ndi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_ndi"));
 sym___builtin_neon_vsri_ndi->kind = SK_FUNCTION;sym___builtin_neon_vsri_ndi->do_not_print = 1;sym___builtin_neon_vsri_ndi->locus = builtins_locus;
@@ -9913,6 +10813,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_ndi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv16qi"));
 sym___builtin_neon_vsri_nv16qi->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv16qi->do_not_print = 1;sym___builtin_neon_vsri_nv16qi->locus = builtins_locus;
@@ -9925,6 +10826,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv2di"));
 sym___builtin_neon_vsri_nv2di->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv2di->do_not_print = 1;sym___builtin_neon_vsri_nv2di->locus = builtins_locus;
@@ -9937,6 +10839,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv2si"));
 sym___builtin_neon_vsri_nv2si->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv2si->do_not_print = 1;sym___builtin_neon_vsri_nv2si->locus = builtins_locus;
@@ -9949,6 +10852,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv4hi"));
 sym___builtin_neon_vsri_nv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv4hi->do_not_print = 1;sym___builtin_neon_vsri_nv4hi->locus = builtins_locus;
@@ -9961,6 +10865,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv4si"));
 sym___builtin_neon_vsri_nv4si->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv4si->do_not_print = 1;sym___builtin_neon_vsri_nv4si->locus = builtins_locus;
@@ -9973,6 +10878,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv8hi"));
 sym___builtin_neon_vsri_nv8hi->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv8hi->do_not_print = 1;sym___builtin_neon_vsri_nv8hi->locus = builtins_locus;
@@ -9985,6 +10891,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsri_nv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsri_nv8qi"));
 sym___builtin_neon_vsri_nv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsri_nv8qi->do_not_print = 1;sym___builtin_neon_vsri_nv8qi->locus = builtins_locus;
@@ -9997,6 +10904,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsri_nv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1di"));
 sym___builtin_neon_vst1di->kind = SK_FUNCTION;sym___builtin_neon_vst1di->do_not_print = 1;sym___builtin_neon_vst1di->locus = builtins_locus;
@@ -10008,6 +10916,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanedi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanedi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanedi"));
 sym___builtin_neon_vst1_lanedi->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanedi->do_not_print = 1;sym___builtin_neon_vst1_lanedi->locus = builtins_locus;
@@ -10020,6 +10929,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanedi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev16qi"));
 sym___builtin_neon_vst1_lanev16qi->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev16qi->do_not_print = 1;sym___builtin_neon_vst1_lanev16qi->locus = builtins_locus;
@@ -10032,6 +10942,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev2di"));
 sym___builtin_neon_vst1_lanev2di->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev2di->do_not_print = 1;sym___builtin_neon_vst1_lanev2di->locus = builtins_locus;
@@ -10044,6 +10955,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev2sf"));
 sym___builtin_neon_vst1_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev2sf->do_not_print = 1;sym___builtin_neon_vst1_lanev2sf->locus = builtins_locus;
@@ -10056,6 +10968,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev2si"));
 sym___builtin_neon_vst1_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev2si->do_not_print = 1;sym___builtin_neon_vst1_lanev2si->locus = builtins_locus;
@@ -10068,6 +10981,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev4hi"));
 sym___builtin_neon_vst1_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev4hi->do_not_print = 1;sym___builtin_neon_vst1_lanev4hi->locus = builtins_locus;
@@ -10080,6 +10994,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev4sf"));
 sym___builtin_neon_vst1_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev4sf->do_not_print = 1;sym___builtin_neon_vst1_lanev4sf->locus = builtins_locus;
@@ -10092,6 +11007,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev4si"));
 sym___builtin_neon_vst1_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev4si->do_not_print = 1;sym___builtin_neon_vst1_lanev4si->locus = builtins_locus;
@@ -10104,6 +11020,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev8hi"));
 sym___builtin_neon_vst1_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev8hi->do_not_print = 1;sym___builtin_neon_vst1_lanev8hi->locus = builtins_locus;
@@ -10116,6 +11033,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1_lanev8qi"));
 sym___builtin_neon_vst1_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vst1_lanev8qi->do_not_print = 1;sym___builtin_neon_vst1_lanev8qi->locus = builtins_locus;
@@ -10128,6 +11046,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v16qi"));
 sym___builtin_neon_vst1v16qi->kind = SK_FUNCTION;sym___builtin_neon_vst1v16qi->do_not_print = 1;sym___builtin_neon_vst1v16qi->locus = builtins_locus;
@@ -10139,6 +11058,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v2di"));
 sym___builtin_neon_vst1v2di->kind = SK_FUNCTION;sym___builtin_neon_vst1v2di->do_not_print = 1;sym___builtin_neon_vst1v2di->locus = builtins_locus;
@@ -10150,6 +11070,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v2sf"));
 sym___builtin_neon_vst1v2sf->kind = SK_FUNCTION;sym___builtin_neon_vst1v2sf->do_not_print = 1;sym___builtin_neon_vst1v2sf->locus = builtins_locus;
@@ -10161,6 +11082,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v2si"));
 sym___builtin_neon_vst1v2si->kind = SK_FUNCTION;sym___builtin_neon_vst1v2si->do_not_print = 1;sym___builtin_neon_vst1v2si->locus = builtins_locus;
@@ -10172,6 +11094,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v4hi"));
 sym___builtin_neon_vst1v4hi->kind = SK_FUNCTION;sym___builtin_neon_vst1v4hi->do_not_print = 1;sym___builtin_neon_vst1v4hi->locus = builtins_locus;
@@ -10183,6 +11106,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v4sf"));
 sym___builtin_neon_vst1v4sf->kind = SK_FUNCTION;sym___builtin_neon_vst1v4sf->do_not_print = 1;sym___builtin_neon_vst1v4sf->locus = builtins_locus;
@@ -10194,6 +11118,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v4si"));
 sym___builtin_neon_vst1v4si->kind = SK_FUNCTION;sym___builtin_neon_vst1v4si->do_not_print = 1;sym___builtin_neon_vst1v4si->locus = builtins_locus;
@@ -10205,6 +11130,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v8hi"));
 sym___builtin_neon_vst1v8hi->kind = SK_FUNCTION;sym___builtin_neon_vst1v8hi->do_not_print = 1;sym___builtin_neon_vst1v8hi->locus = builtins_locus;
@@ -10216,6 +11142,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst1v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst1v8qi"));
 sym___builtin_neon_vst1v8qi->kind = SK_FUNCTION;sym___builtin_neon_vst1v8qi->do_not_print = 1;sym___builtin_neon_vst1v8qi->locus = builtins_locus;
@@ -10227,6 +11154,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst1v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2di"));
 sym___builtin_neon_vst2di->kind = SK_FUNCTION;sym___builtin_neon_vst2di->do_not_print = 1;sym___builtin_neon_vst2di->locus = builtins_locus;
@@ -10238,6 +11166,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev2sf"));
 sym___builtin_neon_vst2_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev2sf->do_not_print = 1;sym___builtin_neon_vst2_lanev2sf->locus = builtins_locus;
@@ -10250,6 +11179,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev2si"));
 sym___builtin_neon_vst2_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev2si->do_not_print = 1;sym___builtin_neon_vst2_lanev2si->locus = builtins_locus;
@@ -10262,6 +11192,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev4hi"));
 sym___builtin_neon_vst2_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev4hi->do_not_print = 1;sym___builtin_neon_vst2_lanev4hi->locus = builtins_locus;
@@ -10274,6 +11205,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev4sf"));
 sym___builtin_neon_vst2_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev4sf->do_not_print = 1;sym___builtin_neon_vst2_lanev4sf->locus = builtins_locus;
@@ -10286,6 +11218,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev4si"));
 sym___builtin_neon_vst2_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev4si->do_not_print = 1;sym___builtin_neon_vst2_lanev4si->locus = builtins_locus;
@@ -10298,6 +11231,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev8hi"));
 sym___builtin_neon_vst2_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev8hi->do_not_print = 1;sym___builtin_neon_vst2_lanev8hi->locus = builtins_locus;
@@ -10310,6 +11244,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2_lanev8qi"));
 sym___builtin_neon_vst2_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vst2_lanev8qi->do_not_print = 1;sym___builtin_neon_vst2_lanev8qi->locus = builtins_locus;
@@ -10322,6 +11257,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v16qi"));
 sym___builtin_neon_vst2v16qi->kind = SK_FUNCTION;sym___builtin_neon_vst2v16qi->do_not_print = 1;sym___builtin_neon_vst2v16qi->locus = builtins_locus;
@@ -10333,6 +11269,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v2sf"));
 sym___builtin_neon_vst2v2sf->kind = SK_FUNCTION;sym___builtin_neon_vst2v2sf->do_not_print = 1;sym___builtin_neon_vst2v2sf->locus = builtins_locus;
@@ -10344,6 +11281,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v2si"));
 sym___builtin_neon_vst2v2si->kind = SK_FUNCTION;sym___builtin_neon_vst2v2si->do_not_print = 1;sym___builtin_neon_vst2v2si->locus = builtins_locus;
@@ -10355,6 +11293,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v4hi"));
 sym___builtin_neon_vst2v4hi->kind = SK_FUNCTION;sym___builtin_neon_vst2v4hi->do_not_print = 1;sym___builtin_neon_vst2v4hi->locus = builtins_locus;
@@ -10366,6 +11305,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v4sf"));
 sym___builtin_neon_vst2v4sf->kind = SK_FUNCTION;sym___builtin_neon_vst2v4sf->do_not_print = 1;sym___builtin_neon_vst2v4sf->locus = builtins_locus;
@@ -10377,6 +11317,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v4si"));
 sym___builtin_neon_vst2v4si->kind = SK_FUNCTION;sym___builtin_neon_vst2v4si->do_not_print = 1;sym___builtin_neon_vst2v4si->locus = builtins_locus;
@@ -10388,6 +11329,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v8hi"));
 sym___builtin_neon_vst2v8hi->kind = SK_FUNCTION;sym___builtin_neon_vst2v8hi->do_not_print = 1;sym___builtin_neon_vst2v8hi->locus = builtins_locus;
@@ -10399,6 +11341,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst2v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst2v8qi"));
 sym___builtin_neon_vst2v8qi->kind = SK_FUNCTION;sym___builtin_neon_vst2v8qi->do_not_print = 1;sym___builtin_neon_vst2v8qi->locus = builtins_locus;
@@ -10410,6 +11353,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst2v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3di"));
 sym___builtin_neon_vst3di->kind = SK_FUNCTION;sym___builtin_neon_vst3di->do_not_print = 1;sym___builtin_neon_vst3di->locus = builtins_locus;
@@ -10421,6 +11365,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev2sf"));
 sym___builtin_neon_vst3_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev2sf->do_not_print = 1;sym___builtin_neon_vst3_lanev2sf->locus = builtins_locus;
@@ -10433,6 +11378,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev2si"));
 sym___builtin_neon_vst3_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev2si->do_not_print = 1;sym___builtin_neon_vst3_lanev2si->locus = builtins_locus;
@@ -10445,6 +11391,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev4hi"));
 sym___builtin_neon_vst3_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev4hi->do_not_print = 1;sym___builtin_neon_vst3_lanev4hi->locus = builtins_locus;
@@ -10457,6 +11404,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev4sf"));
 sym___builtin_neon_vst3_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev4sf->do_not_print = 1;sym___builtin_neon_vst3_lanev4sf->locus = builtins_locus;
@@ -10469,6 +11417,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev4si"));
 sym___builtin_neon_vst3_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev4si->do_not_print = 1;sym___builtin_neon_vst3_lanev4si->locus = builtins_locus;
@@ -10481,6 +11430,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev8hi"));
 sym___builtin_neon_vst3_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev8hi->do_not_print = 1;sym___builtin_neon_vst3_lanev8hi->locus = builtins_locus;
@@ -10493,6 +11443,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3_lanev8qi"));
 sym___builtin_neon_vst3_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vst3_lanev8qi->do_not_print = 1;sym___builtin_neon_vst3_lanev8qi->locus = builtins_locus;
@@ -10505,6 +11456,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v16qi"));
 sym___builtin_neon_vst3v16qi->kind = SK_FUNCTION;sym___builtin_neon_vst3v16qi->do_not_print = 1;sym___builtin_neon_vst3v16qi->locus = builtins_locus;
@@ -10516,6 +11468,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v2sf"));
 sym___builtin_neon_vst3v2sf->kind = SK_FUNCTION;sym___builtin_neon_vst3v2sf->do_not_print = 1;sym___builtin_neon_vst3v2sf->locus = builtins_locus;
@@ -10527,6 +11480,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v2si"));
 sym___builtin_neon_vst3v2si->kind = SK_FUNCTION;sym___builtin_neon_vst3v2si->do_not_print = 1;sym___builtin_neon_vst3v2si->locus = builtins_locus;
@@ -10538,6 +11492,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v4hi"));
 sym___builtin_neon_vst3v4hi->kind = SK_FUNCTION;sym___builtin_neon_vst3v4hi->do_not_print = 1;sym___builtin_neon_vst3v4hi->locus = builtins_locus;
@@ -10549,6 +11504,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v4sf"));
 sym___builtin_neon_vst3v4sf->kind = SK_FUNCTION;sym___builtin_neon_vst3v4sf->do_not_print = 1;sym___builtin_neon_vst3v4sf->locus = builtins_locus;
@@ -10560,6 +11516,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v4si"));
 sym___builtin_neon_vst3v4si->kind = SK_FUNCTION;sym___builtin_neon_vst3v4si->do_not_print = 1;sym___builtin_neon_vst3v4si->locus = builtins_locus;
@@ -10571,6 +11528,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v8hi"));
 sym___builtin_neon_vst3v8hi->kind = SK_FUNCTION;sym___builtin_neon_vst3v8hi->do_not_print = 1;sym___builtin_neon_vst3v8hi->locus = builtins_locus;
@@ -10582,6 +11540,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst3v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst3v8qi"));
 sym___builtin_neon_vst3v8qi->kind = SK_FUNCTION;sym___builtin_neon_vst3v8qi->do_not_print = 1;sym___builtin_neon_vst3v8qi->locus = builtins_locus;
@@ -10593,6 +11552,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst3v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4di"));
 sym___builtin_neon_vst4di->kind = SK_FUNCTION;sym___builtin_neon_vst4di->do_not_print = 1;sym___builtin_neon_vst4di->locus = builtins_locus;
@@ -10604,6 +11564,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev2sf"));
 sym___builtin_neon_vst4_lanev2sf->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev2sf->do_not_print = 1;sym___builtin_neon_vst4_lanev2sf->locus = builtins_locus;
@@ -10616,6 +11577,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev2si"));
 sym___builtin_neon_vst4_lanev2si->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev2si->do_not_print = 1;sym___builtin_neon_vst4_lanev2si->locus = builtins_locus;
@@ -10628,6 +11590,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev4hi"));
 sym___builtin_neon_vst4_lanev4hi->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev4hi->do_not_print = 1;sym___builtin_neon_vst4_lanev4hi->locus = builtins_locus;
@@ -10640,6 +11603,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev4sf"));
 sym___builtin_neon_vst4_lanev4sf->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev4sf->do_not_print = 1;sym___builtin_neon_vst4_lanev4sf->locus = builtins_locus;
@@ -10652,6 +11616,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev4si"));
 sym___builtin_neon_vst4_lanev4si->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev4si->do_not_print = 1;sym___builtin_neon_vst4_lanev4si->locus = builtins_locus;
@@ -10664,6 +11629,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev8hi"));
 sym___builtin_neon_vst4_lanev8hi->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev8hi->do_not_print = 1;sym___builtin_neon_vst4_lanev8hi->locus = builtins_locus;
@@ -10676,6 +11642,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4_lanev8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4_lanev8qi"));
 sym___builtin_neon_vst4_lanev8qi->kind = SK_FUNCTION;sym___builtin_neon_vst4_lanev8qi->do_not_print = 1;sym___builtin_neon_vst4_lanev8qi->locus = builtins_locus;
@@ -10688,6 +11655,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4_lanev8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v16qi"));
 sym___builtin_neon_vst4v16qi->kind = SK_FUNCTION;sym___builtin_neon_vst4v16qi->do_not_print = 1;sym___builtin_neon_vst4v16qi->locus = builtins_locus;
@@ -10699,6 +11667,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v2sf"));
 sym___builtin_neon_vst4v2sf->kind = SK_FUNCTION;sym___builtin_neon_vst4v2sf->do_not_print = 1;sym___builtin_neon_vst4v2sf->locus = builtins_locus;
@@ -10710,6 +11679,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v2si"));
 sym___builtin_neon_vst4v2si->kind = SK_FUNCTION;sym___builtin_neon_vst4v2si->do_not_print = 1;sym___builtin_neon_vst4v2si->locus = builtins_locus;
@@ -10721,6 +11691,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v4hi"));
 sym___builtin_neon_vst4v4hi->kind = SK_FUNCTION;sym___builtin_neon_vst4v4hi->do_not_print = 1;sym___builtin_neon_vst4v4hi->locus = builtins_locus;
@@ -10732,6 +11703,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v4sf"));
 sym___builtin_neon_vst4v4sf->kind = SK_FUNCTION;sym___builtin_neon_vst4v4sf->do_not_print = 1;sym___builtin_neon_vst4v4sf->locus = builtins_locus;
@@ -10743,6 +11715,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v4si"));
 sym___builtin_neon_vst4v4si->kind = SK_FUNCTION;sym___builtin_neon_vst4v4si->do_not_print = 1;sym___builtin_neon_vst4v4si->locus = builtins_locus;
@@ -10754,6 +11727,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v8hi"));
 sym___builtin_neon_vst4v8hi->kind = SK_FUNCTION;sym___builtin_neon_vst4v8hi->do_not_print = 1;sym___builtin_neon_vst4v8hi->locus = builtins_locus;
@@ -10765,6 +11739,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vst4v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vst4v8qi"));
 sym___builtin_neon_vst4v8qi->kind = SK_FUNCTION;sym___builtin_neon_vst4v8qi->do_not_print = 1;sym___builtin_neon_vst4v8qi->locus = builtins_locus;
@@ -10776,6 +11751,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vst4v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubhnv2di)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubhnv2di = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubhnv2di"));
 sym___builtin_neon_vsubhnv2di->kind = SK_FUNCTION;sym___builtin_neon_vsubhnv2di->do_not_print = 1;sym___builtin_neon_vsubhnv2di->locus = builtins_locus;
@@ -10787,6 +11763,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubhnv2di, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubhnv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubhnv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubhnv4si"));
 sym___builtin_neon_vsubhnv4si->kind = SK_FUNCTION;sym___builtin_neon_vsubhnv4si->do_not_print = 1;sym___builtin_neon_vsubhnv4si->locus = builtins_locus;
@@ -10798,6 +11775,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubhnv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubhnv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubhnv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubhnv8hi"));
 sym___builtin_neon_vsubhnv8hi->kind = SK_FUNCTION;sym___builtin_neon_vsubhnv8hi->do_not_print = 1;sym___builtin_neon_vsubhnv8hi->locus = builtins_locus;
@@ -10809,6 +11787,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubhnv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsublsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsublsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsublsv2si"));
 sym___builtin_neon_vsublsv2si->kind = SK_FUNCTION;sym___builtin_neon_vsublsv2si->do_not_print = 1;sym___builtin_neon_vsublsv2si->locus = builtins_locus;
@@ -10820,6 +11799,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsublsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsublsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsublsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsublsv4hi"));
 sym___builtin_neon_vsublsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsublsv4hi->do_not_print = 1;sym___builtin_neon_vsublsv4hi->locus = builtins_locus;
@@ -10831,6 +11811,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsublsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsublsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsublsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsublsv8qi"));
 sym___builtin_neon_vsublsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsublsv8qi->do_not_print = 1;sym___builtin_neon_vsublsv8qi->locus = builtins_locus;
@@ -10842,6 +11823,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsublsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubluv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubluv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubluv2si"));
 sym___builtin_neon_vsubluv2si->kind = SK_FUNCTION;sym___builtin_neon_vsubluv2si->do_not_print = 1;sym___builtin_neon_vsubluv2si->locus = builtins_locus;
@@ -10853,6 +11835,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubluv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubluv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubluv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubluv4hi"));
 sym___builtin_neon_vsubluv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsubluv4hi->do_not_print = 1;sym___builtin_neon_vsubluv4hi->locus = builtins_locus;
@@ -10864,6 +11847,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubluv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubluv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubluv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubluv8qi"));
 sym___builtin_neon_vsubluv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsubluv8qi->do_not_print = 1;sym___builtin_neon_vsubluv8qi->locus = builtins_locus;
@@ -10875,6 +11859,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubluv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubv2sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubv2sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubv2sf"));
 sym___builtin_neon_vsubv2sf->kind = SK_FUNCTION;sym___builtin_neon_vsubv2sf->do_not_print = 1;sym___builtin_neon_vsubv2sf->locus = builtins_locus;
@@ -10886,6 +11871,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubv2sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubv4sf)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubv4sf = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubv4sf"));
 sym___builtin_neon_vsubv4sf->kind = SK_FUNCTION;sym___builtin_neon_vsubv4sf->do_not_print = 1;sym___builtin_neon_vsubv4sf->locus = builtins_locus;
@@ -10897,6 +11883,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubv4sf, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwsv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubwsv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubwsv2si"));
 sym___builtin_neon_vsubwsv2si->kind = SK_FUNCTION;sym___builtin_neon_vsubwsv2si->do_not_print = 1;sym___builtin_neon_vsubwsv2si->locus = builtins_locus;
@@ -10908,6 +11895,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubwsv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwsv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubwsv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubwsv4hi"));
 sym___builtin_neon_vsubwsv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsubwsv4hi->do_not_print = 1;sym___builtin_neon_vsubwsv4hi->locus = builtins_locus;
@@ -10919,6 +11907,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubwsv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwsv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubwsv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubwsv8qi"));
 sym___builtin_neon_vsubwsv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsubwsv8qi->do_not_print = 1;sym___builtin_neon_vsubwsv8qi->locus = builtins_locus;
@@ -10930,6 +11919,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubwsv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwuv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubwuv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubwuv2si"));
 sym___builtin_neon_vsubwuv2si->kind = SK_FUNCTION;sym___builtin_neon_vsubwuv2si->do_not_print = 1;sym___builtin_neon_vsubwuv2si->locus = builtins_locus;
@@ -10941,6 +11931,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubwuv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwuv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubwuv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubwuv4hi"));
 sym___builtin_neon_vsubwuv4hi->kind = SK_FUNCTION;sym___builtin_neon_vsubwuv4hi->do_not_print = 1;sym___builtin_neon_vsubwuv4hi->locus = builtins_locus;
@@ -10952,6 +11943,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubwuv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwuv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vsubwuv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vsubwuv8qi"));
 sym___builtin_neon_vsubwuv8qi->kind = SK_FUNCTION;sym___builtin_neon_vsubwuv8qi->do_not_print = 1;sym___builtin_neon_vsubwuv8qi->locus = builtins_locus;
@@ -10963,6 +11955,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vsubwuv8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl1v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbl1v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbl1v8qi"));
 sym___builtin_neon_vtbl1v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbl1v8qi->do_not_print = 1;sym___builtin_neon_vtbl1v8qi->locus = builtins_locus;
@@ -10974,6 +11967,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbl1v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl2v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbl2v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbl2v8qi"));
 sym___builtin_neon_vtbl2v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbl2v8qi->do_not_print = 1;sym___builtin_neon_vtbl2v8qi->locus = builtins_locus;
@@ -10985,6 +11979,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbl2v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl3v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbl3v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbl3v8qi"));
 sym___builtin_neon_vtbl3v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbl3v8qi->do_not_print = 1;sym___builtin_neon_vtbl3v8qi->locus = builtins_locus;
@@ -10996,6 +11991,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbl3v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl4v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbl4v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbl4v8qi"));
 sym___builtin_neon_vtbl4v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbl4v8qi->do_not_print = 1;sym___builtin_neon_vtbl4v8qi->locus = builtins_locus;
@@ -11007,6 +12003,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbl4v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx1v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbx1v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbx1v8qi"));
 sym___builtin_neon_vtbx1v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbx1v8qi->do_not_print = 1;sym___builtin_neon_vtbx1v8qi->locus = builtins_locus;
@@ -11019,6 +12016,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbx1v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx2v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbx2v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbx2v8qi"));
 sym___builtin_neon_vtbx2v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbx2v8qi->do_not_print = 1;sym___builtin_neon_vtbx2v8qi->locus = builtins_locus;
@@ -11031,6 +12029,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbx2v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx3v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbx3v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbx3v8qi"));
 sym___builtin_neon_vtbx3v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbx3v8qi->do_not_print = 1;sym___builtin_neon_vtbx3v8qi->locus = builtins_locus;
@@ -11043,6 +12042,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbx3v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx4v8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtbx4v8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtbx4v8qi"));
 sym___builtin_neon_vtbx4v8qi->kind = SK_FUNCTION;sym___builtin_neon_vtbx4v8qi->do_not_print = 1;sym___builtin_neon_vtbx4v8qi->locus = builtins_locus;
@@ -11055,6 +12055,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtbx4v8qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv16qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtstv16qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtstv16qi"));
 sym___builtin_neon_vtstv16qi->kind = SK_FUNCTION;sym___builtin_neon_vtstv16qi->do_not_print = 1;sym___builtin_neon_vtstv16qi->locus = builtins_locus;
@@ -11066,6 +12067,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtstv16qi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv2si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtstv2si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtstv2si"));
 sym___builtin_neon_vtstv2si->kind = SK_FUNCTION;sym___builtin_neon_vtstv2si->do_not_print = 1;sym___builtin_neon_vtstv2si->locus = builtins_locus;
@@ -11077,6 +12079,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtstv2si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv4hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtstv4hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtstv4hi"));
 sym___builtin_neon_vtstv4hi->kind = SK_FUNCTION;sym___builtin_neon_vtstv4hi->do_not_print = 1;sym___builtin_neon_vtstv4hi->locus = builtins_locus;
@@ -11088,6 +12091,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtstv4hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv4si)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtstv4si = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtstv4si"));
 sym___builtin_neon_vtstv4si->kind = SK_FUNCTION;sym___builtin_neon_vtstv4si->do_not_print = 1;sym___builtin_neon_vtstv4si->locus = builtins_locus;
@@ -11099,6 +12103,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtstv4si, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv8hi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtstv8hi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtstv8hi"));
 sym___builtin_neon_vtstv8hi->kind = SK_FUNCTION;sym___builtin_neon_vtstv8hi->do_not_print = 1;sym___builtin_neon_vtstv8hi->locus = builtins_locus;
@@ -11110,6 +12115,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtstv8hi, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv8qi)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_neon_vtstv8qi = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_neon_vtstv8qi"));
 sym___builtin_neon_vtstv8qi->kind = SK_FUNCTION;sym___builtin_neon_vtstv8qi->do_not_print = 1;sym___builtin_neon_vtstv8qi->locus = builtins_locus;
@@ -11121,3 +12127,1012 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_neon_vtstv8qi, 1);
 }
+static lazy_symbol_t LAZY_BUILTINS_TABLE[] =
+{
+{ "__builtin_neon_vabalsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabalsv2si) },
+{ "__builtin_neon_vabalsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabalsv4hi) },
+{ "__builtin_neon_vabalsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabalsv8qi) },
+{ "__builtin_neon_vabaluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabaluv2si) },
+{ "__builtin_neon_vabaluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabaluv4hi) },
+{ "__builtin_neon_vabaluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabaluv8qi) },
+{ "__builtin_neon_vabasv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv16qi) },
+{ "__builtin_neon_vabasv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv2si) },
+{ "__builtin_neon_vabasv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv4hi) },
+{ "__builtin_neon_vabasv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv4si) },
+{ "__builtin_neon_vabasv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv8hi) },
+{ "__builtin_neon_vabasv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabasv8qi) },
+{ "__builtin_neon_vabauv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv16qi) },
+{ "__builtin_neon_vabauv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv2si) },
+{ "__builtin_neon_vabauv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv4hi) },
+{ "__builtin_neon_vabauv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv4si) },
+{ "__builtin_neon_vabauv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv8hi) },
+{ "__builtin_neon_vabauv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabauv8qi) },
+{ "__builtin_neon_vabdfv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdfv2sf) },
+{ "__builtin_neon_vabdfv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdfv4sf) },
+{ "__builtin_neon_vabdlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdlsv2si) },
+{ "__builtin_neon_vabdlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdlsv4hi) },
+{ "__builtin_neon_vabdlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdlsv8qi) },
+{ "__builtin_neon_vabdluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdluv2si) },
+{ "__builtin_neon_vabdluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdluv4hi) },
+{ "__builtin_neon_vabdluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdluv8qi) },
+{ "__builtin_neon_vabdsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv16qi) },
+{ "__builtin_neon_vabdsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv2si) },
+{ "__builtin_neon_vabdsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv4hi) },
+{ "__builtin_neon_vabdsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv4si) },
+{ "__builtin_neon_vabdsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv8hi) },
+{ "__builtin_neon_vabdsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabdsv8qi) },
+{ "__builtin_neon_vabduv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv16qi) },
+{ "__builtin_neon_vabduv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv2si) },
+{ "__builtin_neon_vabduv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv4hi) },
+{ "__builtin_neon_vabduv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv4si) },
+{ "__builtin_neon_vabduv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv8hi) },
+{ "__builtin_neon_vabduv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabduv8qi) },
+{ "__builtin_neon_vabsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv16qi) },
+{ "__builtin_neon_vabsv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv2sf) },
+{ "__builtin_neon_vabsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv2si) },
+{ "__builtin_neon_vabsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv4hi) },
+{ "__builtin_neon_vabsv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv4sf) },
+{ "__builtin_neon_vabsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv4si) },
+{ "__builtin_neon_vabsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv8hi) },
+{ "__builtin_neon_vabsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vabsv8qi) },
+{ "__builtin_neon_vaddhnv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddhnv2di) },
+{ "__builtin_neon_vaddhnv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddhnv4si) },
+{ "__builtin_neon_vaddhnv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddhnv8hi) },
+{ "__builtin_neon_vaddlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddlsv2si) },
+{ "__builtin_neon_vaddlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddlsv4hi) },
+{ "__builtin_neon_vaddlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddlsv8qi) },
+{ "__builtin_neon_vaddluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddluv2si) },
+{ "__builtin_neon_vaddluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddluv4hi) },
+{ "__builtin_neon_vaddluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddluv8qi) },
+{ "__builtin_neon_vaddv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddv2sf) },
+{ "__builtin_neon_vaddv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddv4sf) },
+{ "__builtin_neon_vaddwsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwsv2si) },
+{ "__builtin_neon_vaddwsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwsv4hi) },
+{ "__builtin_neon_vaddwsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwsv8qi) },
+{ "__builtin_neon_vaddwuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwuv2si) },
+{ "__builtin_neon_vaddwuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwuv4hi) },
+{ "__builtin_neon_vaddwuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vaddwuv8qi) },
+{ "__builtin_neon_vbsldi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbsldi) },
+{ "__builtin_neon_vbslv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv16qi) },
+{ "__builtin_neon_vbslv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv2di) },
+{ "__builtin_neon_vbslv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv2sf) },
+{ "__builtin_neon_vbslv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv2si) },
+{ "__builtin_neon_vbslv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv4hi) },
+{ "__builtin_neon_vbslv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv4sf) },
+{ "__builtin_neon_vbslv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv4si) },
+{ "__builtin_neon_vbslv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv8hi) },
+{ "__builtin_neon_vbslv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vbslv8qi) },
+{ "__builtin_neon_vcagev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagev2sf) },
+{ "__builtin_neon_vcagev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagev4sf) },
+{ "__builtin_neon_vcagtv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagtv2sf) },
+{ "__builtin_neon_vcagtv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcagtv4sf) },
+{ "__builtin_neon_vceqv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv16qi) },
+{ "__builtin_neon_vceqv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv2sf) },
+{ "__builtin_neon_vceqv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv2si) },
+{ "__builtin_neon_vceqv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv4hi) },
+{ "__builtin_neon_vceqv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv4sf) },
+{ "__builtin_neon_vceqv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv4si) },
+{ "__builtin_neon_vceqv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv8hi) },
+{ "__builtin_neon_vceqv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vceqv8qi) },
+{ "__builtin_neon_vcgeuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv16qi) },
+{ "__builtin_neon_vcgeuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv2si) },
+{ "__builtin_neon_vcgeuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv4hi) },
+{ "__builtin_neon_vcgeuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv4si) },
+{ "__builtin_neon_vcgeuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv8hi) },
+{ "__builtin_neon_vcgeuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgeuv8qi) },
+{ "__builtin_neon_vcgev16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev16qi) },
+{ "__builtin_neon_vcgev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev2sf) },
+{ "__builtin_neon_vcgev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev2si) },
+{ "__builtin_neon_vcgev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev4hi) },
+{ "__builtin_neon_vcgev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev4sf) },
+{ "__builtin_neon_vcgev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev4si) },
+{ "__builtin_neon_vcgev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev8hi) },
+{ "__builtin_neon_vcgev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgev8qi) },
+{ "__builtin_neon_vcgtuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv16qi) },
+{ "__builtin_neon_vcgtuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv2si) },
+{ "__builtin_neon_vcgtuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv4hi) },
+{ "__builtin_neon_vcgtuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv4si) },
+{ "__builtin_neon_vcgtuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv8hi) },
+{ "__builtin_neon_vcgtuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtuv8qi) },
+{ "__builtin_neon_vcgtv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv16qi) },
+{ "__builtin_neon_vcgtv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv2sf) },
+{ "__builtin_neon_vcgtv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv2si) },
+{ "__builtin_neon_vcgtv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv4hi) },
+{ "__builtin_neon_vcgtv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv4sf) },
+{ "__builtin_neon_vcgtv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv4si) },
+{ "__builtin_neon_vcgtv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv8hi) },
+{ "__builtin_neon_vcgtv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcgtv8qi) },
+{ "__builtin_neon_vclsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv16qi) },
+{ "__builtin_neon_vclsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv2si) },
+{ "__builtin_neon_vclsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv4hi) },
+{ "__builtin_neon_vclsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv4si) },
+{ "__builtin_neon_vclsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv8hi) },
+{ "__builtin_neon_vclsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclsv8qi) },
+{ "__builtin_neon_vclzv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv16qi) },
+{ "__builtin_neon_vclzv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv2si) },
+{ "__builtin_neon_vclzv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv4hi) },
+{ "__builtin_neon_vclzv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv4si) },
+{ "__builtin_neon_vclzv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv8hi) },
+{ "__builtin_neon_vclzv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vclzv8qi) },
+{ "__builtin_neon_vcntv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcntv16qi) },
+{ "__builtin_neon_vcntv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcntv8qi) },
+{ "__builtin_neon_vcombinedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinedi) },
+{ "__builtin_neon_vcombinev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev2sf) },
+{ "__builtin_neon_vcombinev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev2si) },
+{ "__builtin_neon_vcombinev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev4hi) },
+{ "__builtin_neon_vcombinev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcombinev8qi) },
+{ "__builtin_neon_vcreatedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatedi) },
+{ "__builtin_neon_vcreatev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev2sf) },
+{ "__builtin_neon_vcreatev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev2si) },
+{ "__builtin_neon_vcreatev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev4hi) },
+{ "__builtin_neon_vcreatev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcreatev8qi) },
+{ "__builtin_neon_vcvts_nv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv2sf) },
+{ "__builtin_neon_vcvts_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv2si) },
+{ "__builtin_neon_vcvts_nv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv4sf) },
+{ "__builtin_neon_vcvts_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvts_nv4si) },
+{ "__builtin_neon_vcvtsv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv2sf) },
+{ "__builtin_neon_vcvtsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv2si) },
+{ "__builtin_neon_vcvtsv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv4sf) },
+{ "__builtin_neon_vcvtsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtsv4si) },
+{ "__builtin_neon_vcvtu_nv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv2sf) },
+{ "__builtin_neon_vcvtu_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv2si) },
+{ "__builtin_neon_vcvtu_nv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv4sf) },
+{ "__builtin_neon_vcvtu_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtu_nv4si) },
+{ "__builtin_neon_vcvtuv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv2sf) },
+{ "__builtin_neon_vcvtuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv2si) },
+{ "__builtin_neon_vcvtuv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv4sf) },
+{ "__builtin_neon_vcvtuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vcvtuv4si) },
+{ "__builtin_neon_vdup_lanedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanedi) },
+{ "__builtin_neon_vdup_lanev16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev16qi) },
+{ "__builtin_neon_vdup_lanev2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev2di) },
+{ "__builtin_neon_vdup_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev2sf) },
+{ "__builtin_neon_vdup_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev2si) },
+{ "__builtin_neon_vdup_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev4hi) },
+{ "__builtin_neon_vdup_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev4sf) },
+{ "__builtin_neon_vdup_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev4si) },
+{ "__builtin_neon_vdup_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev8hi) },
+{ "__builtin_neon_vdup_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_lanev8qi) },
+{ "__builtin_neon_vdup_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_ndi) },
+{ "__builtin_neon_vdup_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv16qi) },
+{ "__builtin_neon_vdup_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv2di) },
+{ "__builtin_neon_vdup_nv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv2sf) },
+{ "__builtin_neon_vdup_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv2si) },
+{ "__builtin_neon_vdup_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv4hi) },
+{ "__builtin_neon_vdup_nv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv4sf) },
+{ "__builtin_neon_vdup_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv4si) },
+{ "__builtin_neon_vdup_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv8hi) },
+{ "__builtin_neon_vdup_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vdup_nv8qi) },
+{ "__builtin_neon_vextdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextdi) },
+{ "__builtin_neon_vextv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv16qi) },
+{ "__builtin_neon_vextv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv2di) },
+{ "__builtin_neon_vextv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv2sf) },
+{ "__builtin_neon_vextv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv2si) },
+{ "__builtin_neon_vextv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv4hi) },
+{ "__builtin_neon_vextv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv4sf) },
+{ "__builtin_neon_vextv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv4si) },
+{ "__builtin_neon_vextv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv8hi) },
+{ "__builtin_neon_vextv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vextv8qi) },
+{ "__builtin_neon_vget_highv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv16qi) },
+{ "__builtin_neon_vget_highv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv2di) },
+{ "__builtin_neon_vget_highv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv4sf) },
+{ "__builtin_neon_vget_highv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv4si) },
+{ "__builtin_neon_vget_highv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_highv8hi) },
+{ "__builtin_neon_vget_lanedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanedi) },
+{ "__builtin_neon_vget_laneuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv16qi) },
+{ "__builtin_neon_vget_laneuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv2si) },
+{ "__builtin_neon_vget_laneuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv4hi) },
+{ "__builtin_neon_vget_laneuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv4si) },
+{ "__builtin_neon_vget_laneuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv8hi) },
+{ "__builtin_neon_vget_laneuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_laneuv8qi) },
+{ "__builtin_neon_vget_lanev16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev16qi) },
+{ "__builtin_neon_vget_lanev2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev2di) },
+{ "__builtin_neon_vget_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev2sf) },
+{ "__builtin_neon_vget_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev2si) },
+{ "__builtin_neon_vget_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev4hi) },
+{ "__builtin_neon_vget_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev4sf) },
+{ "__builtin_neon_vget_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev4si) },
+{ "__builtin_neon_vget_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev8hi) },
+{ "__builtin_neon_vget_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lanev8qi) },
+{ "__builtin_neon_vget_lowv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv16qi) },
+{ "__builtin_neon_vget_lowv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv2di) },
+{ "__builtin_neon_vget_lowv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv4sf) },
+{ "__builtin_neon_vget_lowv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv4si) },
+{ "__builtin_neon_vget_lowv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vget_lowv8hi) },
+{ "__builtin_neon_vhaddsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv16qi) },
+{ "__builtin_neon_vhaddsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv2si) },
+{ "__builtin_neon_vhaddsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv4hi) },
+{ "__builtin_neon_vhaddsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv4si) },
+{ "__builtin_neon_vhaddsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv8hi) },
+{ "__builtin_neon_vhaddsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhaddsv8qi) },
+{ "__builtin_neon_vhadduv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv16qi) },
+{ "__builtin_neon_vhadduv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv2si) },
+{ "__builtin_neon_vhadduv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv4hi) },
+{ "__builtin_neon_vhadduv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv4si) },
+{ "__builtin_neon_vhadduv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv8hi) },
+{ "__builtin_neon_vhadduv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhadduv8qi) },
+{ "__builtin_neon_vhsubsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv16qi) },
+{ "__builtin_neon_vhsubsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv2si) },
+{ "__builtin_neon_vhsubsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv4hi) },
+{ "__builtin_neon_vhsubsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv4si) },
+{ "__builtin_neon_vhsubsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv8hi) },
+{ "__builtin_neon_vhsubsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubsv8qi) },
+{ "__builtin_neon_vhsubuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv16qi) },
+{ "__builtin_neon_vhsubuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv2si) },
+{ "__builtin_neon_vhsubuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv4hi) },
+{ "__builtin_neon_vhsubuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv4si) },
+{ "__builtin_neon_vhsubuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv8hi) },
+{ "__builtin_neon_vhsubuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vhsubuv8qi) },
+{ "__builtin_neon_vld1di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1di) },
+{ "__builtin_neon_vld1_dupdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupdi) },
+{ "__builtin_neon_vld1_dupv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv16qi) },
+{ "__builtin_neon_vld1_dupv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv2di) },
+{ "__builtin_neon_vld1_dupv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv2sf) },
+{ "__builtin_neon_vld1_dupv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv2si) },
+{ "__builtin_neon_vld1_dupv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv4hi) },
+{ "__builtin_neon_vld1_dupv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv4sf) },
+{ "__builtin_neon_vld1_dupv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv4si) },
+{ "__builtin_neon_vld1_dupv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv8hi) },
+{ "__builtin_neon_vld1_dupv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_dupv8qi) },
+{ "__builtin_neon_vld1_lanedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanedi) },
+{ "__builtin_neon_vld1_lanev16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev16qi) },
+{ "__builtin_neon_vld1_lanev2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev2di) },
+{ "__builtin_neon_vld1_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev2sf) },
+{ "__builtin_neon_vld1_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev2si) },
+{ "__builtin_neon_vld1_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev4hi) },
+{ "__builtin_neon_vld1_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev4sf) },
+{ "__builtin_neon_vld1_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev4si) },
+{ "__builtin_neon_vld1_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev8hi) },
+{ "__builtin_neon_vld1_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1_lanev8qi) },
+{ "__builtin_neon_vld1v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v16qi) },
+{ "__builtin_neon_vld1v2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v2di) },
+{ "__builtin_neon_vld1v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v2sf) },
+{ "__builtin_neon_vld1v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v2si) },
+{ "__builtin_neon_vld1v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v4hi) },
+{ "__builtin_neon_vld1v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v4sf) },
+{ "__builtin_neon_vld1v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v4si) },
+{ "__builtin_neon_vld1v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v8hi) },
+{ "__builtin_neon_vld1v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld1v8qi) },
+{ "__builtin_neon_vld2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2di) },
+{ "__builtin_neon_vld2_dupdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupdi) },
+{ "__builtin_neon_vld2_dupv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv2sf) },
+{ "__builtin_neon_vld2_dupv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv2si) },
+{ "__builtin_neon_vld2_dupv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv4hi) },
+{ "__builtin_neon_vld2_dupv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_dupv8qi) },
+{ "__builtin_neon_vld2_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev2sf) },
+{ "__builtin_neon_vld2_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev2si) },
+{ "__builtin_neon_vld2_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev4hi) },
+{ "__builtin_neon_vld2_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev4sf) },
+{ "__builtin_neon_vld2_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev4si) },
+{ "__builtin_neon_vld2_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev8hi) },
+{ "__builtin_neon_vld2_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2_lanev8qi) },
+{ "__builtin_neon_vld2v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v16qi) },
+{ "__builtin_neon_vld2v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v2sf) },
+{ "__builtin_neon_vld2v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v2si) },
+{ "__builtin_neon_vld2v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v4hi) },
+{ "__builtin_neon_vld2v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v4sf) },
+{ "__builtin_neon_vld2v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v4si) },
+{ "__builtin_neon_vld2v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v8hi) },
+{ "__builtin_neon_vld2v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld2v8qi) },
+{ "__builtin_neon_vld3di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3di) },
+{ "__builtin_neon_vld3_dupdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupdi) },
+{ "__builtin_neon_vld3_dupv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv2sf) },
+{ "__builtin_neon_vld3_dupv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv2si) },
+{ "__builtin_neon_vld3_dupv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv4hi) },
+{ "__builtin_neon_vld3_dupv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_dupv8qi) },
+{ "__builtin_neon_vld3_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev2sf) },
+{ "__builtin_neon_vld3_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev2si) },
+{ "__builtin_neon_vld3_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev4hi) },
+{ "__builtin_neon_vld3_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev4sf) },
+{ "__builtin_neon_vld3_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev4si) },
+{ "__builtin_neon_vld3_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev8hi) },
+{ "__builtin_neon_vld3_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3_lanev8qi) },
+{ "__builtin_neon_vld3v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v16qi) },
+{ "__builtin_neon_vld3v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v2sf) },
+{ "__builtin_neon_vld3v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v2si) },
+{ "__builtin_neon_vld3v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v4hi) },
+{ "__builtin_neon_vld3v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v4sf) },
+{ "__builtin_neon_vld3v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v4si) },
+{ "__builtin_neon_vld3v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v8hi) },
+{ "__builtin_neon_vld3v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld3v8qi) },
+{ "__builtin_neon_vld4di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4di) },
+{ "__builtin_neon_vld4_dupdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupdi) },
+{ "__builtin_neon_vld4_dupv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv2sf) },
+{ "__builtin_neon_vld4_dupv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv2si) },
+{ "__builtin_neon_vld4_dupv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv4hi) },
+{ "__builtin_neon_vld4_dupv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_dupv8qi) },
+{ "__builtin_neon_vld4_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev2sf) },
+{ "__builtin_neon_vld4_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev2si) },
+{ "__builtin_neon_vld4_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev4hi) },
+{ "__builtin_neon_vld4_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev4sf) },
+{ "__builtin_neon_vld4_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev4si) },
+{ "__builtin_neon_vld4_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev8hi) },
+{ "__builtin_neon_vld4_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4_lanev8qi) },
+{ "__builtin_neon_vld4v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v16qi) },
+{ "__builtin_neon_vld4v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v2sf) },
+{ "__builtin_neon_vld4v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v2si) },
+{ "__builtin_neon_vld4v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v4hi) },
+{ "__builtin_neon_vld4v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v4sf) },
+{ "__builtin_neon_vld4v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v4si) },
+{ "__builtin_neon_vld4v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v8hi) },
+{ "__builtin_neon_vld4v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vld4v8qi) },
+{ "__builtin_neon_vmaxfv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxfv2sf) },
+{ "__builtin_neon_vmaxfv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxfv4sf) },
+{ "__builtin_neon_vmaxsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv16qi) },
+{ "__builtin_neon_vmaxsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv2si) },
+{ "__builtin_neon_vmaxsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv4hi) },
+{ "__builtin_neon_vmaxsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv4si) },
+{ "__builtin_neon_vmaxsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv8hi) },
+{ "__builtin_neon_vmaxsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxsv8qi) },
+{ "__builtin_neon_vmaxuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv16qi) },
+{ "__builtin_neon_vmaxuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv2si) },
+{ "__builtin_neon_vmaxuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv4hi) },
+{ "__builtin_neon_vmaxuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv4si) },
+{ "__builtin_neon_vmaxuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv8hi) },
+{ "__builtin_neon_vmaxuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmaxuv8qi) },
+{ "__builtin_neon_vminfv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminfv2sf) },
+{ "__builtin_neon_vminfv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminfv4sf) },
+{ "__builtin_neon_vminsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv16qi) },
+{ "__builtin_neon_vminsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv2si) },
+{ "__builtin_neon_vminsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv4hi) },
+{ "__builtin_neon_vminsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv4si) },
+{ "__builtin_neon_vminsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv8hi) },
+{ "__builtin_neon_vminsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminsv8qi) },
+{ "__builtin_neon_vminuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv16qi) },
+{ "__builtin_neon_vminuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv2si) },
+{ "__builtin_neon_vminuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv4hi) },
+{ "__builtin_neon_vminuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv4si) },
+{ "__builtin_neon_vminuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv8hi) },
+{ "__builtin_neon_vminuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vminuv8qi) },
+{ "__builtin_neon_vmla_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev2sf) },
+{ "__builtin_neon_vmla_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev2si) },
+{ "__builtin_neon_vmla_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev4hi) },
+{ "__builtin_neon_vmla_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev4sf) },
+{ "__builtin_neon_vmla_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev4si) },
+{ "__builtin_neon_vmla_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_lanev8hi) },
+{ "__builtin_neon_vmlals_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_lanev2si) },
+{ "__builtin_neon_vmlals_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_lanev4hi) },
+{ "__builtin_neon_vmlals_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_nv2si) },
+{ "__builtin_neon_vmlals_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlals_nv4hi) },
+{ "__builtin_neon_vmlalsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalsv2si) },
+{ "__builtin_neon_vmlalsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalsv4hi) },
+{ "__builtin_neon_vmlalsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalsv8qi) },
+{ "__builtin_neon_vmlalu_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_lanev2si) },
+{ "__builtin_neon_vmlalu_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_lanev4hi) },
+{ "__builtin_neon_vmlalu_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_nv2si) },
+{ "__builtin_neon_vmlalu_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlalu_nv4hi) },
+{ "__builtin_neon_vmlaluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlaluv2si) },
+{ "__builtin_neon_vmlaluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlaluv4hi) },
+{ "__builtin_neon_vmlaluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlaluv8qi) },
+{ "__builtin_neon_vmla_nv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv2sf) },
+{ "__builtin_neon_vmla_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv2si) },
+{ "__builtin_neon_vmla_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv4hi) },
+{ "__builtin_neon_vmla_nv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv4sf) },
+{ "__builtin_neon_vmla_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv4si) },
+{ "__builtin_neon_vmla_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmla_nv8hi) },
+{ "__builtin_neon_vmlav16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav16qi) },
+{ "__builtin_neon_vmlav2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav2sf) },
+{ "__builtin_neon_vmlav2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav2si) },
+{ "__builtin_neon_vmlav4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav4hi) },
+{ "__builtin_neon_vmlav4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav4sf) },
+{ "__builtin_neon_vmlav4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav4si) },
+{ "__builtin_neon_vmlav8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav8hi) },
+{ "__builtin_neon_vmlav8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlav8qi) },
+{ "__builtin_neon_vmls_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev2sf) },
+{ "__builtin_neon_vmls_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev2si) },
+{ "__builtin_neon_vmls_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev4hi) },
+{ "__builtin_neon_vmls_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev4sf) },
+{ "__builtin_neon_vmls_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev4si) },
+{ "__builtin_neon_vmls_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_lanev8hi) },
+{ "__builtin_neon_vmlsls_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_lanev2si) },
+{ "__builtin_neon_vmlsls_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_lanev4hi) },
+{ "__builtin_neon_vmlsls_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_nv2si) },
+{ "__builtin_neon_vmlsls_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsls_nv4hi) },
+{ "__builtin_neon_vmlslsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslsv2si) },
+{ "__builtin_neon_vmlslsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslsv4hi) },
+{ "__builtin_neon_vmlslsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslsv8qi) },
+{ "__builtin_neon_vmlslu_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_lanev2si) },
+{ "__builtin_neon_vmlslu_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_lanev4hi) },
+{ "__builtin_neon_vmlslu_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_nv2si) },
+{ "__builtin_neon_vmlslu_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlslu_nv4hi) },
+{ "__builtin_neon_vmlsluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsluv2si) },
+{ "__builtin_neon_vmlsluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsluv4hi) },
+{ "__builtin_neon_vmlsluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsluv8qi) },
+{ "__builtin_neon_vmls_nv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv2sf) },
+{ "__builtin_neon_vmls_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv2si) },
+{ "__builtin_neon_vmls_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv4hi) },
+{ "__builtin_neon_vmls_nv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv4sf) },
+{ "__builtin_neon_vmls_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv4si) },
+{ "__builtin_neon_vmls_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmls_nv8hi) },
+{ "__builtin_neon_vmlsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv16qi) },
+{ "__builtin_neon_vmlsv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv2sf) },
+{ "__builtin_neon_vmlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv2si) },
+{ "__builtin_neon_vmlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv4hi) },
+{ "__builtin_neon_vmlsv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv4sf) },
+{ "__builtin_neon_vmlsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv4si) },
+{ "__builtin_neon_vmlsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv8hi) },
+{ "__builtin_neon_vmlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmlsv8qi) },
+{ "__builtin_neon_vmovlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovlsv2si) },
+{ "__builtin_neon_vmovlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovlsv4hi) },
+{ "__builtin_neon_vmovlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovlsv8qi) },
+{ "__builtin_neon_vmovluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovluv2si) },
+{ "__builtin_neon_vmovluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovluv4hi) },
+{ "__builtin_neon_vmovluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovluv8qi) },
+{ "__builtin_neon_vmovnv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovnv2di) },
+{ "__builtin_neon_vmovnv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovnv4si) },
+{ "__builtin_neon_vmovnv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmovnv8hi) },
+{ "__builtin_neon_vmulfv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulfv2sf) },
+{ "__builtin_neon_vmulfv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulfv4sf) },
+{ "__builtin_neon_vmul_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev2sf) },
+{ "__builtin_neon_vmul_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev2si) },
+{ "__builtin_neon_vmul_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev4hi) },
+{ "__builtin_neon_vmul_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev4sf) },
+{ "__builtin_neon_vmul_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev4si) },
+{ "__builtin_neon_vmul_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_lanev8hi) },
+{ "__builtin_neon_vmullpv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullpv8qi) },
+{ "__builtin_neon_vmulls_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_lanev2si) },
+{ "__builtin_neon_vmulls_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_lanev4hi) },
+{ "__builtin_neon_vmulls_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_nv2si) },
+{ "__builtin_neon_vmulls_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulls_nv4hi) },
+{ "__builtin_neon_vmullsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullsv2si) },
+{ "__builtin_neon_vmullsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullsv4hi) },
+{ "__builtin_neon_vmullsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullsv8qi) },
+{ "__builtin_neon_vmullu_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_lanev2si) },
+{ "__builtin_neon_vmullu_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_lanev4hi) },
+{ "__builtin_neon_vmullu_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_nv2si) },
+{ "__builtin_neon_vmullu_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmullu_nv4hi) },
+{ "__builtin_neon_vmulluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulluv2si) },
+{ "__builtin_neon_vmulluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulluv4hi) },
+{ "__builtin_neon_vmulluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulluv8qi) },
+{ "__builtin_neon_vmul_nv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv2sf) },
+{ "__builtin_neon_vmul_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv2si) },
+{ "__builtin_neon_vmul_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv4hi) },
+{ "__builtin_neon_vmul_nv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv4sf) },
+{ "__builtin_neon_vmul_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv4si) },
+{ "__builtin_neon_vmul_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmul_nv8hi) },
+{ "__builtin_neon_vmulpv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulpv16qi) },
+{ "__builtin_neon_vmulpv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmulpv8qi) },
+{ "__builtin_neon_vmvnv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv16qi) },
+{ "__builtin_neon_vmvnv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv2si) },
+{ "__builtin_neon_vmvnv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv4hi) },
+{ "__builtin_neon_vmvnv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv4si) },
+{ "__builtin_neon_vmvnv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv8hi) },
+{ "__builtin_neon_vmvnv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vmvnv8qi) },
+{ "__builtin_neon_vnegv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv16qi) },
+{ "__builtin_neon_vnegv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv2sf) },
+{ "__builtin_neon_vnegv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv2si) },
+{ "__builtin_neon_vnegv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv4hi) },
+{ "__builtin_neon_vnegv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv4sf) },
+{ "__builtin_neon_vnegv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv4si) },
+{ "__builtin_neon_vnegv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv8hi) },
+{ "__builtin_neon_vnegv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vnegv8qi) },
+{ "__builtin_neon_vpadalsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv16qi) },
+{ "__builtin_neon_vpadalsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv2si) },
+{ "__builtin_neon_vpadalsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv4hi) },
+{ "__builtin_neon_vpadalsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv4si) },
+{ "__builtin_neon_vpadalsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv8hi) },
+{ "__builtin_neon_vpadalsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadalsv8qi) },
+{ "__builtin_neon_vpadaluv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv16qi) },
+{ "__builtin_neon_vpadaluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv2si) },
+{ "__builtin_neon_vpadaluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv4hi) },
+{ "__builtin_neon_vpadaluv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv4si) },
+{ "__builtin_neon_vpadaluv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv8hi) },
+{ "__builtin_neon_vpadaluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpadaluv8qi) },
+{ "__builtin_neon_vpaddlsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv16qi) },
+{ "__builtin_neon_vpaddlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv2si) },
+{ "__builtin_neon_vpaddlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv4hi) },
+{ "__builtin_neon_vpaddlsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv4si) },
+{ "__builtin_neon_vpaddlsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv8hi) },
+{ "__builtin_neon_vpaddlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddlsv8qi) },
+{ "__builtin_neon_vpaddluv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv16qi) },
+{ "__builtin_neon_vpaddluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv2si) },
+{ "__builtin_neon_vpaddluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv4hi) },
+{ "__builtin_neon_vpaddluv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv4si) },
+{ "__builtin_neon_vpaddluv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv8hi) },
+{ "__builtin_neon_vpaddluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddluv8qi) },
+{ "__builtin_neon_vpaddv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv2sf) },
+{ "__builtin_neon_vpaddv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv2si) },
+{ "__builtin_neon_vpaddv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv4hi) },
+{ "__builtin_neon_vpaddv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpaddv8qi) },
+{ "__builtin_neon_vpmaxfv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxfv2sf) },
+{ "__builtin_neon_vpmaxsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxsv2si) },
+{ "__builtin_neon_vpmaxsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxsv4hi) },
+{ "__builtin_neon_vpmaxsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxsv8qi) },
+{ "__builtin_neon_vpmaxuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxuv2si) },
+{ "__builtin_neon_vpmaxuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxuv4hi) },
+{ "__builtin_neon_vpmaxuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpmaxuv8qi) },
+{ "__builtin_neon_vpminfv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminfv2sf) },
+{ "__builtin_neon_vpminsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminsv2si) },
+{ "__builtin_neon_vpminsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminsv4hi) },
+{ "__builtin_neon_vpminsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminsv8qi) },
+{ "__builtin_neon_vpminuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminuv2si) },
+{ "__builtin_neon_vpminuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminuv4hi) },
+{ "__builtin_neon_vpminuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vpminuv8qi) },
+{ "__builtin_neon_vqabsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv16qi) },
+{ "__builtin_neon_vqabsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv2si) },
+{ "__builtin_neon_vqabsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv4hi) },
+{ "__builtin_neon_vqabsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv4si) },
+{ "__builtin_neon_vqabsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv8hi) },
+{ "__builtin_neon_vqabsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqabsv8qi) },
+{ "__builtin_neon_vqaddsdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsdi) },
+{ "__builtin_neon_vqaddsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv16qi) },
+{ "__builtin_neon_vqaddsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv2di) },
+{ "__builtin_neon_vqaddsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv2si) },
+{ "__builtin_neon_vqaddsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv4hi) },
+{ "__builtin_neon_vqaddsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv4si) },
+{ "__builtin_neon_vqaddsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv8hi) },
+{ "__builtin_neon_vqaddsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddsv8qi) },
+{ "__builtin_neon_vqaddudi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqaddudi) },
+{ "__builtin_neon_vqadduv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv16qi) },
+{ "__builtin_neon_vqadduv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv2di) },
+{ "__builtin_neon_vqadduv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv2si) },
+{ "__builtin_neon_vqadduv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv4hi) },
+{ "__builtin_neon_vqadduv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv4si) },
+{ "__builtin_neon_vqadduv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv8hi) },
+{ "__builtin_neon_vqadduv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqadduv8qi) },
+{ "__builtin_neon_vqdmlal_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_lanev2si) },
+{ "__builtin_neon_vqdmlal_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_lanev4hi) },
+{ "__builtin_neon_vqdmlal_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_nv2si) },
+{ "__builtin_neon_vqdmlal_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlal_nv4hi) },
+{ "__builtin_neon_vqdmlalv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlalv2si) },
+{ "__builtin_neon_vqdmlalv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlalv4hi) },
+{ "__builtin_neon_vqdmlsl_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_lanev2si) },
+{ "__builtin_neon_vqdmlsl_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_lanev4hi) },
+{ "__builtin_neon_vqdmlsl_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_nv2si) },
+{ "__builtin_neon_vqdmlsl_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlsl_nv4hi) },
+{ "__builtin_neon_vqdmlslv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlslv2si) },
+{ "__builtin_neon_vqdmlslv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmlslv4hi) },
+{ "__builtin_neon_vqdmulh_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev2si) },
+{ "__builtin_neon_vqdmulh_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev4hi) },
+{ "__builtin_neon_vqdmulh_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev4si) },
+{ "__builtin_neon_vqdmulh_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_lanev8hi) },
+{ "__builtin_neon_vqdmulh_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv2si) },
+{ "__builtin_neon_vqdmulh_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv4hi) },
+{ "__builtin_neon_vqdmulh_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv4si) },
+{ "__builtin_neon_vqdmulh_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulh_nv8hi) },
+{ "__builtin_neon_vqdmulhv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv2si) },
+{ "__builtin_neon_vqdmulhv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv4hi) },
+{ "__builtin_neon_vqdmulhv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv4si) },
+{ "__builtin_neon_vqdmulhv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmulhv8hi) },
+{ "__builtin_neon_vqdmull_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_lanev2si) },
+{ "__builtin_neon_vqdmull_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_lanev4hi) },
+{ "__builtin_neon_vqdmull_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_nv2si) },
+{ "__builtin_neon_vqdmull_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmull_nv4hi) },
+{ "__builtin_neon_vqdmullv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmullv2si) },
+{ "__builtin_neon_vqdmullv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqdmullv4hi) },
+{ "__builtin_neon_vqmovnsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnsv2di) },
+{ "__builtin_neon_vqmovnsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnsv4si) },
+{ "__builtin_neon_vqmovnsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnsv8hi) },
+{ "__builtin_neon_vqmovnuv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnuv2di) },
+{ "__builtin_neon_vqmovnuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnuv4si) },
+{ "__builtin_neon_vqmovnuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovnuv8hi) },
+{ "__builtin_neon_vqmovunv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovunv2di) },
+{ "__builtin_neon_vqmovunv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovunv4si) },
+{ "__builtin_neon_vqmovunv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqmovunv8hi) },
+{ "__builtin_neon_vqnegv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv16qi) },
+{ "__builtin_neon_vqnegv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv2si) },
+{ "__builtin_neon_vqnegv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv4hi) },
+{ "__builtin_neon_vqnegv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv4si) },
+{ "__builtin_neon_vqnegv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv8hi) },
+{ "__builtin_neon_vqnegv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqnegv8qi) },
+{ "__builtin_neon_vqrdmulh_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev2si) },
+{ "__builtin_neon_vqrdmulh_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev4hi) },
+{ "__builtin_neon_vqrdmulh_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev4si) },
+{ "__builtin_neon_vqrdmulh_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_lanev8hi) },
+{ "__builtin_neon_vqrdmulh_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv2si) },
+{ "__builtin_neon_vqrdmulh_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv4hi) },
+{ "__builtin_neon_vqrdmulh_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv4si) },
+{ "__builtin_neon_vqrdmulh_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulh_nv8hi) },
+{ "__builtin_neon_vqrdmulhv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv2si) },
+{ "__builtin_neon_vqrdmulhv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv4hi) },
+{ "__builtin_neon_vqrdmulhv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv4si) },
+{ "__builtin_neon_vqrdmulhv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrdmulhv8hi) },
+{ "__builtin_neon_vqrshlsdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsdi) },
+{ "__builtin_neon_vqrshlsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv16qi) },
+{ "__builtin_neon_vqrshlsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv2di) },
+{ "__builtin_neon_vqrshlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv2si) },
+{ "__builtin_neon_vqrshlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv4hi) },
+{ "__builtin_neon_vqrshlsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv4si) },
+{ "__builtin_neon_vqrshlsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv8hi) },
+{ "__builtin_neon_vqrshlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshlsv8qi) },
+{ "__builtin_neon_vqrshludi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshludi) },
+{ "__builtin_neon_vqrshluv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv16qi) },
+{ "__builtin_neon_vqrshluv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv2di) },
+{ "__builtin_neon_vqrshluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv2si) },
+{ "__builtin_neon_vqrshluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv4hi) },
+{ "__builtin_neon_vqrshluv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv4si) },
+{ "__builtin_neon_vqrshluv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv8hi) },
+{ "__builtin_neon_vqrshluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshluv8qi) },
+{ "__builtin_neon_vqrshrns_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrns_nv2di) },
+{ "__builtin_neon_vqrshrns_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrns_nv4si) },
+{ "__builtin_neon_vqrshrns_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrns_nv8hi) },
+{ "__builtin_neon_vqrshrnu_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrnu_nv2di) },
+{ "__builtin_neon_vqrshrnu_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrnu_nv4si) },
+{ "__builtin_neon_vqrshrnu_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrnu_nv8hi) },
+{ "__builtin_neon_vqrshrun_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrun_nv2di) },
+{ "__builtin_neon_vqrshrun_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrun_nv4si) },
+{ "__builtin_neon_vqrshrun_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqrshrun_nv8hi) },
+{ "__builtin_neon_vqshlsdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsdi) },
+{ "__builtin_neon_vqshl_s_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_ndi) },
+{ "__builtin_neon_vqshl_s_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv16qi) },
+{ "__builtin_neon_vqshl_s_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv2di) },
+{ "__builtin_neon_vqshl_s_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv2si) },
+{ "__builtin_neon_vqshl_s_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv4hi) },
+{ "__builtin_neon_vqshl_s_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv4si) },
+{ "__builtin_neon_vqshl_s_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv8hi) },
+{ "__builtin_neon_vqshl_s_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_s_nv8qi) },
+{ "__builtin_neon_vqshlsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv16qi) },
+{ "__builtin_neon_vqshlsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv2di) },
+{ "__builtin_neon_vqshlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv2si) },
+{ "__builtin_neon_vqshlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv4hi) },
+{ "__builtin_neon_vqshlsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv4si) },
+{ "__builtin_neon_vqshlsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv8hi) },
+{ "__builtin_neon_vqshlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlsv8qi) },
+{ "__builtin_neon_vqshludi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshludi) },
+{ "__builtin_neon_vqshl_u_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_ndi) },
+{ "__builtin_neon_vqshlu_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_ndi) },
+{ "__builtin_neon_vqshl_u_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv16qi) },
+{ "__builtin_neon_vqshlu_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv16qi) },
+{ "__builtin_neon_vqshl_u_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv2di) },
+{ "__builtin_neon_vqshlu_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv2di) },
+{ "__builtin_neon_vqshl_u_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv2si) },
+{ "__builtin_neon_vqshlu_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv2si) },
+{ "__builtin_neon_vqshl_u_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv4hi) },
+{ "__builtin_neon_vqshlu_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv4hi) },
+{ "__builtin_neon_vqshl_u_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv4si) },
+{ "__builtin_neon_vqshlu_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv4si) },
+{ "__builtin_neon_vqshl_u_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv8hi) },
+{ "__builtin_neon_vqshlu_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv8hi) },
+{ "__builtin_neon_vqshl_u_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshl_u_nv8qi) },
+{ "__builtin_neon_vqshlu_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshlu_nv8qi) },
+{ "__builtin_neon_vqshluv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv16qi) },
+{ "__builtin_neon_vqshluv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv2di) },
+{ "__builtin_neon_vqshluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv2si) },
+{ "__builtin_neon_vqshluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv4hi) },
+{ "__builtin_neon_vqshluv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv4si) },
+{ "__builtin_neon_vqshluv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv8hi) },
+{ "__builtin_neon_vqshluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshluv8qi) },
+{ "__builtin_neon_vqshrns_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrns_nv2di) },
+{ "__builtin_neon_vqshrns_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrns_nv4si) },
+{ "__builtin_neon_vqshrns_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrns_nv8hi) },
+{ "__builtin_neon_vqshrnu_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrnu_nv2di) },
+{ "__builtin_neon_vqshrnu_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrnu_nv4si) },
+{ "__builtin_neon_vqshrnu_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrnu_nv8hi) },
+{ "__builtin_neon_vqshrun_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrun_nv2di) },
+{ "__builtin_neon_vqshrun_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrun_nv4si) },
+{ "__builtin_neon_vqshrun_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqshrun_nv8hi) },
+{ "__builtin_neon_vqsubsdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsdi) },
+{ "__builtin_neon_vqsubsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv16qi) },
+{ "__builtin_neon_vqsubsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv2di) },
+{ "__builtin_neon_vqsubsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv2si) },
+{ "__builtin_neon_vqsubsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv4hi) },
+{ "__builtin_neon_vqsubsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv4si) },
+{ "__builtin_neon_vqsubsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv8hi) },
+{ "__builtin_neon_vqsubsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubsv8qi) },
+{ "__builtin_neon_vqsubudi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubudi) },
+{ "__builtin_neon_vqsubuv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv16qi) },
+{ "__builtin_neon_vqsubuv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv2di) },
+{ "__builtin_neon_vqsubuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv2si) },
+{ "__builtin_neon_vqsubuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv4hi) },
+{ "__builtin_neon_vqsubuv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv4si) },
+{ "__builtin_neon_vqsubuv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv8hi) },
+{ "__builtin_neon_vqsubuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vqsubuv8qi) },
+{ "__builtin_neon_vraddhnv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vraddhnv2di) },
+{ "__builtin_neon_vraddhnv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vraddhnv4si) },
+{ "__builtin_neon_vraddhnv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vraddhnv8hi) },
+{ "__builtin_neon_vrecpev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev2sf) },
+{ "__builtin_neon_vrecpev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev2si) },
+{ "__builtin_neon_vrecpev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev4sf) },
+{ "__builtin_neon_vrecpev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpev4si) },
+{ "__builtin_neon_vrecpsv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpsv2sf) },
+{ "__builtin_neon_vrecpsv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrecpsv4sf) },
+{ "__builtin_neon_vreinterpretdidi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdidi) },
+{ "__builtin_neon_vreinterpretdiv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv2sf) },
+{ "__builtin_neon_vreinterpretdiv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv2si) },
+{ "__builtin_neon_vreinterpretdiv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv4hi) },
+{ "__builtin_neon_vreinterpretdiv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretdiv8qi) },
+{ "__builtin_neon_vreinterpretv16qiv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv16qi) },
+{ "__builtin_neon_vreinterpretv16qiv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv2di) },
+{ "__builtin_neon_vreinterpretv16qiv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv4sf) },
+{ "__builtin_neon_vreinterpretv16qiv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv4si) },
+{ "__builtin_neon_vreinterpretv16qiv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv16qiv8hi) },
+{ "__builtin_neon_vreinterpretv2div16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div16qi) },
+{ "__builtin_neon_vreinterpretv2div2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div2di) },
+{ "__builtin_neon_vreinterpretv2div4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div4sf) },
+{ "__builtin_neon_vreinterpretv2div4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div4si) },
+{ "__builtin_neon_vreinterpretv2div8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2div8hi) },
+{ "__builtin_neon_vreinterpretv2sfdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfdi) },
+{ "__builtin_neon_vreinterpretv2sfv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfv2si) },
+{ "__builtin_neon_vreinterpretv2sfv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfv4hi) },
+{ "__builtin_neon_vreinterpretv2sfv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sfv8qi) },
+{ "__builtin_neon_vreinterpretv2sidi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2sidi) },
+{ "__builtin_neon_vreinterpretv2siv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv2sf) },
+{ "__builtin_neon_vreinterpretv2siv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv2si) },
+{ "__builtin_neon_vreinterpretv2siv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv4hi) },
+{ "__builtin_neon_vreinterpretv2siv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv2siv8qi) },
+{ "__builtin_neon_vreinterpretv4hidi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hidi) },
+{ "__builtin_neon_vreinterpretv4hiv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv2sf) },
+{ "__builtin_neon_vreinterpretv4hiv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv2si) },
+{ "__builtin_neon_vreinterpretv4hiv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv4hi) },
+{ "__builtin_neon_vreinterpretv4hiv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4hiv8qi) },
+{ "__builtin_neon_vreinterpretv4sfv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv16qi) },
+{ "__builtin_neon_vreinterpretv4sfv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv2di) },
+{ "__builtin_neon_vreinterpretv4sfv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv4si) },
+{ "__builtin_neon_vreinterpretv4sfv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4sfv8hi) },
+{ "__builtin_neon_vreinterpretv4siv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv16qi) },
+{ "__builtin_neon_vreinterpretv4siv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv2di) },
+{ "__builtin_neon_vreinterpretv4siv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv4sf) },
+{ "__builtin_neon_vreinterpretv4siv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv4si) },
+{ "__builtin_neon_vreinterpretv4siv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv4siv8hi) },
+{ "__builtin_neon_vreinterpretv8hiv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv16qi) },
+{ "__builtin_neon_vreinterpretv8hiv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv2di) },
+{ "__builtin_neon_vreinterpretv8hiv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv4sf) },
+{ "__builtin_neon_vreinterpretv8hiv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv4si) },
+{ "__builtin_neon_vreinterpretv8hiv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8hiv8hi) },
+{ "__builtin_neon_vreinterpretv8qidi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qidi) },
+{ "__builtin_neon_vreinterpretv8qiv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv2sf) },
+{ "__builtin_neon_vreinterpretv8qiv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv2si) },
+{ "__builtin_neon_vreinterpretv8qiv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv4hi) },
+{ "__builtin_neon_vreinterpretv8qiv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vreinterpretv8qiv8qi) },
+{ "__builtin_neon_vrhaddsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv16qi) },
+{ "__builtin_neon_vrhaddsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv2si) },
+{ "__builtin_neon_vrhaddsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv4hi) },
+{ "__builtin_neon_vrhaddsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv4si) },
+{ "__builtin_neon_vrhaddsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv8hi) },
+{ "__builtin_neon_vrhaddsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhaddsv8qi) },
+{ "__builtin_neon_vrhadduv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv16qi) },
+{ "__builtin_neon_vrhadduv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv2si) },
+{ "__builtin_neon_vrhadduv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv4hi) },
+{ "__builtin_neon_vrhadduv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv4si) },
+{ "__builtin_neon_vrhadduv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv8hi) },
+{ "__builtin_neon_vrhadduv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrhadduv8qi) },
+{ "__builtin_neon_vrshlsdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsdi) },
+{ "__builtin_neon_vrshlsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv16qi) },
+{ "__builtin_neon_vrshlsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv2di) },
+{ "__builtin_neon_vrshlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv2si) },
+{ "__builtin_neon_vrshlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv4hi) },
+{ "__builtin_neon_vrshlsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv4si) },
+{ "__builtin_neon_vrshlsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv8hi) },
+{ "__builtin_neon_vrshlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshlsv8qi) },
+{ "__builtin_neon_vrshludi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshludi) },
+{ "__builtin_neon_vrshluv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv16qi) },
+{ "__builtin_neon_vrshluv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv2di) },
+{ "__builtin_neon_vrshluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv2si) },
+{ "__builtin_neon_vrshluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv4hi) },
+{ "__builtin_neon_vrshluv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv4si) },
+{ "__builtin_neon_vrshluv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv8hi) },
+{ "__builtin_neon_vrshluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshluv8qi) },
+{ "__builtin_neon_vrshrn_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrn_nv2di) },
+{ "__builtin_neon_vrshrn_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrn_nv4si) },
+{ "__builtin_neon_vrshrn_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrn_nv8hi) },
+{ "__builtin_neon_vrshrs_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_ndi) },
+{ "__builtin_neon_vrshrs_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv16qi) },
+{ "__builtin_neon_vrshrs_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv2di) },
+{ "__builtin_neon_vrshrs_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv2si) },
+{ "__builtin_neon_vrshrs_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv4hi) },
+{ "__builtin_neon_vrshrs_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv4si) },
+{ "__builtin_neon_vrshrs_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv8hi) },
+{ "__builtin_neon_vrshrs_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshrs_nv8qi) },
+{ "__builtin_neon_vrshru_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_ndi) },
+{ "__builtin_neon_vrshru_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv16qi) },
+{ "__builtin_neon_vrshru_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv2di) },
+{ "__builtin_neon_vrshru_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv2si) },
+{ "__builtin_neon_vrshru_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv4hi) },
+{ "__builtin_neon_vrshru_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv4si) },
+{ "__builtin_neon_vrshru_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv8hi) },
+{ "__builtin_neon_vrshru_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrshru_nv8qi) },
+{ "__builtin_neon_vrsqrtev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev2sf) },
+{ "__builtin_neon_vrsqrtev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev2si) },
+{ "__builtin_neon_vrsqrtev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev4sf) },
+{ "__builtin_neon_vrsqrtev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtev4si) },
+{ "__builtin_neon_vrsqrtsv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtsv2sf) },
+{ "__builtin_neon_vrsqrtsv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsqrtsv4sf) },
+{ "__builtin_neon_vrsras_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_ndi) },
+{ "__builtin_neon_vrsras_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv16qi) },
+{ "__builtin_neon_vrsras_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv2di) },
+{ "__builtin_neon_vrsras_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv2si) },
+{ "__builtin_neon_vrsras_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv4hi) },
+{ "__builtin_neon_vrsras_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv4si) },
+{ "__builtin_neon_vrsras_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv8hi) },
+{ "__builtin_neon_vrsras_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsras_nv8qi) },
+{ "__builtin_neon_vrsrau_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_ndi) },
+{ "__builtin_neon_vrsrau_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv16qi) },
+{ "__builtin_neon_vrsrau_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv2di) },
+{ "__builtin_neon_vrsrau_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv2si) },
+{ "__builtin_neon_vrsrau_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv4hi) },
+{ "__builtin_neon_vrsrau_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv4si) },
+{ "__builtin_neon_vrsrau_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv8hi) },
+{ "__builtin_neon_vrsrau_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsrau_nv8qi) },
+{ "__builtin_neon_vrsubhnv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsubhnv2di) },
+{ "__builtin_neon_vrsubhnv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsubhnv4si) },
+{ "__builtin_neon_vrsubhnv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vrsubhnv8hi) },
+{ "__builtin_neon_vset_lanedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanedi) },
+{ "__builtin_neon_vset_lanev16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev16qi) },
+{ "__builtin_neon_vset_lanev2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev2di) },
+{ "__builtin_neon_vset_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev2sf) },
+{ "__builtin_neon_vset_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev2si) },
+{ "__builtin_neon_vset_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev4hi) },
+{ "__builtin_neon_vset_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev4sf) },
+{ "__builtin_neon_vset_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev4si) },
+{ "__builtin_neon_vset_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev8hi) },
+{ "__builtin_neon_vset_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vset_lanev8qi) },
+{ "__builtin_neon_vshlls_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlls_nv2si) },
+{ "__builtin_neon_vshlls_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlls_nv4hi) },
+{ "__builtin_neon_vshlls_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlls_nv8qi) },
+{ "__builtin_neon_vshllu_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshllu_nv2si) },
+{ "__builtin_neon_vshllu_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshllu_nv4hi) },
+{ "__builtin_neon_vshllu_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshllu_nv8qi) },
+{ "__builtin_neon_vshl_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_ndi) },
+{ "__builtin_neon_vshl_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv16qi) },
+{ "__builtin_neon_vshl_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv2di) },
+{ "__builtin_neon_vshl_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv2si) },
+{ "__builtin_neon_vshl_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv4hi) },
+{ "__builtin_neon_vshl_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv4si) },
+{ "__builtin_neon_vshl_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv8hi) },
+{ "__builtin_neon_vshl_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshl_nv8qi) },
+{ "__builtin_neon_vshlsdi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsdi) },
+{ "__builtin_neon_vshlsv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv16qi) },
+{ "__builtin_neon_vshlsv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv2di) },
+{ "__builtin_neon_vshlsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv2si) },
+{ "__builtin_neon_vshlsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv4hi) },
+{ "__builtin_neon_vshlsv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv4si) },
+{ "__builtin_neon_vshlsv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv8hi) },
+{ "__builtin_neon_vshlsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshlsv8qi) },
+{ "__builtin_neon_vshludi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshludi) },
+{ "__builtin_neon_vshluv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv16qi) },
+{ "__builtin_neon_vshluv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv2di) },
+{ "__builtin_neon_vshluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv2si) },
+{ "__builtin_neon_vshluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv4hi) },
+{ "__builtin_neon_vshluv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv4si) },
+{ "__builtin_neon_vshluv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv8hi) },
+{ "__builtin_neon_vshluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshluv8qi) },
+{ "__builtin_neon_vshrn_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrn_nv2di) },
+{ "__builtin_neon_vshrn_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrn_nv4si) },
+{ "__builtin_neon_vshrn_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrn_nv8hi) },
+{ "__builtin_neon_vshrs_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_ndi) },
+{ "__builtin_neon_vshrs_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv16qi) },
+{ "__builtin_neon_vshrs_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv2di) },
+{ "__builtin_neon_vshrs_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv2si) },
+{ "__builtin_neon_vshrs_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv4hi) },
+{ "__builtin_neon_vshrs_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv4si) },
+{ "__builtin_neon_vshrs_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv8hi) },
+{ "__builtin_neon_vshrs_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshrs_nv8qi) },
+{ "__builtin_neon_vshru_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_ndi) },
+{ "__builtin_neon_vshru_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv16qi) },
+{ "__builtin_neon_vshru_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv2di) },
+{ "__builtin_neon_vshru_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv2si) },
+{ "__builtin_neon_vshru_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv4hi) },
+{ "__builtin_neon_vshru_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv4si) },
+{ "__builtin_neon_vshru_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv8hi) },
+{ "__builtin_neon_vshru_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vshru_nv8qi) },
+{ "__builtin_neon_vsli_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_ndi) },
+{ "__builtin_neon_vsli_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv16qi) },
+{ "__builtin_neon_vsli_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv2di) },
+{ "__builtin_neon_vsli_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv2si) },
+{ "__builtin_neon_vsli_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv4hi) },
+{ "__builtin_neon_vsli_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv4si) },
+{ "__builtin_neon_vsli_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv8hi) },
+{ "__builtin_neon_vsli_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsli_nv8qi) },
+{ "__builtin_neon_vsras_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_ndi) },
+{ "__builtin_neon_vsras_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv16qi) },
+{ "__builtin_neon_vsras_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv2di) },
+{ "__builtin_neon_vsras_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv2si) },
+{ "__builtin_neon_vsras_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv4hi) },
+{ "__builtin_neon_vsras_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv4si) },
+{ "__builtin_neon_vsras_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv8hi) },
+{ "__builtin_neon_vsras_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsras_nv8qi) },
+{ "__builtin_neon_vsrau_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_ndi) },
+{ "__builtin_neon_vsrau_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv16qi) },
+{ "__builtin_neon_vsrau_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv2di) },
+{ "__builtin_neon_vsrau_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv2si) },
+{ "__builtin_neon_vsrau_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv4hi) },
+{ "__builtin_neon_vsrau_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv4si) },
+{ "__builtin_neon_vsrau_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv8hi) },
+{ "__builtin_neon_vsrau_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsrau_nv8qi) },
+{ "__builtin_neon_vsri_ndi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_ndi) },
+{ "__builtin_neon_vsri_nv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv16qi) },
+{ "__builtin_neon_vsri_nv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv2di) },
+{ "__builtin_neon_vsri_nv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv2si) },
+{ "__builtin_neon_vsri_nv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv4hi) },
+{ "__builtin_neon_vsri_nv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv4si) },
+{ "__builtin_neon_vsri_nv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv8hi) },
+{ "__builtin_neon_vsri_nv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsri_nv8qi) },
+{ "__builtin_neon_vst1di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1di) },
+{ "__builtin_neon_vst1_lanedi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanedi) },
+{ "__builtin_neon_vst1_lanev16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev16qi) },
+{ "__builtin_neon_vst1_lanev2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev2di) },
+{ "__builtin_neon_vst1_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev2sf) },
+{ "__builtin_neon_vst1_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev2si) },
+{ "__builtin_neon_vst1_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev4hi) },
+{ "__builtin_neon_vst1_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev4sf) },
+{ "__builtin_neon_vst1_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev4si) },
+{ "__builtin_neon_vst1_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev8hi) },
+{ "__builtin_neon_vst1_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1_lanev8qi) },
+{ "__builtin_neon_vst1v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v16qi) },
+{ "__builtin_neon_vst1v2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v2di) },
+{ "__builtin_neon_vst1v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v2sf) },
+{ "__builtin_neon_vst1v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v2si) },
+{ "__builtin_neon_vst1v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v4hi) },
+{ "__builtin_neon_vst1v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v4sf) },
+{ "__builtin_neon_vst1v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v4si) },
+{ "__builtin_neon_vst1v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v8hi) },
+{ "__builtin_neon_vst1v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst1v8qi) },
+{ "__builtin_neon_vst2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2di) },
+{ "__builtin_neon_vst2_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev2sf) },
+{ "__builtin_neon_vst2_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev2si) },
+{ "__builtin_neon_vst2_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev4hi) },
+{ "__builtin_neon_vst2_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev4sf) },
+{ "__builtin_neon_vst2_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev4si) },
+{ "__builtin_neon_vst2_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev8hi) },
+{ "__builtin_neon_vst2_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2_lanev8qi) },
+{ "__builtin_neon_vst2v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v16qi) },
+{ "__builtin_neon_vst2v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v2sf) },
+{ "__builtin_neon_vst2v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v2si) },
+{ "__builtin_neon_vst2v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v4hi) },
+{ "__builtin_neon_vst2v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v4sf) },
+{ "__builtin_neon_vst2v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v4si) },
+{ "__builtin_neon_vst2v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v8hi) },
+{ "__builtin_neon_vst2v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst2v8qi) },
+{ "__builtin_neon_vst3di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3di) },
+{ "__builtin_neon_vst3_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev2sf) },
+{ "__builtin_neon_vst3_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev2si) },
+{ "__builtin_neon_vst3_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev4hi) },
+{ "__builtin_neon_vst3_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev4sf) },
+{ "__builtin_neon_vst3_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev4si) },
+{ "__builtin_neon_vst3_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev8hi) },
+{ "__builtin_neon_vst3_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3_lanev8qi) },
+{ "__builtin_neon_vst3v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v16qi) },
+{ "__builtin_neon_vst3v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v2sf) },
+{ "__builtin_neon_vst3v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v2si) },
+{ "__builtin_neon_vst3v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v4hi) },
+{ "__builtin_neon_vst3v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v4sf) },
+{ "__builtin_neon_vst3v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v4si) },
+{ "__builtin_neon_vst3v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v8hi) },
+{ "__builtin_neon_vst3v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst3v8qi) },
+{ "__builtin_neon_vst4di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4di) },
+{ "__builtin_neon_vst4_lanev2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev2sf) },
+{ "__builtin_neon_vst4_lanev2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev2si) },
+{ "__builtin_neon_vst4_lanev4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev4hi) },
+{ "__builtin_neon_vst4_lanev4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev4sf) },
+{ "__builtin_neon_vst4_lanev4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev4si) },
+{ "__builtin_neon_vst4_lanev8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev8hi) },
+{ "__builtin_neon_vst4_lanev8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4_lanev8qi) },
+{ "__builtin_neon_vst4v16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v16qi) },
+{ "__builtin_neon_vst4v2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v2sf) },
+{ "__builtin_neon_vst4v2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v2si) },
+{ "__builtin_neon_vst4v4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v4hi) },
+{ "__builtin_neon_vst4v4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v4sf) },
+{ "__builtin_neon_vst4v4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v4si) },
+{ "__builtin_neon_vst4v8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v8hi) },
+{ "__builtin_neon_vst4v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vst4v8qi) },
+{ "__builtin_neon_vsubhnv2di", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubhnv2di) },
+{ "__builtin_neon_vsubhnv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubhnv4si) },
+{ "__builtin_neon_vsubhnv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubhnv8hi) },
+{ "__builtin_neon_vsublsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsublsv2si) },
+{ "__builtin_neon_vsublsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsublsv4hi) },
+{ "__builtin_neon_vsublsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsublsv8qi) },
+{ "__builtin_neon_vsubluv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubluv2si) },
+{ "__builtin_neon_vsubluv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubluv4hi) },
+{ "__builtin_neon_vsubluv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubluv8qi) },
+{ "__builtin_neon_vsubv2sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubv2sf) },
+{ "__builtin_neon_vsubv4sf", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubv4sf) },
+{ "__builtin_neon_vsubwsv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwsv2si) },
+{ "__builtin_neon_vsubwsv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwsv4hi) },
+{ "__builtin_neon_vsubwsv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwsv8qi) },
+{ "__builtin_neon_vsubwuv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwuv2si) },
+{ "__builtin_neon_vsubwuv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwuv4hi) },
+{ "__builtin_neon_vsubwuv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vsubwuv8qi) },
+{ "__builtin_neon_vtbl1v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl1v8qi) },
+{ "__builtin_neon_vtbl2v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl2v8qi) },
+{ "__builtin_neon_vtbl3v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl3v8qi) },
+{ "__builtin_neon_vtbl4v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbl4v8qi) },
+{ "__builtin_neon_vtbx1v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx1v8qi) },
+{ "__builtin_neon_vtbx2v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx2v8qi) },
+{ "__builtin_neon_vtbx3v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx3v8qi) },
+{ "__builtin_neon_vtbx4v8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtbx4v8qi) },
+{ "__builtin_neon_vtstv16qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv16qi) },
+{ "__builtin_neon_vtstv2si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv2si) },
+{ "__builtin_neon_vtstv4hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv4hi) },
+{ "__builtin_neon_vtstv4si", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv4si) },
+{ "__builtin_neon_vtstv8hi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv8hi) },
+{ "__builtin_neon_vtstv8qi", LAZY_BUILTIN_SIGN_IN(__builtin_neon_vtstv8qi) },
+};
@@ -1,3 +1,4 @@
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_pcommit)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_pcommit = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_pcommit"));
 sym___builtin_ia32_pcommit->kind = SK_FUNCTION;sym___builtin_ia32_pcommit->do_not_print = 1;
@@ -8,6 +9,7 @@ get_new_function_type(return_type, 0, 0, REF_QUALIFIER_NONE);
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_pcommit, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_kmov16)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_kmov16 = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_kmov16"));
 sym___builtin_ia32_kmov16->kind = SK_FUNCTION;sym___builtin_ia32_kmov16->do_not_print = 1;
@@ -19,6 +21,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_kmov16, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneb)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomneb = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomneb"));
 sym___builtin_ia32_vpcomneb->kind = SK_FUNCTION;sym___builtin_ia32_vpcomneb->do_not_print = 1;
@@ -31,6 +34,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomneb, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomned)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomned = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomned"));
 sym___builtin_ia32_vpcomned->kind = SK_FUNCTION;sym___builtin_ia32_vpcomned->do_not_print = 1;
@@ -43,6 +47,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomned, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneq)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomneq = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomneq"));
 sym___builtin_ia32_vpcomneq->kind = SK_FUNCTION;sym___builtin_ia32_vpcomneq->do_not_print = 1;
@@ -55,6 +60,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomneq, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneub)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomneub = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomneub"));
 sym___builtin_ia32_vpcomneub->kind = SK_FUNCTION;sym___builtin_ia32_vpcomneub->do_not_print = 1;
@@ -67,6 +73,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomneub, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneud)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomneud = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomneud"));
 sym___builtin_ia32_vpcomneud->kind = SK_FUNCTION;sym___builtin_ia32_vpcomneud->do_not_print = 1;
@@ -79,6 +86,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomneud, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneuq)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomneuq = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomneuq"));
 sym___builtin_ia32_vpcomneuq->kind = SK_FUNCTION;sym___builtin_ia32_vpcomneuq->do_not_print = 1;
@@ -91,6 +99,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomneuq, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneuw)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomneuw = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomneuw"));
 sym___builtin_ia32_vpcomneuw->kind = SK_FUNCTION;sym___builtin_ia32_vpcomneuw->do_not_print = 1;
@@ -103,6 +112,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomneuw, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomnew)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym___builtin_ia32_vpcomnew = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_vpcomnew"));
 sym___builtin_ia32_vpcomnew->kind = SK_FUNCTION;sym___builtin_ia32_vpcomnew->do_not_print = 1;
@@ -115,7 +125,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_vpcomnew, 1);
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqudi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddqudi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddqudi128_mask"));
 sym___builtin_ia32_loaddqudi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddqudi128_mask->do_not_print = 1;
@@ -130,7 +142,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddqudi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqudi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddqudi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddqudi256_mask"));
 sym___builtin_ia32_loaddqudi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddqudi256_mask->do_not_print = 1;
@@ -145,7 +159,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddqudi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqudi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddqudi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddqudi512_mask"));
 sym___builtin_ia32_loaddqudi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddqudi512_mask->do_not_print = 1;
@@ -160,7 +176,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddqudi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquhi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddquhi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddquhi128_mask"));
 sym___builtin_ia32_loaddquhi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddquhi128_mask->do_not_print = 1;
@@ -175,7 +193,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddquhi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquhi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddquhi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddquhi256_mask"));
 sym___builtin_ia32_loaddquhi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddquhi256_mask->do_not_print = 1;
@@ -190,7 +210,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddquhi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquhi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddquhi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddquhi512_mask"));
 sym___builtin_ia32_loaddquhi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddquhi512_mask->do_not_print = 1;
@@ -205,7 +227,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddquhi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquqi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddquqi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddquqi128_mask"));
 sym___builtin_ia32_loaddquqi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddquqi128_mask->do_not_print = 1;
@@ -220,7 +244,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddquqi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquqi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddquqi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddquqi256_mask"));
 sym___builtin_ia32_loaddquqi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddquqi256_mask->do_not_print = 1;
@@ -235,7 +261,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddquqi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquqi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddquqi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddquqi512_mask"));
 sym___builtin_ia32_loaddquqi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddquqi512_mask->do_not_print = 1;
@@ -250,7 +278,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddquqi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqusi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddqusi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddqusi128_mask"));
 sym___builtin_ia32_loaddqusi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddqusi128_mask->do_not_print = 1;
@@ -265,7 +295,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddqusi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqusi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddqusi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddqusi256_mask"));
 sym___builtin_ia32_loaddqusi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddqusi256_mask->do_not_print = 1;
@@ -280,7 +312,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddqusi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqusi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loaddqusi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loaddqusi512_mask"));
 sym___builtin_ia32_loaddqusi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_loaddqusi512_mask->do_not_print = 1;
@@ -295,7 +329,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loaddqusi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadupd128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loadupd128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loadupd128_mask"));
 sym___builtin_ia32_loadupd128_mask->kind = SK_FUNCTION;sym___builtin_ia32_loadupd128_mask->do_not_print = 1;
@@ -310,7 +346,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loadupd128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadupd256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loadupd256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loadupd256_mask"));
 sym___builtin_ia32_loadupd256_mask->kind = SK_FUNCTION;sym___builtin_ia32_loadupd256_mask->do_not_print = 1;
@@ -325,7 +363,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loadupd256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadupd512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loadupd512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loadupd512_mask"));
 sym___builtin_ia32_loadupd512_mask->kind = SK_FUNCTION;sym___builtin_ia32_loadupd512_mask->do_not_print = 1;
@@ -340,7 +380,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loadupd512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadups128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loadups128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loadups128_mask"));
 sym___builtin_ia32_loadups128_mask->kind = SK_FUNCTION;sym___builtin_ia32_loadups128_mask->do_not_print = 1;
@@ -355,7 +397,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loadups128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadups256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loadups256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loadups256_mask"));
 sym___builtin_ia32_loadups256_mask->kind = SK_FUNCTION;sym___builtin_ia32_loadups256_mask->do_not_print = 1;
@@ -370,7 +414,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loadups256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadups512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_loadups512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_loadups512_mask"));
 sym___builtin_ia32_loadups512_mask->kind = SK_FUNCTION;sym___builtin_ia32_loadups512_mask->do_not_print = 1;
@@ -385,7 +431,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_loadups512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqudi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedqudi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedqudi128_mask"));
 sym___builtin_ia32_storedqudi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedqudi128_mask->do_not_print = 1;
@@ -400,7 +448,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedqudi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqudi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedqudi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedqudi256_mask"));
 sym___builtin_ia32_storedqudi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedqudi256_mask->do_not_print = 1;
@@ -415,7 +465,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedqudi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqudi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedqudi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedqudi512_mask"));
 sym___builtin_ia32_storedqudi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedqudi512_mask->do_not_print = 1;
@@ -430,7 +482,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedqudi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquhi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedquhi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedquhi128_mask"));
 sym___builtin_ia32_storedquhi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedquhi128_mask->do_not_print = 1;
@@ -445,7 +499,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedquhi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquhi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedquhi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedquhi256_mask"));
 sym___builtin_ia32_storedquhi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedquhi256_mask->do_not_print = 1;
@@ -460,7 +516,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedquhi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquhi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedquhi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedquhi512_mask"));
 sym___builtin_ia32_storedquhi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedquhi512_mask->do_not_print = 1;
@@ -475,7 +533,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedquhi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquqi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedquqi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedquqi128_mask"));
 sym___builtin_ia32_storedquqi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedquqi128_mask->do_not_print = 1;
@@ -490,7 +550,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedquqi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquqi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedquqi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedquqi256_mask"));
 sym___builtin_ia32_storedquqi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedquqi256_mask->do_not_print = 1;
@@ -505,7 +567,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedquqi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquqi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedquqi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedquqi512_mask"));
 sym___builtin_ia32_storedquqi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedquqi512_mask->do_not_print = 1;
@@ -520,7 +584,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedquqi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqusi128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedqusi128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedqusi128_mask"));
 sym___builtin_ia32_storedqusi128_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedqusi128_mask->do_not_print = 1;
@@ -535,7 +601,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedqusi128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqusi256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedqusi256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedqusi256_mask"));
 sym___builtin_ia32_storedqusi256_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedqusi256_mask->do_not_print = 1;
@@ -550,7 +618,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedqusi256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqusi512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storedqusi512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storedqusi512_mask"));
 sym___builtin_ia32_storedqusi512_mask->kind = SK_FUNCTION;sym___builtin_ia32_storedqusi512_mask->do_not_print = 1;
@@ -565,7 +635,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storedqusi512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeupd128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storeupd128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storeupd128_mask"));
 sym___builtin_ia32_storeupd128_mask->kind = SK_FUNCTION;sym___builtin_ia32_storeupd128_mask->do_not_print = 1;
@@ -580,7 +652,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storeupd128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeupd256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storeupd256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storeupd256_mask"));
 sym___builtin_ia32_storeupd256_mask->kind = SK_FUNCTION;sym___builtin_ia32_storeupd256_mask->do_not_print = 1;
@@ -595,7 +669,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storeupd256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeupd512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storeupd512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storeupd512_mask"));
 sym___builtin_ia32_storeupd512_mask->kind = SK_FUNCTION;sym___builtin_ia32_storeupd512_mask->do_not_print = 1;
@@ -610,7 +686,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storeupd512_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeups128_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storeups128_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storeups128_mask"));
 sym___builtin_ia32_storeups128_mask->kind = SK_FUNCTION;sym___builtin_ia32_storeups128_mask->do_not_print = 1;
@@ -625,7 +703,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storeups128_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeups256_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storeups256_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storeups256_mask"));
 sym___builtin_ia32_storeups256_mask->kind = SK_FUNCTION;sym___builtin_ia32_storeups256_mask->do_not_print = 1;
@@ -640,7 +720,9 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storeups256_mask, 1);
 }
 }
-if (IS_CXX_LANGUAGE) {
+static void LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeups512_mask)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
+{
+if (IS_CXX_LANGUAGE)
 {
 scope_entry_t* sym___builtin_ia32_storeups512_mask = new_symbol(decl_context, decl_context->current_scope, uniquestr("__builtin_ia32_storeups512_mask"));
 sym___builtin_ia32_storeups512_mask->kind = SK_FUNCTION;sym___builtin_ia32_storeups512_mask->do_not_print = 1;
@@ -655,3 +737,52 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 symbol_entity_specs_set_is_builtin(sym___builtin_ia32_storeups512_mask, 1);
 }
 }
+static lazy_symbol_t LAZY_BUILTINS_TABLE[] =
+{
+{ "__builtin_ia32_pcommit", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_pcommit) },
+{ "__builtin_ia32_kmov16", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_kmov16) },
+{ "__builtin_ia32_vpcomneb", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneb) },
+{ "__builtin_ia32_vpcomned", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomned) },
+{ "__builtin_ia32_vpcomneq", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneq) },
+{ "__builtin_ia32_vpcomneub", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneub) },
+{ "__builtin_ia32_vpcomneud", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneud) },
+{ "__builtin_ia32_vpcomneuq", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneuq) },
+{ "__builtin_ia32_vpcomneuw", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomneuw) },
+{ "__builtin_ia32_vpcomnew", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_vpcomnew) },
+{ "__builtin_ia32_loaddqudi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqudi128_mask) },
+{ "__builtin_ia32_loaddqudi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqudi256_mask) },
+{ "__builtin_ia32_loaddqudi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqudi512_mask) },
+{ "__builtin_ia32_loaddquhi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquhi128_mask) },
+{ "__builtin_ia32_loaddquhi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquhi256_mask) },
+{ "__builtin_ia32_loaddquhi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquhi512_mask) },
+{ "__builtin_ia32_loaddquqi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquqi128_mask) },
+{ "__builtin_ia32_loaddquqi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquqi256_mask) },
+{ "__builtin_ia32_loaddquqi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddquqi512_mask) },
+{ "__builtin_ia32_loaddqusi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqusi128_mask) },
+{ "__builtin_ia32_loaddqusi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqusi256_mask) },
+{ "__builtin_ia32_loaddqusi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loaddqusi512_mask) },
+{ "__builtin_ia32_loadupd128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadupd128_mask) },
+{ "__builtin_ia32_loadupd256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadupd256_mask) },
+{ "__builtin_ia32_loadupd512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadupd512_mask) },
+{ "__builtin_ia32_loadups128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadups128_mask) },
+{ "__builtin_ia32_loadups256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadups256_mask) },
+{ "__builtin_ia32_loadups512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_loadups512_mask) },
+{ "__builtin_ia32_storedqudi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqudi128_mask) },
+{ "__builtin_ia32_storedqudi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqudi256_mask) },
+{ "__builtin_ia32_storedqudi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqudi512_mask) },
+{ "__builtin_ia32_storedquhi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquhi128_mask) },
+{ "__builtin_ia32_storedquhi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquhi256_mask) },
+{ "__builtin_ia32_storedquhi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquhi512_mask) },
+{ "__builtin_ia32_storedquqi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquqi128_mask) },
+{ "__builtin_ia32_storedquqi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquqi256_mask) },
+{ "__builtin_ia32_storedquqi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedquqi512_mask) },
+{ "__builtin_ia32_storedqusi128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqusi128_mask) },
+{ "__builtin_ia32_storedqusi256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqusi256_mask) },
+{ "__builtin_ia32_storedqusi512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storedqusi512_mask) },
+{ "__builtin_ia32_storeupd128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeupd128_mask) },
+{ "__builtin_ia32_storeupd256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeupd256_mask) },
+{ "__builtin_ia32_storeupd512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeupd512_mask) },
+{ "__builtin_ia32_storeups128_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeups128_mask) },
+{ "__builtin_ia32_storeups256_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeups256_mask) },
+{ "__builtin_ia32_storeups512_mask", LAZY_BUILTIN_SIGN_IN(__builtin_ia32_storeups512_mask) },
+};
@@ -3643,12 +3643,41 @@ static scope_entry_t* solve_gcc_atomic_builtins_overload_name_generic(
     return NULL;
 }
 
-static void sign_in_gcc_simd_builtins(const decl_context_t* decl_context)
-{
-    // Intel architecture gcc builtins
-    const locus_t* builtins_locus = make_locus("(gcc-builtin-ia32)", 0, 0);
+// Intel architecture gcc builtins
+#define LAZY_BUILTIN_SIGN_IN(name) gcc_builtin_ia32_##name
+#define LAZY_BUILTINS_TABLE gcc_builtins_ia32
 #include "cxx-gccbuiltins-ia32.h"
+#undef LAZY_BUILTINS_TABLE
+#undef LAZY_BUILTIN_SIGN_IN
+
+#define LAZY_BUILTIN_SIGN_IN(name) gcc_builtin_ia32_deprecated_##name
+#define LAZY_BUILTINS_TABLE gcc_builtins_ia32_deprecated
 #include "cxx-gccbuiltins-ia32-deprecated.h"
+#undef LAZY_BUILTINS_TABLE
+#undef LAZY_BUILTIN_SIGN_IN
+
+static lazy_symbol_table_t gcc_builtins_ia32_table =
+{
+    "(gcc-builtin-ia32)",
+    STATIC_ARRAY_LENGTH(gcc_builtins_ia32),
+    gcc_builtins_ia32,
+    NULL
+};
+
+static lazy_symbol_table_t gcc_builtins_ia32_deprecated_table =
+{
+    "(gcc-builtin-ia32)",
+    STATIC_ARRAY_LENGTH(gcc_builtins_ia32_deprecated),
+    gcc_builtins_ia32_deprecated,
+    NULL
+};
+
+static void sign_in_gcc_simd_builtins(const decl_context_t* decl_context)
+{
+    // There are thousands of these builtins but a translation unit uses a
+    // handful of them, so they are only created when looked up
+    scope_add_lazy_symbols(decl_context, &gcc_builtins_ia32_table);
+    scope_add_lazy_symbols(decl_context, &gcc_builtins_ia32_deprecated_table);
 }
 
 static void sign_in_simd_builtins(const decl_context_t* decl_context)
@@ -3686,6 +3715,20 @@ static type_t* get_unsigned_16x8_int(void)
 }
 #endif
 
+#define LAZY_BUILTIN_SIGN_IN(name) gcc_builtin_neon_##name
+#define LAZY_BUILTINS_TABLE gcc_builtins_neon_symbols
+#include "cxx-gccbuiltins-arm-neon.h"
+#undef LAZY_BUILTINS_TABLE
+#undef LAZY_BUILTIN_SIGN_IN
+
+static lazy_symbol_table_t gcc_builtins_neon_table =
+{
+    "(gcc-builtin-arm)",
+    STATIC_ARRAY_LENGTH(gcc_builtins_neon_symbols),
+    gcc_builtins_neon_symbols,
+    NULL
+};
+
 static void gcc_builtins_neon(const decl_context_t* decl_context)
 {
 
@@ -3800,8 +3843,7 @@ static void gcc_builtins_neon(const decl_context_t* decl_context)
         symbol_entity_specs_set_is_builtin(sym, 1);
     }
 
-    const locus_t* builtins_locus = make_locus("(gcc-builtin-arm)", 0, 0);
-#include "cxx-gccbuiltins-arm-neon.h"
+    scope_add_lazy_symbols(decl_context, &gcc_builtins_neon_table);
 }
 
 extern void gcc_builtins_arm(const decl_context_t* global_context)
@@ -3823,6 +3865,20 @@ static type_t* query_builtin_typedef(const char* name, const decl_context_t* dec
     return get_user_defined_type(entry);
 }
 
+#define LAZY_BUILTIN_SIGN_IN(name) gcc_builtin_neon_arm64_##name
+#define LAZY_BUILTINS_TABLE gcc_builtins_neon_arm64_symbols
+#include "cxx-gccbuiltins-arm64-neon.h"
+#undef LAZY_BUILTINS_TABLE
+#undef LAZY_BUILTIN_SIGN_IN
+
+static lazy_symbol_table_t gcc_builtins_neon_arm64_table =
+{
+    "(gcc-builtin-aarch64)",
+    STATIC_ARRAY_LENGTH(gcc_builtins_neon_arm64_symbols),
+    gcc_builtins_neon_arm64_symbols,
+    NULL
+};
+
 static void gcc_builtins_neon_arm64(const decl_context_t* decl_context)
 {
     int i, N;
@@ -3933,8 +3989,7 @@ static void gcc_builtins_neon_arm64(const decl_context_t* decl_context)
     GENERATE_NEON_VECTOR_BUILTINS
 #undef GENERATE_NEON_VECTOR
 
-    const locus_t* builtins_locus = make_locus("(gcc-builtin-aarch64)", 0, 0);
-#include "cxx-gccbuiltins-arm64-neon.h"
+    scope_add_lazy_symbols(decl_context, &gcc_builtins_neon_arm64_table);
 }
 
 extern void gcc_builtins_arm64(const decl_context_t* global_context)
@@ -1,3 +1,4 @@
+static void LAZY_BUILTIN_SIGN_IN(_mm512_adc_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_adc_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_adc_epi32"));
 sym__mm512_adc_epi32->kind = SK_FUNCTION;sym__mm512_adc_epi32->do_not_print = 1;sym__mm512_adc_epi32->locus = builtins_locus;
@@ -11,6 +12,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_adc_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_addsetc_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_addsetc_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_addsetc_epi32"));
 sym__mm512_addsetc_epi32->kind = SK_FUNCTION;sym__mm512_addsetc_epi32->do_not_print = 1;sym__mm512_addsetc_epi32->locus = builtins_locus;
@@ -23,6 +25,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_addsetc_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_addsets_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_addsets_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_addsets_epi32"));
 sym__mm512_addsets_epi32->kind = SK_FUNCTION;sym__mm512_addsets_epi32->do_not_print = 1;sym__mm512_addsets_epi32->locus = builtins_locus;
@@ -35,6 +38,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_addsets_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_addsets_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_addsets_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_addsets_ps"));
 sym__mm512_addsets_ps->kind = SK_FUNCTION;sym__mm512_addsets_ps->do_not_print = 1;sym__mm512_addsets_ps->locus = builtins_locus;
@@ -47,6 +51,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_addsets_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_addsets_round_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_addsets_round_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_addsets_round_ps"));
 sym__mm512_addsets_round_ps->kind = SK_FUNCTION;sym__mm512_addsets_round_ps->do_not_print = 1;sym__mm512_addsets_round_ps->locus = builtins_locus;
@@ -60,6 +65,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_addsets_round_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_exp223_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_exp223_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_exp223_ps"));
 sym__mm512_exp223_ps->kind = SK_FUNCTION;sym__mm512_exp223_ps->do_not_print = 1;sym__mm512_exp223_ps->locus = builtins_locus;
@@ -70,6 +76,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_exp223_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_log2ae23_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_log2ae23_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_log2ae23_ps"));
 sym__mm512_log2ae23_ps->kind = SK_FUNCTION;sym__mm512_log2ae23_ps->do_not_print = 1;sym__mm512_log2ae23_ps->locus = builtins_locus;
@@ -80,6 +87,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_log2ae23_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_adc_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_adc_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_adc_epi32"));
 sym__mm512_mask_adc_epi32->kind = SK_FUNCTION;sym__mm512_mask_adc_epi32->do_not_print = 1;sym__mm512_mask_adc_epi32->locus = builtins_locus;
@@ -94,6 +102,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_adc_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsetc_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_addsetc_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_addsetc_epi32"));
 sym__mm512_mask_addsetc_epi32->kind = SK_FUNCTION;sym__mm512_mask_addsetc_epi32->do_not_print = 1;sym__mm512_mask_addsetc_epi32->locus = builtins_locus;
@@ -108,6 +117,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_addsetc_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsets_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_addsets_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_addsets_epi32"));
 sym__mm512_mask_addsets_epi32->kind = SK_FUNCTION;sym__mm512_mask_addsets_epi32->do_not_print = 1;sym__mm512_mask_addsets_epi32->locus = builtins_locus;
@@ -122,6 +132,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_addsets_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsets_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_addsets_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_addsets_ps"));
 sym__mm512_mask_addsets_ps->kind = SK_FUNCTION;sym__mm512_mask_addsets_ps->do_not_print = 1;sym__mm512_mask_addsets_ps->locus = builtins_locus;
@@ -136,6 +147,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_addsets_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsets_round_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_addsets_round_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_addsets_round_ps"));
 sym__mm512_mask_addsets_round_ps->kind = SK_FUNCTION;sym__mm512_mask_addsets_round_ps->do_not_print = 1;sym__mm512_mask_addsets_round_ps->locus = builtins_locus;
@@ -151,6 +163,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_addsets_round_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_exp223_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_exp223_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_exp223_ps"));
 sym__mm512_mask_exp223_ps->kind = SK_FUNCTION;sym__mm512_mask_exp223_ps->do_not_print = 1;sym__mm512_mask_exp223_ps->locus = builtins_locus;
@@ -163,6 +176,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_exp223_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_log2ae23_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_log2ae23_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_log2ae23_ps"));
 sym__mm512_mask_log2ae23_ps->kind = SK_FUNCTION;sym__mm512_mask_log2ae23_ps->do_not_print = 1;sym__mm512_mask_log2ae23_ps->locus = builtins_locus;
@@ -175,6 +189,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_log2ae23_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_rcp23_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_rcp23_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_rcp23_ps"));
 sym__mm512_mask_rcp23_ps->kind = SK_FUNCTION;sym__mm512_mask_rcp23_ps->do_not_print = 1;sym__mm512_mask_rcp23_ps->locus = builtins_locus;
@@ -187,6 +202,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_rcp23_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_roundfxpnt_adjust_pd)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_roundfxpnt_adjust_pd = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_roundfxpnt_adjust_pd"));
 sym__mm512_mask_roundfxpnt_adjust_pd->kind = SK_FUNCTION;sym__mm512_mask_roundfxpnt_adjust_pd->do_not_print = 1;sym__mm512_mask_roundfxpnt_adjust_pd->locus = builtins_locus;
@@ -201,6 +217,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_roundfxpnt_adjust_pd, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_roundfxpnt_adjust_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_roundfxpnt_adjust_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_roundfxpnt_adjust_ps"));
 sym__mm512_mask_roundfxpnt_adjust_ps->kind = SK_FUNCTION;sym__mm512_mask_roundfxpnt_adjust_ps->do_not_print = 1;sym__mm512_mask_roundfxpnt_adjust_ps->locus = builtins_locus;
@@ -215,6 +232,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_roundfxpnt_adjust_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_round_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_round_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_round_ps"));
 sym__mm512_mask_round_ps->kind = SK_FUNCTION;sym__mm512_mask_round_ps->do_not_print = 1;sym__mm512_mask_round_ps->locus = builtins_locus;
@@ -229,6 +247,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_round_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_rsqrt23_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_rsqrt23_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_rsqrt23_ps"));
 sym__mm512_mask_rsqrt23_ps->kind = SK_FUNCTION;sym__mm512_mask_rsqrt23_ps->do_not_print = 1;sym__mm512_mask_rsqrt23_ps->locus = builtins_locus;
@@ -241,6 +260,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_rsqrt23_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_sbb_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_sbb_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_sbb_epi32"));
 sym__mm512_mask_sbb_epi32->kind = SK_FUNCTION;sym__mm512_mask_sbb_epi32->do_not_print = 1;sym__mm512_mask_sbb_epi32->locus = builtins_locus;
@@ -255,6 +275,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_sbb_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_sbbr_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_sbbr_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_sbbr_epi32"));
 sym__mm512_mask_sbbr_epi32->kind = SK_FUNCTION;sym__mm512_mask_sbbr_epi32->do_not_print = 1;sym__mm512_mask_sbbr_epi32->locus = builtins_locus;
@@ -269,6 +290,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_sbbr_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_subrsetb_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_subrsetb_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_subrsetb_epi32"));
 sym__mm512_mask_subrsetb_epi32->kind = SK_FUNCTION;sym__mm512_mask_subrsetb_epi32->do_not_print = 1;sym__mm512_mask_subrsetb_epi32->locus = builtins_locus;
@@ -283,6 +305,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_subrsetb_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_mask_subsetb_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_mask_subsetb_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_mask_subsetb_epi32"));
 sym__mm512_mask_subsetb_epi32->kind = SK_FUNCTION;sym__mm512_mask_subsetb_epi32->do_not_print = 1;sym__mm512_mask_subsetb_epi32->locus = builtins_locus;
@@ -297,6 +320,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_mask_subsetb_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_rcp23_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_rcp23_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_rcp23_ps"));
 sym__mm512_rcp23_ps->kind = SK_FUNCTION;sym__mm512_rcp23_ps->do_not_print = 1;sym__mm512_rcp23_ps->locus = builtins_locus;
@@ -307,6 +331,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_rcp23_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_roundfxpnt_adjust_pd)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_roundfxpnt_adjust_pd = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_roundfxpnt_adjust_pd"));
 sym__mm512_roundfxpnt_adjust_pd->kind = SK_FUNCTION;sym__mm512_roundfxpnt_adjust_pd->do_not_print = 1;sym__mm512_roundfxpnt_adjust_pd->locus = builtins_locus;
@@ -319,6 +344,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_roundfxpnt_adjust_pd, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_roundfxpnt_adjust_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_roundfxpnt_adjust_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_roundfxpnt_adjust_ps"));
 sym__mm512_roundfxpnt_adjust_ps->kind = SK_FUNCTION;sym__mm512_roundfxpnt_adjust_ps->do_not_print = 1;sym__mm512_roundfxpnt_adjust_ps->locus = builtins_locus;
@@ -331,6 +357,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_roundfxpnt_adjust_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_round_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_round_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_round_ps"));
 sym__mm512_round_ps->kind = SK_FUNCTION;sym__mm512_round_ps->do_not_print = 1;sym__mm512_round_ps->locus = builtins_locus;
@@ -343,6 +370,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_round_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_rsqrt23_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_rsqrt23_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_rsqrt23_ps"));
 sym__mm512_rsqrt23_ps->kind = SK_FUNCTION;sym__mm512_rsqrt23_ps->do_not_print = 1;sym__mm512_rsqrt23_ps->locus = builtins_locus;
@@ -353,6 +381,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_rsqrt23_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_sbb_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_sbb_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_sbb_epi32"));
 sym__mm512_sbb_epi32->kind = SK_FUNCTION;sym__mm512_sbb_epi32->do_not_print = 1;sym__mm512_sbb_epi32->locus = builtins_locus;
@@ -366,6 +395,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_sbb_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_sbbr_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_sbbr_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_sbbr_epi32"));
 sym__mm512_sbbr_epi32->kind = SK_FUNCTION;sym__mm512_sbbr_epi32->do_not_print = 1;sym__mm512_sbbr_epi32->locus = builtins_locus;
@@ -379,6 +409,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_sbbr_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_storenrngo_pd)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_storenrngo_pd = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_storenrngo_pd"));
 sym__mm512_storenrngo_pd->kind = SK_FUNCTION;sym__mm512_storenrngo_pd->do_not_print = 1;sym__mm512_storenrngo_pd->locus = builtins_locus;
@@ -390,6 +421,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_storenrngo_pd, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_storenrngo_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_storenrngo_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_storenrngo_ps"));
 sym__mm512_storenrngo_ps->kind = SK_FUNCTION;sym__mm512_storenrngo_ps->do_not_print = 1;sym__mm512_storenrngo_ps->locus = builtins_locus;
@@ -401,6 +433,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_storenrngo_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_storenr_pd)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_storenr_pd = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_storenr_pd"));
 sym__mm512_storenr_pd->kind = SK_FUNCTION;sym__mm512_storenr_pd->do_not_print = 1;sym__mm512_storenr_pd->locus = builtins_locus;
@@ -412,6 +445,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_storenr_pd, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_storenr_ps)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_storenr_ps = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_storenr_ps"));
 sym__mm512_storenr_ps->kind = SK_FUNCTION;sym__mm512_storenr_ps->do_not_print = 1;sym__mm512_storenr_ps->locus = builtins_locus;
@@ -423,6 +457,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_storenr_ps, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_subrsetb_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_subrsetb_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_subrsetb_epi32"));
 sym__mm512_subrsetb_epi32->kind = SK_FUNCTION;sym__mm512_subrsetb_epi32->do_not_print = 1;sym__mm512_subrsetb_epi32->locus = builtins_locus;
@@ -435,6 +470,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_subrsetb_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm512_subsetb_epi32)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm512_subsetb_epi32 = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm512_subsetb_epi32"));
 sym__mm512_subsetb_epi32->kind = SK_FUNCTION;sym__mm512_subsetb_epi32->do_not_print = 1;sym__mm512_subsetb_epi32->locus = builtins_locus;
@@ -447,6 +483,7 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm512_subsetb_epi32, 1);
 }
+static void LAZY_BUILTIN_SIGN_IN(_mm_clevict)(const decl_context_t* decl_context, const locus_t* builtins_locus UNUSED_PARAMETER)
 {
 scope_entry_t* sym__mm_clevict = new_symbol(decl_context, decl_context->current_scope, uniquestr("_mm_clevict"));
 sym__mm_clevict->kind = SK_FUNCTION;sym__mm_clevict->do_not_print = 1;sym__mm_clevict->locus = builtins_locus;
@@ -458,4 +495,43 @@ get_new_function_type(return_type, p, sizeof(p)/sizeof(p[0]), REF_QUALIFIER_NONE
 ;
 symbol_entity_specs_set_is_builtin(sym__mm_clevict, 1);
 }
-
+static lazy_symbol_t LAZY_BUILTINS_TABLE[] =
+{
+{ "_mm512_adc_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_adc_epi32) },
+{ "_mm512_addsetc_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_addsetc_epi32) },
+{ "_mm512_addsets_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_addsets_epi32) },
+{ "_mm512_addsets_ps", LAZY_BUILTIN_SIGN_IN(_mm512_addsets_ps) },
+{ "_mm512_addsets_round_ps", LAZY_BUILTIN_SIGN_IN(_mm512_addsets_round_ps) },
+{ "_mm512_exp223_ps", LAZY_BUILTIN_SIGN_IN(_mm512_exp223_ps) },
+{ "_mm512_log2ae23_ps", LAZY_BUILTIN_SIGN_IN(_mm512_log2ae23_ps) },
+{ "_mm512_mask_adc_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_adc_epi32) },
+{ "_mm512_mask_addsetc_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsetc_epi32) },
+{ "_mm512_mask_addsets_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsets_epi32) },
+{ "_mm512_mask_addsets_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsets_ps) },
+{ "_mm512_mask_addsets_round_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_addsets_round_ps) },
+{ "_mm512_mask_exp223_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_exp223_ps) },
+{ "_mm512_mask_log2ae23_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_log2ae23_ps) },
+{ "_mm512_mask_rcp23_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_rcp23_ps) },
+{ "_mm512_mask_roundfxpnt_adjust_pd", LAZY_BUILTIN_SIGN_IN(_mm512_mask_roundfxpnt_adjust_pd) },
+{ "_mm512_mask_roundfxpnt_adjust_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_roundfxpnt_adjust_ps) },
+{ "_mm512_mask_round_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_round_ps) },
+{ "_mm512_mask_rsqrt23_ps", LAZY_BUILTIN_SIGN_IN(_mm512_mask_rsqrt23_ps) },
+{ "_mm512_mask_sbb_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_sbb_epi32) },
+{ "_mm512_mask_sbbr_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_sbbr_epi32) },
+{ "_mm512_mask_subrsetb_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_subrsetb_epi32) },
+{ "_mm512_mask_subsetb_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_mask_subsetb_epi32) },
+{ "_mm512_rcp23_ps", LAZY_BUILTIN_SIGN_IN(_mm512_rcp23_ps) },
+{ "_mm512_roundfxpnt_adjust_pd", LAZY_BUILTIN_SIGN_IN(_mm512_roundfxpnt_adjust_pd) },
+{ "_mm512_roundfxpnt_adjust_ps", LAZY_BUILTIN_SIGN_IN(_mm512_roundfxpnt_adjust_ps) },
+{ "_mm512_round_ps", LAZY_BUILTIN_SIGN_IN(_mm512_round_ps) },
+{ "_mm512_rsqrt23_ps", LAZY_BUILTIN_SIGN_IN(_mm512_rsqrt23_ps) },
+{ "_mm512_sbb_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_sbb_epi32) },
+{ "_mm512_sbbr_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_sbbr_epi32) },
+{ "_mm512_storenrngo_pd", LAZY_BUILTIN_SIGN_IN(_mm512_storenrngo_pd) },
+{ "_mm512_storenrngo_ps", LAZY_BUILTIN_SIGN_IN(_mm512_storenrngo_ps) },
+{ "_mm512_storenr_pd", LAZY_BUILTIN_SIGN_IN(_mm512_storenr_pd) },
+{ "_mm512_storenr_ps", LAZY_BUILTIN_SIGN_IN(_mm512_storenr_ps) },
+{ "_mm512_subrsetb_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_subrsetb_epi32) },
+{ "_mm512_subsetb_epi32", LAZY_BUILTIN_SIGN_IN(_mm512_subsetb_epi32) },
+{ "_mm_clevict", LAZY_BUILTIN_SIGN_IN(_mm_clevict) },
+};
@@ -58,6 +58,7 @@ static scope_entry_t* add_duplicate_member_to_class(
             member_of_template->symbol_name);
 
     *new_member = *member_of_template;
+    symbol_entity_specs_unshare(new_member);
     symbol_clear_indirect_types(new_member);
 
     symbol_entity_specs_set_is_member(new_member, 1);
@@ -1602,6 +1603,7 @@ static void instantiate_class_common(
                 inner_decl_context->current_scope, being_instantiated_sym->symbol_name);
 
         *injected_symbol = *being_instantiated_sym;
+        symbol_entity_specs_unshare(injected_symbol);
         // the injected class name is logically in the class-scope
         injected_symbol->decl_context = inner_decl_context;
         injected_symbol->do_not_print = 1;
@@ -2312,11 +2314,20 @@ struct instantiation_item_tag
 static instantiation_item_t** symbols_to_instantiate;
 static int num_symbols_to_instantiate;
 
+// Every symbol ever requested in this translation unit. Pending functions
+// are only instantiated at the end of the translation unit, so a symbol
+// requested again would not be instantiated any differently
+static dhash_ptr_t* requested_symbols_to_instantiate;
+
 void instantiation_init(void)
 {
     nodecl_instantiation_units = nodecl_null();
     symbols_to_instantiate = NULL;
     num_symbols_to_instantiate = 0;
+
+    if (requested_symbols_to_instantiate != NULL)
+        dhash_ptr_destroy(requested_symbols_to_instantiate);
+    requested_symbols_to_instantiate = dhash_ptr_new(5);
 }
 
 static void instantiate_every_symbol(scope_entry_t* entry,
@@ -2600,30 +2611,21 @@ void instantiation_instantiate_pending_functions(nodecl_t* nodecl_output)
     DELETE(list);
 }
 
-static char compare_instantiate_items(instantiation_item_t* current_item, instantiation_item_t* new_item)
-{
-    return current_item->symbol == new_item->symbol;
-}
-
 void instantiation_add_symbol_to_instantiate(scope_entry_t* entry,
         const locus_t* locus)
 {
+    if (dhash_ptr_query(requested_symbols_to_instantiate, (const char*)entry) != NULL)
+        return;
+
+    dhash_ptr_insert(requested_symbols_to_instantiate, (const char*)entry, entry);
+
     instantiation_item_t* item = NEW0(instantiation_item_t);
     item->symbol = entry;
     item->locus = locus;
 
-    int old_num = num_symbols_to_instantiate;
-
-    P_LIST_ADD_ONCE_FUN(symbols_to_instantiate,
+    P_LIST_ADD(symbols_to_instantiate,
             num_symbols_to_instantiate,
-            item,
-            compare_instantiate_items);
-
-    // Crummy way to know if it was added
-    if (old_num == num_symbols_to_instantiate)
-    {
-        DELETE(item);
-    }
+            item);
 }
 
 static char instantiate_true_template_function(scope_entry_t* entry, const locus_t* locus UNUSED_PARAMETER)
@@ -561,14 +561,40 @@ char intel_vector_struct_to_intel_vector_struct_reinterpret_type(type_t* orig, t
     return 0;
 }
 
-void sign_in_icc_intrinsics(const decl_context_t* decl_context)
-{
-    const locus_t* builtins_locus = make_locus("(intel-builtins)", 0, 0);
-    // Xeon
+// Xeon
+#define LAZY_BUILTIN_SIGN_IN(name) icc_builtin_##name
+#define LAZY_BUILTINS_TABLE icc_builtins
 #include "cxx-iccbuiltins.h"
+#undef LAZY_BUILTINS_TABLE
+#undef LAZY_BUILTIN_SIGN_IN
 
-    // Knights Corner (aka MIC)
-    builtins_locus = make_locus("(intel-builtins-knc)", 0, 0);
+// Knights Corner (aka MIC)
+#define LAZY_BUILTIN_SIGN_IN(name) icc_builtin_knc_##name
+#define LAZY_BUILTINS_TABLE icc_builtins_knc
 #include "cxx-iccbuiltins-knc.h"
+#undef LAZY_BUILTINS_TABLE
+#undef LAZY_BUILTIN_SIGN_IN
+
+static lazy_symbol_table_t icc_builtins_table =
+{
+    "(intel-builtins)",
+    STATIC_ARRAY_LENGTH(icc_builtins),
+    icc_builtins,
+    NULL
+};
+
+static lazy_symbol_table_t icc_builtins_knc_table =
+{
+    "(intel-builtins-knc)",
+    STATIC_ARRAY_LENGTH(icc_builtins_knc),
+    icc_builtins_knc,
+    NULL
+};
+
+void sign_in_icc_intrinsics(const decl_context_t* decl_context)
+{
+    // Created only when looked up, like the gcc ones
+    scope_add_lazy_symbols(decl_context, &icc_builtins_table);
+    scope_add_lazy_symbols(decl_context, &icc_builtins_knc_table);
 }
 
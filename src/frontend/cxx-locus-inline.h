@@ -33,6 +33,7 @@ struct locus_tag
 {
     const char* filename;
     unsigned int line, col;
+    unsigned int index;
 };
 
 static inline const char* locus_to_str(const locus_t* l)
@@ -66,35 +66,43 @@ static unsigned int hash_locus(const char *filename, unsigned int line, unsigned
 
 enum { POOL_SIZE = 1024 };
 
-typedef
-struct pool_locus_tag
-{
-    int num;
-    locus_t* pool;
-    struct pool_locus_tag *prev;
-} pool_locus_t;
-
-static pool_locus_t *pool_locus;
+// Pools are never freed. The index of a locus is its position in the pools
+// plus one
+static int num_pools = 0;
+static locus_t** pools = NULL;
+static int num_used_last_pool = POOL_SIZE;
 
 static locus_t* pool_locus_alloc(void)
 {
-    if (pool_locus == NULL
-            || pool_locus->num == POOL_SIZE)
+    if (num_used_last_pool == POOL_SIZE)
     {
-        pool_locus_t* new_pool = NEW(pool_locus_t);
-        new_pool->num = 0;
-        new_pool->pool = NEW_VEC(locus_t, POOL_SIZE);
-        new_pool->prev = pool_locus;
-
-        pool_locus = new_pool;
+        P_LIST_ADD(pools, num_pools, NEW_VEC(locus_t, POOL_SIZE));
+        num_used_last_pool = 0;
     }
 
-    locus_t* result = &pool_locus->pool[pool_locus->num];
-    pool_locus->num++;
+    locus_t* result = &pools[num_pools - 1][num_used_last_pool];
+    num_used_last_pool++;
+
+    result->index = (num_pools - 1) * POOL_SIZE + num_used_last_pool;
 
     return result;
 }
 
+unsigned int locus_get_index(const locus_t* l)
+{
+    if (l == NULL)
+        return 0;
+    return l->index;
+}
+
+const locus_t* locus_from_index(unsigned int index)
+{
+    if (index == 0)
+        return NULL;
+    index--;
+    return &pools[index / POOL_SIZE][index % POOL_SIZE];
+}
+
 const locus_t* make_locus(const char* filename, unsigned int line, unsigned int col)
 {
     if (filename == NULL)
@@ -35,6 +35,11 @@ typedef struct locus_tag locus_t;
 
 const locus_t* make_locus(const char* filename, unsigned int line, unsigned int col);
 
+// Loci are unique so they can be identified by a 32-bit index. The index of
+// a NULL locus is 0
+unsigned int locus_get_index(const locus_t*);
+const locus_t* locus_from_index(unsigned int index);
+
 static inline const char* locus_to_str(const locus_t*);
 static inline const char* locus_get_filename(const locus_t*);
 static inline unsigned int locus_get_line(const locus_t*);
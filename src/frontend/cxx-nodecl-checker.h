@@ -35,6 +35,10 @@ extern "C" {
 
 void nodecl_check_tree(AST a);
 
+// Checks only the node itself and the kinds of its children, not the
+// whole subtree rooted at it
+void nodecl_check_node(AST a);
+
 #ifdef __cplusplus
 }
 #endif
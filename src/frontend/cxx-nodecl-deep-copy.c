@@ -34,6 +34,7 @@
 #include "cxx-utils.h"
 #include "cxx-symbol-deep-copy.h"
 #include "cxx-typeutils.h"
+#include "dhash_ptr.h"
 
 // Machine generated in cxx-nodecl-deep-copy-base.c
 extern nodecl_t nodecl_deep_copy_rec(nodecl_t n, 
@@ -54,9 +55,9 @@ struct nested_symbol_map_tag
 
     symbol_map_t* enclosing_map;
 
-    int num_mappings;
-    scope_entry_t** source_list;
-    scope_entry_t** target_list;
+    // Source symbol -> target symbol. Created on the first mapping since
+    // most nested maps of a deep copy remain empty
+    dhash_ptr_t* mappings;
 };
 
 static decl_context_t* copy_block_scope(decl_context_t* new_decl_context, 
@@ -95,24 +96,22 @@ static symbol_map_t* get_empty_map(void)
     return result;
 }
 
-static scope_entry_t* nested_symbol_map_fun_immediate(symbol_map_t* symbol_map, scope_entry_t* entry)
+static scope_entry_t* nested_symbol_map_lookup(nested_symbol_map_t* p, scope_entry_t* entry)
 {
-    if (entry == NULL)
+    if (p->mappings == NULL)
         return NULL;
 
-    nested_symbol_map_t *p = (nested_symbol_map_t*)symbol_map;
+    return (scope_entry_t*)dhash_ptr_query(p->mappings, (const char*)entry);
+}
 
-    scope_entry_t* result = entry;
+static scope_entry_t* nested_symbol_map_fun_immediate(symbol_map_t* symbol_map, scope_entry_t* entry)
+{
+    if (entry == NULL)
+        return NULL;
 
-    int i;
-    for (i = 0; i < p->num_mappings; i++)
-    {
-        if (p->source_list[i] == entry)
-        {
-             result = p->target_list[i];
-             break;
-        }
-    }
+    scope_entry_t* result = nested_symbol_map_lookup((nested_symbol_map_t*)symbol_map, entry);
+    if (result == NULL)
+        result = entry;
 
     return result;
 }
@@ -124,23 +123,11 @@ static scope_entry_t* nested_symbol_map_fun(symbol_map_t* symbol_map, scope_entr
 
     nested_symbol_map_t *p = (nested_symbol_map_t*)symbol_map;
 
-    char found = 0;
-    scope_entry_t* result = entry;
-
     // First ourselves
-    int i;
-    for (i = 0; i < p->num_mappings; i++)
-    {
-        if (p->source_list[i] == entry)
-        {
-             result = p->target_list[i];
-             found = 1;
-             break;
-        }
-    }
+    scope_entry_t* result = nested_symbol_map_lookup(p, entry);
 
     // Defer to enclosing map
-    if (!found)
+    if (result == NULL)
     {
         result = p->enclosing_map->map(p->enclosing_map, entry);
     }
@@ -148,7 +135,15 @@ static scope_entry_t* nested_symbol_map_fun(symbol_map_t* symbol_map, scope_entr
     return result;
 }
 
-static void nested_symbol_map_dtor(symbol_map_t* symbol_map UNUSED_PARAMETER) { }
+static void nested_symbol_map_dtor(symbol_map_t* symbol_map)
+{
+    nested_symbol_map_t *p = (nested_symbol_map_t*)symbol_map;
+    if (p->mappings != NULL)
+    {
+        dhash_ptr_destroy(p->mappings);
+        p->mappings = NULL;
+    }
+}
 
 nested_symbol_map_t* new_nested_symbol_map(symbol_map_t* enclosing_map)
 {
@@ -164,11 +159,14 @@ nested_symbol_map_t* new_nested_symbol_map(symbol_map_t* enclosing_map)
 
 void nested_map_add(nested_symbol_map_t* nested_symbol_map, scope_entry_t* source, scope_entry_t* target)
 {
-    // P_LIST_ADD modifies the second argument
-    int num_mappings = nested_symbol_map->num_mappings;
+    ERROR_CONDITION(source == NULL || target == NULL, "Invalid mapping", 0);
+
+    if (nested_symbol_map->mappings == NULL)
+        nested_symbol_map->mappings = dhash_ptr_new(5);
 
-    P_LIST_ADD(nested_symbol_map->source_list, num_mappings, source);
-    P_LIST_ADD(nested_symbol_map->target_list, nested_symbol_map->num_mappings, target);
+    // The first mapping of a symbol wins
+    if (dhash_ptr_query(nested_symbol_map->mappings, (const char*)source) == NULL)
+        dhash_ptr_insert(nested_symbol_map->mappings, (const char*)source, target);
 }
 
 static nodecl_t nodecl_deep_copy_context_(nodecl_t n,
@@ -392,6 +390,10 @@ static void copy_scope(const decl_context_t* new_decl_context, scope_t* original
     closure_info.nodecl_deep_copy_map = nodecl_deep_copy_map;
     closure_info.symbol_deep_copy_map = symbol_deep_copy_map;
 
+    // The new scope will have the same names, avoid growing it several times
+    dhash_ptr_reserve(new_decl_context->current_scope->dhash,
+            dhash_ptr_num_items(original_scope->dhash));
+
     // First walk, sign in all the names but leave them empty
     dhash_ptr_walk(original_scope->dhash, (dhash_ptr_walk_fn*)create_symbols, &closure_info);
     dhash_ptr_walk(original_scope->dhash, (dhash_ptr_walk_fn*)register_symbols, &closure_info);
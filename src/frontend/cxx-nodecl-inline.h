@@ -94,7 +94,7 @@ static inline nodecl_expr_info_t* nodecl_expr_get_expression_info(AST expr)
     nodecl_expr_info_t* p = ast_get_expr_info(expr);
     if (p == NULL)
     {
-        p = NEW(nodecl_expr_info_t);
+        p = (nodecl_expr_info_t*)ast_allocate_expr_info(expr, sizeof(*p));
         p->is_value_dependent = 0;
         p->is_type_dependent_expression = 0;
         p->type_info = NULL;
@@ -103,7 +103,6 @@ static inline nodecl_expr_info_t* nodecl_expr_get_expression_info(AST expr)
         p->template_parameters = NULL;
         p->placeholder = NULL;
         p->decl_context = NULL;
-        ast_set_expr_info(expr, p);
     }
     return p;
 }
@@ -122,6 +121,7 @@ static inline void nodecl_expr_set_##what(AST expr, type * datum) \
     { \
      expr_info = nodecl_expr_get_expression_info(expr); \
     } \
+    ast_invalidate_structural_id(expr); \
     expr_info->field_name = datum; \
 }
 
@@ -169,6 +169,18 @@ void nodecl_exchange(nodecl_t old_node, nodecl_t new_node)
     internal_error("Old node was not properly chained to its parent", 0);
 }
 
+static int num_top_level_walks = 0;
+
+void nodecl_note_top_level_walk(void)
+{
+    num_top_level_walks++;
+}
+
+int nodecl_get_num_top_level_walks(void)
+{
+    return num_top_level_walks;
+}
+
 static size_t hash_string(const char* str)
 {
     size_t str_hash = 0;
@@ -156,6 +156,10 @@ void nodecl_replace(nodecl_t old_node, nodecl_t new_node);
 // Hash table
 size_t nodecl_hash_table(nodecl_t key);
 
+// Number of walks that started at a NODECL_TOP_LEVEL (reported by -v)
+void nodecl_note_top_level_walk(void);
+int nodecl_get_num_top_level_walks(void);
+
 // Sourceify
 const char* nodecl_stmt_to_source(nodecl_t n);
 const char* nodecl_expr_to_source(nodecl_t n);
@@ -40,6 +40,7 @@
 #include "cxx-gccbuiltins.h"
 #include "cxx-diagnostic.h"
 #include "cxx-intelsupport.h"
+#include "cxx-type-trie.h"
 
 #include <string.h>
 
@@ -3274,18 +3275,195 @@ static scope_entry_t* solve_overload_(candidate_t* candidate_set,
     return best_viable_function;
 }
 
+// Cache of overload resolutions of function calls
+//
+// The key is the sequence of every candidate followed by the types of its
+// arguments. Types are hash-consed so identical calls yield identical
+// sequences, which are stored in a type_trie like function types are.
+static type_trie_t* _solve_overload_cache = NULL;
+static int _solve_overload_cache_hits = 0;
+static int _solve_overload_cache_misses = 0;
+
+// type_trie does not allow NULL elements nor NULL values
+static const char overload_cache_null_type_marker;
+static const char overload_cache_end_of_arguments_marker;
+static const char overload_cache_no_function_marker;
+
+static char type_is_stable_for_overload_cache(type_t* t)
+{
+    if (t == NULL)
+        return 1;
+
+    t = no_ref(t);
+    for (;;)
+    {
+        if (is_pointer_type(t))
+            t = pointer_type_get_pointee_type(t);
+        else if (is_array_type(t))
+            t = array_type_get_element_type(t);
+        else
+            break;
+    }
+
+    if (is_dependent_type(t)
+            || is_braced_list_type(t)
+            || is_unresolved_overloaded_type(t))
+        return 0;
+
+    // Constructors, conversion functions and bases of a class may only be
+    // used once it is complete
+    if (is_pointer_to_member_type(t)
+            && !type_is_stable_for_overload_cache(pointer_to_member_type_get_class_type(t)))
+        return 0;
+
+    if (is_class_type(t)
+            && !is_complete_type(t))
+        return 0;
+
+    return 1;
+}
+
+// The result of an overload resolution may change later if a class involved
+// gets completed or if a redeclaration adds default arguments.
+//
+// Builtin operators are not cached either: they are stored in local
+// builtin_operators_set_t of cxx-exprtype.c which are refilled with other
+// types in every call, so their addresses do not identify them
+static char candidate_set_can_be_cached(candidate_t* candidate_set)
+{
+    candidate_t* it;
+    for (it = candidate_set; it != NULL; it = it->next)
+    {
+        scope_entry_t* entry = entry_advance_aliases(it->entry);
+        if (symbol_entity_specs_get_is_builtin(entry))
+            return 0;
+
+        type_t* function_type = entry->type_information;
+
+        if (!is_function_type(function_type)
+                || is_computed_function_type(function_type))
+            return 0;
+
+        int num_parameters = function_type_get_num_parameters(function_type);
+        if (function_type_get_has_ellipsis(function_type))
+            num_parameters--;
+
+        int num_arguments = it->num_args;
+        if (symbol_entity_specs_get_is_member(entry)
+                && !symbol_entity_specs_get_is_constructor(entry))
+            num_arguments--;
+
+        if (num_arguments < num_parameters)
+            return 0;
+
+        int i;
+        for (i = 0; i < num_parameters; i++)
+        {
+            if (!type_is_stable_for_overload_cache(
+                        function_type_get_parameter_type_num(function_type, i)))
+                return 0;
+        }
+
+        for (i = 0; i < it->num_args; i++)
+        {
+            if (!type_is_stable_for_overload_cache(it->args[i]))
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int candidate_set_get_key(candidate_t* candidate_set, const type_t** key)
+{
+    int length = 0;
+
+    candidate_t* it;
+    for (it = candidate_set; it != NULL; it = it->next)
+    {
+        if (key != NULL)
+            key[length] = (const type_t*)it->entry;
+        length++;
+
+        int i;
+        for (i = 0; i < it->num_args; i++)
+        {
+            if (key != NULL)
+                key[length] = (it->args[i] != NULL)
+                    ? it->args[i]
+                    : (const type_t*)&overload_cache_null_type_marker;
+            length++;
+        }
+
+        if (key != NULL)
+            key[length] = (const type_t*)&overload_cache_end_of_arguments_marker;
+        length++;
+    }
+
+    return length;
+}
+
+void solve_overload_cache_stats(void)
+{
+    fprintf(stderr, "Overload resolution cache\n");
+    fprintf(stderr, "-------------------------\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, " - Hits: %d\n", _solve_overload_cache_hits);
+    fprintf(stderr, " - Misses: %d\n", _solve_overload_cache_misses);
+}
+
 scope_entry_t* solve_overload(candidate_t* candidate_set,
         const decl_context_t* decl_context,
         const locus_t* locus)
 {
+    if (candidate_set == NULL
+            || !candidate_set_can_be_cached(candidate_set))
+    {
+        char is_ambiguous = 0; // Unused
+        return solve_overload_(candidate_set,
+                decl_context,
+                /* initialization_kind */ IK_INVALID,
+                /* dest */ NULL,
+                locus,
+                // Out
+                &is_ambiguous);
+    }
+
+    if (_solve_overload_cache == NULL)
+        _solve_overload_cache = allocate_type_trie();
+
+    int key_length = candidate_set_get_key(candidate_set, NULL);
+    const type_t* key[key_length];
+    candidate_set_get_key(candidate_set, key);
+
+    const type_t* cached = lookup_type_trie(_solve_overload_cache, key, key_length);
+    if (cached != NULL)
+    {
+        _solve_overload_cache_hits++;
+        DEBUG_CODE()
+        {
+            fprintf(stderr, "OVERLOAD: Using the cached result of a previous identical overload\n");
+        }
+
+        if (cached == (const type_t*)&overload_cache_no_function_marker)
+            return NULL;
+        return (scope_entry_t*)cached;
+    }
+    _solve_overload_cache_misses++;
+
     char is_ambiguous = 0; // Unused
-    return solve_overload_(candidate_set,
+    scope_entry_t* result = solve_overload_(candidate_set,
             decl_context,
             /* initialization_kind */ IK_INVALID,
             /* dest */ NULL,
             locus,
             // Out
             &is_ambiguous);
+
+    insert_type_trie(_solve_overload_cache, key, key_length,
+            (result != NULL) ? (const type_t*)result : (const type_t*)&overload_cache_no_function_marker);
+
+    return result;
 }
 
 scope_entry_t* address_of_overloaded_function(
@@ -47,6 +47,9 @@ LIBMCXX_EXTERN scope_entry_t* solve_overload(candidate_t* candidate_set,
         const decl_context_t* decl_context,
         const locus_t* locus);
 
+// Hits and misses of the cache of solve_overload
+LIBMCXX_EXTERN void solve_overload_cache_stats(void);
+
 LIBMCXX_EXTERN char solve_initialization_of_nonclass_type(
         type_t* orig,
         type_t* dest,
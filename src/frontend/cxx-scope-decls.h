@@ -37,6 +37,7 @@
 
 #include "red_black_tree.h"
 #include "dhash_ptr.h"
+#include "dhash_str.h"
 #include "libmcxx-common.h"
 #include "cxx-macros.h"
 #include "cxx-ast-decls.h"
@@ -374,6 +375,27 @@ enum scope_kind
     CLASS_SCOPE, // Class scope
 };
 
+// Symbols of a namespace scope that are only created the first time their
+// name is looked up in it (see scope_add_lazy_symbols)
+typedef void (*lazy_symbol_sign_in_fun_t)(const decl_context_t* decl_context,
+        const locus_t* locus);
+
+typedef struct lazy_symbol_tag
+{
+    const char* name;
+    lazy_symbol_sign_in_fun_t sign_in;
+} lazy_symbol_t;
+
+typedef struct lazy_symbol_table_tag
+{
+    const char* locus_name;
+    int num_symbols;
+    const lazy_symbol_t* symbols;
+
+    // Index of symbols by name, built the first time the table is used
+    dhash_str_t* index;
+} lazy_symbol_table_t;
+
 // This is the scope
 struct scope_tag
 {
@@ -399,6 +421,21 @@ struct scope_tag
     // they contain the namespace symbol, the class symbol
     // and the function symbol
     scope_entry_t* related_entry;
+
+    // Only valid for NAMESPACE_SCOPE
+    // Tables of symbols not yet created and the context where they are
+    int num_lazy_symbol_tables;
+    lazy_symbol_table_t** lazy_symbol_tables;
+    const decl_context_t* lazy_symbols_context;
+    char signing_in_lazy_symbols;
+
+    // Only valid for CLASS_SCOPE
+    // Results of the member lookups started in this class, they are valid
+    // while class_lookup_cache_generation is the current generation
+    dhash_ptr_t* class_lookup_cache;
+    int class_lookup_cache_generation;
+    // A lookup started in a derived class went through this class
+    char class_lookup_is_base;
 };
 
 typedef const char* (*print_symbol_callback_t)(scope_entry_t*, const decl_context_t*, void*);
@@ -451,6 +451,8 @@ void insert_alias(scope_t* sc, scope_entry_t* entry, const char* name)
     }
 
     dhash_ptr_insert(sc->dhash, symbol_name, result_set);
+
+    class_scope_lookup_invalidate(sc);
 }
 
 static const char* scope_names[] =
@@ -480,6 +482,57 @@ scope_entry_t* new_symbol(const decl_context_t* decl_context, scope_t* sc, const
     return result;
 }
 
+void scope_add_lazy_symbols(const decl_context_t* decl_context,
+        lazy_symbol_table_t* table)
+{
+    scope_t* sc = decl_context->current_scope;
+    ERROR_CONDITION(sc->kind != NAMESPACE_SCOPE, "Lazy symbols are only for namespace scopes", 0);
+    ERROR_CONDITION(sc->lazy_symbols_context != NULL
+            && sc->lazy_symbols_context->current_scope != sc,
+            "Invalid context for lazy symbols", 0);
+
+    if (table->index == NULL)
+    {
+        table->index = dhash_str_new(table->num_symbols);
+        int i;
+        for (i = 0; i < table->num_symbols; i++)
+        {
+            dhash_str_insert(table->index, table->symbols[i].name, (void*)&table->symbols[i]);
+        }
+    }
+
+    sc->lazy_symbols_context = decl_context;
+    P_LIST_ADD(sc->lazy_symbol_tables, sc->num_lazy_symbol_tables, table);
+}
+
+// Creates the lazy symbols named name, if any. Returns nonzero if some
+// table has a symbol with that name
+static char sign_in_lazy_symbols(scope_t* sc, const char* name)
+{
+    // Symbols being created are inserted in this same scope
+    if (sc->signing_in_lazy_symbols)
+        return 0;
+    sc->signing_in_lazy_symbols = 1;
+
+    char found = 0;
+    int i;
+    for (i = 0; i < sc->num_lazy_symbol_tables; i++)
+    {
+        lazy_symbol_table_t* table = sc->lazy_symbol_tables[i];
+        const lazy_symbol_t* lazy_symbol =
+            (const lazy_symbol_t*)dhash_str_query(table->index, name);
+        if (lazy_symbol != NULL)
+        {
+            (lazy_symbol->sign_in)(sc->lazy_symbols_context,
+                    make_locus(table->locus_name, 0, 0));
+            found = 1;
+        }
+    }
+
+    sc->signing_in_lazy_symbols = 0;
+    return found;
+}
+
 char same_scope(scope_t* stA, scope_t* stB)
 {
     return (stA->dhash == stB->dhash);
@@ -508,6 +561,13 @@ static scope_entry_list_t* query_name_in_scope(scope_t* sc, const char* name)
 
     scope_entry_list_t *result = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, name);
 
+    if (result == NULL
+            && sc->num_lazy_symbol_tables != 0
+            && sign_in_lazy_symbols(sc, name))
+    {
+        result = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, name);
+    }
+
     // ERROR_CONDITION(name != uniquestr(name), "Invalid name", 0);
 
     DEBUG_CODE()
@@ -535,6 +595,15 @@ void insert_entry(scope_t* sc, scope_entry_t* entry)
 
     scope_entry_list_t* result_set = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, entry->symbol_name);
 
+    // Make sure lazy symbols with this name are there as they would be if
+    // they had been created beforehand
+    if (result_set == NULL
+            && sc->num_lazy_symbol_tables != 0
+            && sign_in_lazy_symbols(sc, entry->symbol_name))
+    {
+        result_set = (scope_entry_list_t*)dhash_ptr_query(sc->dhash, entry->symbol_name);
+    }
+
     if (result_set != NULL)
     {
         char do_not_add = 0;
@@ -561,6 +630,8 @@ void insert_entry(scope_t* sc, scope_entry_t* entry)
         result_set = entry_list_new(entry);
         dhash_ptr_insert(sc->dhash, entry->symbol_name, result_set);
     }
+
+    class_scope_lookup_invalidate(sc);
 }
 
 void remove_entry(scope_t* sc, scope_entry_t* entry)
@@ -579,6 +650,8 @@ void remove_entry(scope_t* sc, scope_entry_t* entry)
     {
         dhash_ptr_remove(sc->dhash, entry->symbol_name);
     }
+
+    class_scope_lookup_invalidate(sc);
 }
 
 scope_entry_list_t* filter_symbol_kind_set(scope_entry_list_t* entry_list, int num_kinds, enum cxx_symbol_kind* symbol_kind_set)
@@ -1157,6 +1230,104 @@ static char same_type_conversion(scope_entry_t* entry, void *p)
 }
 
 
+// Member lookups in complete classes are cached per class. A change in a
+// class only discards its own cache unless some lookup went through it as a
+// base, in which case all the caches are discarded by advancing the
+// generation
+static int class_lookup_generation = 1;
+static int class_lookup_cache_hits = 0;
+static int class_lookup_cache_misses = 0;
+static int class_lookup_cache_invalidations = 0;
+
+// Cached result of a lookup that did not find anything
+static char class_lookup_not_found_marker;
+
+static void free_cached_class_lookup(const char* name UNUSED_PARAMETER,
+        void* info,
+        void* walk_info UNUSED_PARAMETER)
+{
+    if (info != &class_lookup_not_found_marker)
+        entry_list_free((scope_entry_list_t*)info);
+}
+
+static void class_scope_lookup_clear(scope_t* sc)
+{
+    if (sc->class_lookup_cache == NULL)
+        return;
+
+    dhash_ptr_walk(sc->class_lookup_cache, free_cached_class_lookup, NULL);
+    dhash_ptr_destroy(sc->class_lookup_cache);
+    sc->class_lookup_cache = NULL;
+}
+
+void class_scope_lookup_invalidate(scope_t* sc)
+{
+    if (sc->kind != CLASS_SCOPE)
+        return;
+
+    if (sc->class_lookup_is_base)
+    {
+        class_lookup_generation++;
+        class_lookup_cache_invalidations++;
+        // Lookups repeated from now on will mark it again
+        sc->class_lookup_is_base = 0;
+    }
+
+    class_scope_lookup_clear(sc);
+}
+
+static scope_entry_list_t* class_scope_lookup_get_cached(scope_t* sc, const char* name, char *found)
+{
+    *found = 0;
+
+    if (sc->class_lookup_cache != NULL
+            && sc->class_lookup_cache_generation != class_lookup_generation)
+    {
+        class_scope_lookup_clear(sc);
+    }
+
+    if (sc->class_lookup_cache == NULL)
+        return NULL;
+
+    void* info = dhash_ptr_query(sc->class_lookup_cache, name);
+    if (info == NULL)
+        return NULL;
+
+    *found = 1;
+    if (info == &class_lookup_not_found_marker)
+        return NULL;
+
+    return entry_list_copy((scope_entry_list_t*)info);
+}
+
+static void class_scope_lookup_set_cached(scope_t* sc, const char* name, scope_entry_list_t* entry_list)
+{
+    if (sc->class_lookup_cache == NULL)
+    {
+        sc->class_lookup_cache = dhash_ptr_new(5);
+        sc->class_lookup_cache_generation = class_lookup_generation;
+    }
+
+    if (entry_list == NULL)
+    {
+        dhash_ptr_insert(sc->class_lookup_cache, name, &class_lookup_not_found_marker);
+    }
+    else
+    {
+        dhash_ptr_insert(sc->class_lookup_cache, name, entry_list_copy(entry_list));
+    }
+}
+
+void class_scope_lookup_stats(void)
+{
+    fprintf(stderr, "Class member lookup cache\n");
+    fprintf(stderr, "-------------------------\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, " - Hits: %d\n", class_lookup_cache_hits);
+    fprintf(stderr, " - Misses: %d\n", class_lookup_cache_misses);
+    fprintf(stderr, " - Invalidations of all the caches: %d\n", class_lookup_cache_invalidations);
+}
+
 void class_scope_lookup_rec(scope_t* current_class_scope, const char* name, 
         class_scope_lookup_t* derived,
         char is_virtual,
@@ -1180,6 +1351,13 @@ void class_scope_lookup_rec(scope_t* current_class_scope, const char* name,
     derived->path[derived->path_length - 1] = current_class_type;
     derived->is_virtual[derived->path_length - 1] = is_virtual;
 
+    if (!initial_lookup)
+    {
+        // Changes in this class must invalidate the lookups cached in the
+        // derived classes
+        current_class_scope->class_lookup_is_base = 1;
+    }
+
     scope_entry_list_t* entry_list = query_name_in_scope(current_class_scope, name);
 
     if (!initial_lookup)
@@ -1655,11 +1833,41 @@ static scope_entry_list_t* query_in_class(scope_t* current_class_scope,
         type_t* type_of_conversion, // Only used for conversions
         const locus_t* locus)
 {
+    // Lookups of conversions depend on the conversion type so they are not
+    // cached. Incomplete classes are still being defined
+    type_t* current_class_type = current_class_scope->related_entry->type_information;
+    char use_cache = (type_of_conversion == NULL
+            && is_class_type(current_class_type)
+            && is_complete_type(current_class_type));
+
+    if (use_cache)
+    {
+        char found = 0;
+        scope_entry_list_t* entry_list = class_scope_lookup_get_cached(current_class_scope, name, &found);
+        if (found)
+        {
+            class_lookup_cache_hits++;
+            DEBUG_CODE()
+            {
+                fprintf(stderr, "SCOPE: Class scope lookup of '%s' in class '%s' found in the cache\n",
+                        name,
+                        current_class_scope->related_entry->symbol_name);
+            }
+            return entry_list;
+        }
+        class_lookup_cache_misses++;
+    }
+
     class_scope_lookup_t result;
     memset(&result, 0, sizeof(result));
 
     class_scope_lookup_rec(current_class_scope, name, &result, 0, /* initial_lookup */ 1, decl_flags, type_of_conversion, locus);
 
+    if (use_cache)
+    {
+        class_scope_lookup_set_cached(current_class_scope, name, result.entry_list);
+    }
+
     if (result.entry_list != NULL)
     {
         int i;
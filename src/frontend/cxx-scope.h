@@ -62,6 +62,16 @@ LIBMCXX_EXTERN void remove_entry(struct scope_tag* st, scope_entry_t* entry);
 LIBMCXX_EXTERN void insert_entry(struct scope_tag* st, scope_entry_t* entry);
 LIBMCXX_EXTERN void insert_alias(struct scope_tag* st, scope_entry_t* entry, const char* alias_name);
 
+// Discards the cached member lookups that may have seen the (class) scope,
+// insert_entry, insert_alias and remove_entry already do this
+LIBMCXX_EXTERN void class_scope_lookup_invalidate(struct scope_tag* st);
+LIBMCXX_EXTERN void class_scope_lookup_stats(void);
+
+// Registers a table of symbols of the current (namespace) scope of
+// decl_context which will be created only if they are looked up
+LIBMCXX_EXTERN void scope_add_lazy_symbols(const decl_context_t* decl_context,
+        lazy_symbol_table_t* table);
+
 // Given a list of symbols, purge all those that are not of symbol_kind kind
 LIBMCXX_EXTERN scope_entry_list_t* filter_symbol_kind(scope_entry_list_t* entry_list, enum cxx_symbol_kind symbol_kind);
 // Similar but can be used to filter based on a kind set
@@ -6937,6 +6937,10 @@ extern inline void class_type_add_base_class(type_t* class_type, scope_entry_t*
     class_info_t* class_info = class_type->type->class_info;
     // Only add once
     P_LIST_ADD_ONCE(class_info->base_classes_list, class_info->num_bases, new_base_class);
+
+    // Member lookups in this class may find something else now
+    if (class_info->inner_decl_context != NULL)
+        class_scope_lookup_invalidate(class_info->inner_decl_context->current_scope);
 }
 
 void class_type_set_inner_context(type_t* class_type, const decl_context_t* decl_context)
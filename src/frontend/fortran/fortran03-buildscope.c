@@ -10313,6 +10313,7 @@ scope_entry_t* insert_symbol_from_module(scope_entry_t* entry,
 
     // Copy everything and restore the name
     *current_symbol = *entry;
+    symbol_entity_specs_unshare(current_symbol);
     symbol_clear_indirect_types(current_symbol);
 
     // Restore original context
@@ -54,11 +54,80 @@ def loadlines(f):
     return result
 
 
+# Attributes in group "hot" are stored in entity_specifiers_t itself. The
+# attributes of any other group are stored in a record of that group that is
+# only allocated the first time one of its attributes is set
+GROUPS = ["hot", "function", "variable", "templates", "extra", "fortran"]
+
+
 def check_file(lines):
     for l in lines:
         fields = l.split("|")
-        if len(fields) != 4:
+        if len(fields) != 4 and len(fields) != 5:
             raise Exception("Invalid number of fields")
+        if get_group(l) not in GROUPS:
+            raise Exception("Invalid group '%s'" % (get_group(l)))
+
+
+def get_fields(l):
+    return l.split("|")[0:4]
+
+
+def get_group(l):
+    fields = l.split("|")
+    (_type, language) = fields[0:2]
+    if len(fields) == 5:
+        return fields[4].strip(" \n")
+    elif _type.strip() == "bool":
+        return "hot"
+    elif language.strip() == "fortran":
+        return "fortran"
+    else:
+        return "extra"
+
+
+def group_typename(group):
+    if group == "hot":
+        return "entity_specifiers_t"
+    else:
+        return "entity_specifiers_%s_t" % (group)
+
+
+# Pointer to the record of the group, NULL if it has not been allocated yet
+def group_peek(group, s):
+    if group == "hot":
+        return "&%s->_entity_specs" % (s)
+    else:
+        return "%s->_entity_specs.%s" % (s, group)
+
+
+# Pointer to the record of the group for reading. If it has not been allocated
+# all its attributes read as zero
+def group_read(group, s):
+    if group == "hot":
+        return "&%s->_entity_specs" % (s)
+    else:
+        return "symbol_entity_specs_read_%s_group(%s)" % (group, s)
+
+
+# Pointer to the record of the group for writing, allocates it if needed
+def group_write(group, s):
+    if group == "hot":
+        return "&%s->_entity_specs" % (s)
+    else:
+        return "symbol_entity_specs_write_%s_group(%s)" % (group, s)
+
+
+def get_array_names(name):
+    field_names = name.split(",")
+    if (len(field_names) == 1):
+        return ("num_" + name, name)
+    elif (len(field_names) == 2):
+        return (field_names[0], field_names[1])
+    else:
+        raise Exception(
+            "Invalid number of fields in array name. Only 1 or 2 comma-separated are allowed"
+        )
 
 
 def get_up_to_matching_paren(s):
@@ -143,19 +212,15 @@ def print_type_and_name(_type, name):
 
 def print_entity_specifiers(lines):
     indent = " " * 4
-    current_language = "all"
-    decls = []
+    decls = {}
+    for g in GROUPS:
+        decls[g] = []
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[0] == "*":
             name = name[1:]
-
-        language = language.strip(" \n")
-        if (language != current_language):
-            current_language = language
-        descr = description.strip(" \n")
-        decls += print_type_and_name(_type, name)
+        decls[get_group(l)] += print_type_and_name(_type, name)
 
     print("""
 #ifndef CXX_ENTITY_SPECIFIERS_H
@@ -164,17 +229,32 @@ def print_entity_specifiers(lines):
 #include <stdbool.h>
 
 // Include this file only from cxx-scope-decls.h and not from anywhere else
+""")
 
-typedef struct entity_specifiers_tag\n{""")
+    def print_fields(group_decls):
+        for tk in [
+                TypeKind.OTHER, TypeKind.POINTER, TypeKind.INTEGER, TypeKind.BIT
+        ]:
+            for d in group_decls:
+                (typename, name, suffix, k) = d
+                if k == tk:
+                    print(indent + typename + " " + name + suffix + ";")
 
-    for tk in [
-            TypeKind.OTHER, TypeKind.POINTER, TypeKind.INTEGER, TypeKind.BIT
-    ]:
-        for d in decls:
-            (typename, name, suffix, k) = d
-            if k == tk:
-                print(indent + typename + " " + name + suffix + ";")
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print("// Attributes of group '%s', allocated on demand" % (g))
+        print("typedef struct entity_specifiers_%s_tag\n{" % (g))
+        print_fields(decls[g])
+        print("} %s;" % (group_typename(g)))
+        print("")
 
+    print("typedef struct entity_specifiers_tag\n{")
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print(indent + group_typename(g) + "* " + g + ";")
+    print_fields(decls["hot"])
     print("} entity_specifiers_t;")
     print("")
     print("#endif")
@@ -196,13 +276,28 @@ def print_getters_setters(lines):
 // Include this file only from cxx-scope-decls.h and not from anywhere else
 
 """)
-    current_language = "all"
-    decls = []
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print("// Group of attributes '%s'" % (g))
+        print(
+            "LIBMCXX_EXTERN const %s symbol_entity_specs_empty_%s_group;"
+            % (group_typename(g), g))
+        print(
+            "static inline const %s* symbol_entity_specs_read_%s_group(scope_entry_t* s)\n{\n    if (s->_entity_specs.%s == NULL)\n        return &symbol_entity_specs_empty_%s_group;\n    return s->_entity_specs.%s;\n}"
+            % (group_typename(g), g, g, g, g))
+        print(
+            "static inline %s* symbol_entity_specs_write_%s_group(scope_entry_t* s)\n{\n    if (s->_entity_specs.%s == NULL)\n        s->_entity_specs.%s = NEW0(%s);\n    return s->_entity_specs.%s;\n}"
+            % (group_typename(g), g, g, g, group_typename(g), g))
+        print("")
+
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[0] == "*":
             name = name[1:]
+        group = get_group(l)
+        gtype = group_typename(group)
 
         # Atomic types
         if (_type in
@@ -214,26 +309,16 @@ def print_getters_setters(lines):
             (typename, name, suffix, k) = decls[0]
             print("// Single value attribute: '%s' " % (name))
             print(
-                "static inline %s symbol_entity_specs_get_%s(scope_entry_t* s)\n{\n    return s->_entity_specs.%s;\n}"
-                % (typename, name, name))
+                "static inline %s symbol_entity_specs_get_%s(scope_entry_t* s)\n{\n    return (%s)->%s;\n}"
+                % (typename, name, group_read(group, "s"), name))
             print(
-                "static inline void symbol_entity_specs_set_%s(scope_entry_t* s, %s v)\n{\n    s->_entity_specs.%s = v;\n}"
-                % (name, typename, name))
+                "static inline void symbol_entity_specs_set_%s(scope_entry_t* s, %s v)\n{\n    (%s)->%s = v;\n}"
+                % (name, typename, group_write(group, "s"), name))
             print("")
         # Compound types
         elif _type.startswith("array"):
             type_name = get_up_to_matching_paren(_type[len("array"):])
-            field_names = name.split(",")
-            if (len(field_names) == 1):
-                num_name = "num_" + name
-                list_name = name
-            elif (len(field_names) == 2):
-                num_name = field_names[0]
-                list_name = field_names[1]
-            else:
-                raise Exception(
-                    "Invalid number of fields in array name. Only 1 or 2 comma-separated are allowed"
-                )
+            (num_name, list_name) = get_array_names(name)
 
             decls = print_type_and_name(type_name, "")
             if len(decls) != 1:
@@ -251,99 +336,134 @@ def print_getters_setters(lines):
                     "// Note: The number of values of this attribute is stored in attribute '%s'"
                     % (num_name))
 
+            read_group = "const %s* g = %s;" % (gtype, group_read(group, "s"))
+            write_group = "%s* g = %s;" % (gtype, group_write(group, "s"))
+
             print(
-                "static inline int symbol_entity_specs_get_%s(scope_entry_t* s)\n{\n    return s->_entity_specs.%s;\n}"
-                % (num_name, num_name))
+                "static inline int symbol_entity_specs_get_%s(scope_entry_t* s)\n{\n    return (%s)->%s;\n}"
+                % (num_name, group_read(group, "s"), num_name))
             print(
-                "static inline %s symbol_entity_specs_get_%s_num(scope_entry_t* s, int i)\n{\n    ERROR_CONDITION(i >= s->_entity_specs.%s,\n        \"Invalid index %%d >= %%d\",\n        i, s->_entity_specs.%s);\n    return s->_entity_specs.%s[i];\n}"
-                % (type_name, list_name, num_name, num_name, list_name))
+                "static inline %s symbol_entity_specs_get_%s_num(scope_entry_t* s, int i)\n{\n    %s\n    ERROR_CONDITION(i >= g->%s,\n        \"Invalid index %%d >= %%d\",\n        i, g->%s);\n    return g->%s[i];\n}"
+                % (type_name, list_name, read_group, num_name, num_name, list_name))
             print(
-                "static inline void symbol_entity_specs_set_%s_num(scope_entry_t* s, int i, %s v)\n{\n    ERROR_CONDITION(i >= s->_entity_specs.%s,\n        \"Invalid index %%d >= %%d\",\n         i, s->_entity_specs.%s);\n    s->_entity_specs.%s[i] = v;\n}"
-                % (list_name, type_name, num_name, num_name, list_name))
+                "static inline void symbol_entity_specs_set_%s_num(scope_entry_t* s, int i, %s v)\n{\n    %s\n    ERROR_CONDITION(i >= g->%s,\n        \"Invalid index %%d >= %%d\",\n         i, g->%s);\n    g->%s[i] = v;\n}"
+                % (list_name, type_name, write_group, num_name, num_name, list_name))
             print(
-                "static inline void symbol_entity_specs_append_%s(scope_entry_t* s, %s item)\n{\n    P_LIST_ADD(s->_entity_specs.%s, s->_entity_specs.%s, item);\n}"
-                % (list_name, type_name, list_name, num_name))
+                "static inline void symbol_entity_specs_append_%s(scope_entry_t* s, %s item)\n{\n    %s\n    P_LIST_ADD(g->%s, g->%s, item);\n}"
+                % (list_name, type_name, write_group, list_name, num_name))
             if type_name not in cannot_be_compared:
                 print(
-                    "static inline void symbol_entity_specs_remove_%s(scope_entry_t* s, %s item)\n{\n    P_LIST_REMOVE(s->_entity_specs.%s, s->_entity_specs.%s, item);\n}"
-                    % (list_name, type_name, list_name, num_name))
+                    "static inline void symbol_entity_specs_remove_%s(scope_entry_t* s, %s item)\n{\n    %s\n    P_LIST_REMOVE(g->%s, g->%s, item);\n}"
+                    % (list_name, type_name, write_group, list_name, num_name))
                 print(
-                    "static inline void symbol_entity_specs_insert_%s(scope_entry_t* s, %s item)\n{\n    P_LIST_ADD_ONCE(s->_entity_specs.%s, s->_entity_specs.%s, item);\n}"
-                    % (list_name, type_name, list_name, num_name))
+                    "static inline void symbol_entity_specs_insert_%s(scope_entry_t* s, %s item)\n{\n    %s\n    P_LIST_ADD_ONCE(g->%s, g->%s, item);\n}"
+                    % (list_name, type_name, write_group, list_name, num_name))
             print(
-                "static inline void symbol_entity_specs_remove_%s_cmp(scope_entry_t* s, %s item,\n        char (*cmp)(%s, %s))\n{\n    P_LIST_REMOVE_FUN(s->_entity_specs.%s, s->_entity_specs.%s, item, cmp);\n}"
-                % (list_name, type_name, type_name, type_name, list_name,
-                   num_name))
+                "static inline void symbol_entity_specs_remove_%s_cmp(scope_entry_t* s, %s item,\n        char (*cmp)(%s, %s))\n{\n    %s\n    P_LIST_REMOVE_FUN(g->%s, g->%s, item, cmp);\n}"
+                % (list_name, type_name, type_name, type_name, write_group,
+                   list_name, num_name))
             print(
-                "static inline void symbol_entity_specs_insert_%s_cmp(scope_entry_t* s, %s item,\n        char (*cmp)(%s, %s))\n{\n    P_LIST_ADD_ONCE_FUN(s->_entity_specs.%s, s->_entity_specs.%s, item, cmp);\n}"
-                % (list_name, type_name, type_name, type_name, list_name,
-                   num_name))
+                "static inline void symbol_entity_specs_insert_%s_cmp(scope_entry_t* s, %s item,\n        char (*cmp)(%s, %s))\n{\n    %s\n    P_LIST_ADD_ONCE_FUN(g->%s, g->%s, item, cmp);\n}"
+                % (list_name, type_name, type_name, type_name, write_group,
+                   list_name, num_name))
             print(
                 "static inline void symbol_entity_specs_add_%s(scope_entry_t* s, %s item)\n{\n    symbol_entity_specs_append_%s(s, item);\n}"
                 % (list_name, type_name, list_name))
             print(
-                "static inline void symbol_entity_specs_reserve_%s(scope_entry_t* s, int num)\n{\n    s->_entity_specs.%s = num;\n    s->_entity_specs.%s = NEW_VEC0(%s, num);\n}"
-                % (list_name, num_name, list_name, type_name))
-            # print "static inline void symbol_entity_specs_clear_%s(scope_entry_t* s)\n{\n    s->_entity_specs.%s = NULL;\n    s->_entity_specs.%s = 0;\n}" % (list_name, list_name, num_name)
+                "static inline void symbol_entity_specs_reserve_%s(scope_entry_t* s, int num)\n{\n    %s\n    g->%s = num;\n    g->%s = NEW_VEC0(%s, num);\n}"
+                % (list_name, write_group, num_name, list_name, type_name))
+            # Freeing does not allocate the group
+            null_check = ""
+            if group != "hot":
+                null_check = "    if (g == NULL)\n        return;\n"
             print(
-                "static inline void symbol_entity_specs_free_%s(scope_entry_t* s)\n{\n    s->_entity_specs.%s = 0;\n    DELETE(s->_entity_specs.%s);\n    s->_entity_specs.%s = NULL;\n}"
-                % (list_name, num_name, list_name, list_name))
+                "static inline void symbol_entity_specs_free_%s(scope_entry_t* s)\n{\n    %s* g = %s;\n%s    g->%s = 0;\n    DELETE(g->%s);\n    g->%s = NULL;\n}"
+                % (list_name, gtype, group_peek(group, "s"), null_check,
+                   num_name, list_name, list_name))
+            # Copying an empty array does not allocate the group
+            empty_check = ""
+            if group != "hot":
+                empty_check = "    if (num == 0 && %s == NULL)\n        return;\n" % (
+                    group_peek(group, "dest"))
             print(
-                "static inline void symbol_entity_specs_copy_%s_from(scope_entry_t* dest, scope_entry_t* source)\n{\n    symbol_entity_specs_reserve_%s(dest, source->_entity_specs.%s);\n    memcpy(dest->_entity_specs.%s,\n        source->_entity_specs.%s,\n        dest->_entity_specs.%s\n        * (sizeof (*(dest->_entity_specs.%s))));\n} "
-                % (list_name, list_name, num_name, list_name, list_name,
-                   num_name, list_name))
+                "static inline void symbol_entity_specs_copy_%s_from(scope_entry_t* dest, scope_entry_t* source)\n{\n    int num = symbol_entity_specs_get_%s(source);\n%s    symbol_entity_specs_reserve_%s(dest, num);\n    if (num == 0)\n        return;\n    memcpy((%s)->%s,\n        (%s)->%s,\n        num * (sizeof (*((%s)->%s))));\n} "
+                % (list_name, num_name, empty_check, list_name,
+                   group_peek(group, "dest"), list_name,
+                   group_peek(group, "source"), list_name,
+                   group_peek(group, "dest"), list_name))
             print("")
 
+    print("// After a plain copy of a symbol, like '*dest = *source', makes sure")
+    print("// dest does not share the records of the groups with source. Arrays")
+    print("// are still shared, as they would be in a plain copy")
+    print("static inline void symbol_entity_specs_unshare(scope_entry_t* dest)")
+    print("{")
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print("    if (dest->_entity_specs.%s != NULL)" % (g))
+        print("    {")
+        print("        %s* g = NEW(%s);" % (group_typename(g), group_typename(g)))
+        print("        *g = *dest->_entity_specs.%s;" % (g))
+        print("        dest->_entity_specs.%s = g;" % (g))
+        print("    }")
+    print("}")
+    print("")
+
     print(
         "static inline void symbol_entity_specs_copy_from(scope_entry_t* dest, scope_entry_t* source)"
     )
     print("{")
     print("    dest->_entity_specs = source->_entity_specs;")
+    print("    symbol_entity_specs_unshare(dest);")
     # Now copy every list
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[0] == "*":
             name = name[1:]
         if _type.startswith("array"):
-            type_name = get_up_to_matching_paren(_type[len("array"):])
-            field_names = name.split(",")
-            if (len(field_names) == 1):
-                num_name = "num_" + name
-                list_name = name
-            elif (len(field_names) == 2):
-                num_name = field_names[0]
-                list_name = field_names[1]
-            else:
-                raise Exception(
-                    "Invalid number of fields in array name. Only 1 or 2 comma-separated are allowed"
-                )
+            (num_name, list_name) = get_array_names(name)
             print("    symbol_entity_specs_copy_%s_from(dest, source);" %
                   (list_name))
     print("}")
     print("")
+
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print("static inline void symbol_entity_specs_free_%s_group(scope_entry_t* symbol)" % (g))
+        print("{")
+        print("    if (symbol->_entity_specs.%s == NULL)" % (g))
+        print("        return;")
+        for l in lines:
+            fields = get_fields(l)
+            (_type, language, name, description) = fields
+            if name[0] == "*":
+                name = name[1:]
+            if _type.startswith("array") and get_group(l) == g:
+                (num_name, list_name) = get_array_names(name)
+                print("    symbol_entity_specs_free_%s(symbol);" % (list_name))
+        print("    DELETE(symbol->_entity_specs.%s);" % (g))
+        print("    symbol->_entity_specs.%s = NULL;" % (g))
+        print("}")
+        print("")
+
     print("static inline void symbol_entity_specs_free(scope_entry_t* symbol)")
     print("{")
-    # Now copy every list
+    # Now free every list
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[0] == "*":
             name = name[1:]
-        if _type.startswith("array"):
-            type_name = get_up_to_matching_paren(_type[len("array"):])
-            field_names = name.split(",")
-            if (len(field_names) == 1):
-                num_name = "num_" + name
-                list_name = name
-            elif (len(field_names) == 2):
-                num_name = field_names[0]
-                list_name = field_names[1]
-            else:
-                raise Exception(
-                    "Invalid number of fields in array name. Only 1 or 2 comma-separated are allowed"
-                )
+        if _type.startswith("array") and get_group(l) == "hot":
+            (num_name, list_name) = get_array_names(name)
             print("    symbol_entity_specs_free_%s(symbol);" % (list_name))
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print("    symbol_entity_specs_free_%s_group(symbol);" % (g))
     print("}")
 
     print("#endif")
@@ -664,7 +784,7 @@ def print_fortran_modules_functions(lines):
     _format = []
     _insert_code = []
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if (name[0] == "*"):
             continue
@@ -758,7 +878,7 @@ def print_fortran_modules_functions(lines):
     print("}")
     _extra_attr_code = []
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[0] == "*":
             continue
@@ -779,7 +899,7 @@ def print_fortran_modules_functions(lines):
     )
     print("{")
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[0] == "*":
             continue
@@ -789,7 +909,7 @@ def print_fortran_modules_functions(lines):
     print("typedef struct module_packed_bits_tag")
     print("{")
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[1] == "*":
             continue
@@ -804,7 +924,7 @@ def print_fortran_modules_functions(lines):
     print("module_packed_bits_t result;")
     print("memset(&result, 0, sizeof(result));")
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[1] == "*":
             continue
@@ -817,7 +937,7 @@ def print_fortran_modules_functions(lines):
     # print "static void unpack_bits(entity_specifiers_t *_entity_specs, module_packed_bits_t bitpack)"
     # print "{"
     # for l in lines:
-    #   fields = l.split("|");
+    #   fields = get_fields(l);
     #   (_type,language,name,description) = fields
     #   if name[1] == "*":
     #       continue;
@@ -830,7 +950,7 @@ def print_fortran_modules_functions(lines):
     )
     print("{")
     for l in lines:
-        fields = l.split("|")
+        fields = get_fields(l)
         (_type, language, name, description) = fields
         if name[1] == "*":
             continue
@@ -852,6 +972,13 @@ def print_deep_copy_entity_specs(lines):
     print("#include \"cxx-typeutils.h\"")
     print("#include \"string_utils.h\"")
 
+    print("")
+    for g in GROUPS:
+        if g == "hot":
+            continue
+        print("// All the attributes of this group are zero")
+        print("const %s symbol_entity_specs_empty_%s_group;" % (group_typename(g), g))
+
     print("""
     void symbol_deep_copy_entity_specs(scope_entry_t* dest, scope_entry_t* source,
              const decl_context_t* decl_context, symbol_map_t* symbol_map,
@@ -859,129 +986,138 @@ def print_deep_copy_entity_specs(lines):
              symbol_deep_copy_map_t* symbol_deep_copy_map)
     {
     """)
-    for l in lines:
-        fields = l.split("|")
-        (_type, language, name, description) = fields
-        if (name[0] == "*"):
-            name = name[1:]
-            continue
-        if name == "function_code":
-            print("// We do not copy function code!")
-            continue
-        if _type in ["bool", "integer"]:
-            print(
-                "symbol_entity_specs_set_%s(dest, symbol_entity_specs_get_%s(source));"
-                % (name, name))
-        elif (_type == "scope"):
-            print("symbol_entity_specs_set_%s(dest, decl_context);")
-        elif (_type == "nodecl"):
-            print(
-                "symbol_entity_specs_set_%s(dest, nodecl_deep_copy_compute_maps(symbol_entity_specs_get_%s(source), decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map));"
-                % (name, name))
-        elif (_type == "type"):
-            print(
-                "symbol_entity_specs_set_%s(dest, type_deep_copy_compute_maps(symbol_entity_specs_get_%s(source), /* symbol dest */ NULL, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map));"
-                % (name, name))
-        elif (_type == "symbol"):
-            print(
-                "symbol_entity_specs_set_%s(dest, symbol_map->map(symbol_map, symbol_entity_specs_get_%s(source)));"
-                % (name, name))
-        elif (_type == "string"):
-            print(
-                "symbol_entity_specs_set_%s(dest, symbol_entity_specs_get_%s(source));"
-                % (name, name))
-        elif (_type.startswith("typeof")):
-            type_name = get_up_to_matching_paren(
-                _type[len("typeof"):]).split(",")[0].strip()
-            if type_name in [
-                    "intent_kind_t", "access_specifier_t", "_size_t",
-                    "simplify_function_t"
-            ]:
+    for group in GROUPS:
+        if group != "hot":
+            # Only copy the groups that the source has
+            print("if (source->_entity_specs.%s != NULL)" % (group))
+            print("{")
+        for l in lines:
+            if get_group(l) != group:
+                continue
+            fields = get_fields(l)
+            (_type, language, name, description) = fields
+            if (name[0] == "*"):
+                name = name[1:]
+                continue
+            if name == "function_code":
+                print("// We do not copy function code!")
+                continue
+            if _type in ["bool", "integer"]:
                 print(
                     "symbol_entity_specs_set_%s(dest, symbol_entity_specs_get_%s(source));"
                     % (name, name))
-            else:
-                sys.stderr.write("%s:%d: warning: not handling typeof '%s'\n" %
-                                 (sys.argv[0], lineno(), type_name))
-        elif (_type.startswith("array")):
-            type_name = get_up_to_matching_paren(_type[len("array"):])
-            field_names = name.split(",")
-            if (len(field_names) == 1):
-                num_name = "num_" + name
-                list_name = name
-            elif (len(field_names) == 2):
-                num_name = field_names[0]
-                list_name = field_names[1]
-            else:
-                raise Exception(
-                    "Invalid number of fields in array name. Only 1 or 2 comma-separated are allowed"
-                )
-            if type_name.startswith("typeof"):
-                type_name = get_up_to_matching_paren(
-                    type_name[len("typeof"):]).split(",")[0].strip()
-            print("{")
-            print("symbol_entity_specs_free_%s(dest);" % (list_name))
-            print("int i, N = symbol_entity_specs_get_%s(source);" %
-                  (num_name))
-            print("for (i = 0; i < N; i++)")
-            print("{")
-            if type_name == "symbol":
+            elif (_type == "scope"):
+                print("symbol_entity_specs_set_%s(dest, decl_context);")
+            elif (_type == "nodecl"):
                 print(
-                    "scope_entry_t* copied = symbol_map->map(symbol_map, symbol_entity_specs_get_%s_num(source, i));"
-                    % (list_name))
-                print("symbol_entity_specs_add_%s(dest, copied);" %
-                      (list_name))
-            elif type_name == "type":
+                    "symbol_entity_specs_set_%s(dest, nodecl_deep_copy_compute_maps(symbol_entity_specs_get_%s(source), decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map));"
+                    % (name, name))
+            elif (_type == "type"):
                 print(
-                    "type_t* copied = type_deep_copy_compute_maps(symbol_entity_specs_get_%s_num(source, i), /* dest */ NULL, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map);"
-                    % (list_name))
-                print("symbol_entity_specs_add_%s(dest, copied);" %
-                      (list_name))
-            elif type_name == "default_argument_info_t*":
+                    "symbol_entity_specs_set_%s(dest, type_deep_copy_compute_maps(symbol_entity_specs_get_%s(source), /* symbol dest */ NULL, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map));"
+                    % (name, name))
+            elif (_type == "symbol"):
                 print(
-                    "default_argument_info_t* source_default_arg = symbol_entity_specs_get_%s_num(source, i);"
-                    % (list_name))
-                print("default_argument_info_t* copied = NULL;")
-                print("if (source_default_arg != NULL)")
-                print("{")
-                print("  copied = NEW0(default_argument_info_t);")
+                    "symbol_entity_specs_set_%s(dest, symbol_map->map(symbol_map, symbol_entity_specs_get_%s(source)));"
+                    % (name, name))
+            elif (_type == "string"):
                 print(
-                    "  copied->argument = nodecl_deep_copy_compute_maps(source_default_arg->argument, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map);"
-                )
-                print("  copied->context = decl_context;")
+                    "symbol_entity_specs_set_%s(dest, symbol_entity_specs_get_%s(source));"
+                    % (name, name))
+            elif (_type.startswith("typeof")):
+                type_name = get_up_to_matching_paren(
+                    _type[len("typeof"):]).split(",")[0].strip()
+                if type_name in [
+                        "intent_kind_t", "access_specifier_t", "_size_t",
+                        "simplify_function_t"
+                ]:
+                    print(
+                        "symbol_entity_specs_set_%s(dest, symbol_entity_specs_get_%s(source));"
+                        % (name, name))
+                else:
+                    sys.stderr.write("%s:%d: warning: not handling typeof '%s'\n" %
+                                     (sys.argv[0], lineno(), type_name))
+            elif (_type.startswith("array")):
+                type_name = get_up_to_matching_paren(_type[len("array"):])
+                field_names = name.split(",")
+                if (len(field_names) == 1):
+                    num_name = "num_" + name
+                    list_name = name
+                elif (len(field_names) == 2):
+                    num_name = field_names[0]
+                    list_name = field_names[1]
+                else:
+                    raise Exception(
+                        "Invalid number of fields in array name. Only 1 or 2 comma-separated are allowed"
+                    )
+                if type_name.startswith("typeof"):
+                    type_name = get_up_to_matching_paren(
+                        type_name[len("typeof"):]).split(",")[0].strip()
+                print("{")
+                print("symbol_entity_specs_free_%s(dest);" % (list_name))
+                print("int i, N = symbol_entity_specs_get_%s(source);" %
+                      (num_name))
+                print("for (i = 0; i < N; i++)")
+                print("{")
+                if type_name == "symbol":
+                    print(
+                        "scope_entry_t* copied = symbol_map->map(symbol_map, symbol_entity_specs_get_%s_num(source, i));"
+                        % (list_name))
+                    print("symbol_entity_specs_add_%s(dest, copied);" %
+                          (list_name))
+                elif type_name == "type":
+                    print(
+                        "type_t* copied = type_deep_copy_compute_maps(symbol_entity_specs_get_%s_num(source, i), /* dest */ NULL, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map);"
+                        % (list_name))
+                    print("symbol_entity_specs_add_%s(dest, copied);" %
+                          (list_name))
+                elif type_name == "default_argument_info_t*":
+                    print(
+                        "default_argument_info_t* source_default_arg = symbol_entity_specs_get_%s_num(source, i);"
+                        % (list_name))
+                    print("default_argument_info_t* copied = NULL;")
+                    print("if (source_default_arg != NULL)")
+                    print("{")
+                    print("  copied = NEW0(default_argument_info_t);")
+                    print(
+                        "  copied->argument = nodecl_deep_copy_compute_maps(source_default_arg->argument, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map);"
+                    )
+                    print("  copied->context = decl_context;")
+                    print("}")
+                    print("symbol_entity_specs_add_%s(dest, copied);" %
+                          (list_name))
+                elif type_name == "gcc_attribute_t":
+                    print(
+                        "gcc_attribute_t source_gcc_attr = symbol_entity_specs_get_%s_num(source, i);"
+                        % (list_name))
+                    print("gcc_attribute_t copied;")
+                    print(
+                        "copied.attribute_name = source_gcc_attr.attribute_name;")
+                    print(
+                        "copied.expression_list = nodecl_deep_copy_compute_maps(source_gcc_attr.expression_list, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map);"
+                    )
+                    print("symbol_entity_specs_add_%s(dest, copied);" %
+                          (list_name))
+                elif type_name == "function_parameter_info_t":
+                    print(
+                        "function_parameter_info_t param_info = symbol_entity_specs_get_%s_num(source, i);"
+                        % (list_name))
+                    print(
+                        "param_info.function = symbol_map->map(symbol_map, param_info.function);"
+                    )
+                    print("symbol_entity_specs_add_%s(dest, param_info);" %
+                          (list_name))
+                else:
+                    sys.stderr.write(
+                        "%s:%d: warning: not handling type array of type '%s'\n" %
+                        (sys.argv[0], lineno(), _type))
+                print("}")
                 print("}")
-                print("symbol_entity_specs_add_%s(dest, copied);" %
-                      (list_name))
-            elif type_name == "gcc_attribute_t":
-                print(
-                    "gcc_attribute_t source_gcc_attr = symbol_entity_specs_get_%s_num(source, i);"
-                    % (list_name))
-                print("gcc_attribute_t copied;")
-                print(
-                    "copied.attribute_name = source_gcc_attr.attribute_name;")
-                print(
-                    "copied.expression_list = nodecl_deep_copy_compute_maps(source_gcc_attr.expression_list, decl_context, symbol_map, nodecl_deep_copy_map, symbol_deep_copy_map);"
-                )
-                print("symbol_entity_specs_add_%s(dest, copied);" %
-                      (list_name))
-            elif type_name == "function_parameter_info_t":
-                print(
-                    "function_parameter_info_t param_info = symbol_entity_specs_get_%s_num(source, i);"
-                    % (list_name))
-                print(
-                    "param_info.function = symbol_map->map(symbol_map, param_info.function);"
-                )
-                print("symbol_entity_specs_add_%s(dest, param_info);" %
-                      (list_name))
             else:
-                sys.stderr.write(
-                    "%s:%d: warning: not handling type array of type '%s'\n" %
-                    (sys.argv[0], lineno(), _type))
-            print("}")
+                sys.stderr.write("%s:%d: warning: not handling type '%s'\n" %
+                                 (sys.argv[0], lineno(), _type))
+        if group != "hot":
             print("}")
-        else:
-            sys.stderr.write("%s:%d: warning: not handling type '%s'\n" %
-                             (sys.argv[0], lineno(), _type))
     print("""
     }
     """)
@@ -274,6 +274,121 @@ class NodeclStructure(Variable):
             i = i + 1
         print("}")
 
+    def shallow_check_function_name(self):
+        return "nodecl_shallow_check_%s" % (self.base_name_to_underscore())
+
+    # Like function_check_code but children are only checked to be of a
+    # kind allowed by their rule, they are not checked recursively
+    def function_shallow_check_code(self):
+        print("static void %s(nodecl_t n)" %
+              (self.shallow_check_function_name()))
+        print("{")
+        if (self.needs_symbol):
+            print(
+                "   ERROR_CONDITION(nodecl_get_symbol(n) == NULL, \"Tree lacks a symbol\", 0);"
+            )
+        if (self.needs_type):
+            print(
+                "   ERROR_CONDITION(nodecl_get_type(n) == NULL, \"Tree lacks a type\", 0);"
+            )
+        if (self.needs_text):
+            print(
+                "   ERROR_CONDITION(nodecl_get_text(n) == NULL, \"Tree lacks an associated text\", 0);"
+            )
+        if (self.needs_cval):
+            print(
+                "   ERROR_CONDITION(nodecl_get_constant(n) == NULL, \"Tree lacks a constant value\", 0);"
+            )
+        i = 0
+        for subtree in self.subtrees:
+            (rule_label, rule_ref) = subtree
+
+            current_rule = RuleRef(rule_ref)
+            first_set = current_rule.first()
+
+            if current_rule.is_nullable() and not first_set:
+                i = i + 1
+                continue
+
+            print("{")
+            print("nodecl_t child = nodecl_get_child(n, %d);" % (i))
+            if not current_rule.is_nullable():
+                print(
+                    "ERROR_CONDITION(nodecl_is_null(child), \"Child %d of %%s is null\", ast_print_node_type(nodecl_get_kind(n)));"
+                    % (i))
+            if first_set:
+                print("if (!nodecl_is_null(child))")
+                print("switch (nodecl_get_kind(child))")
+                print("{")
+                for first in first_set:
+                    print("case %s:" % (first))
+                print("break;")
+                print("default:")
+                print(
+                    "internal_error(\"Node of kind %%s not valid as child %d of %%s\", ast_print_node_type(nodecl_get_kind(child)), ast_print_node_type(nodecl_get_kind(n)));"
+                    % (i))
+                print("break;")
+                print("}")
+            print("}")
+
+            i = i + 1
+        print("}")
+
+    def has_list_children(self):
+        for (rule_label, rule_ref) in self.subtrees:
+            if RuleRef(rule_ref).is_seq():
+                return True
+        return False
+
+    def list_item_check_function_name(self):
+        return "nodecl_shallow_check_list_item_%s" % (
+            self.base_name_to_underscore())
+
+    # Checks that an item of the list hanging from child num_child is of a
+    # kind allowed by the rule of that child
+    def function_list_item_check_code(self):
+        print("static void %s(nodecl_t item, int num_child)" %
+              (self.list_item_check_function_name()))
+        print("{")
+        print("switch (num_child)")
+        print("{")
+        i = 0
+        for subtree in self.subtrees:
+            (rule_label, rule_ref) = subtree
+
+            current_rule = RuleRef(rule_ref)
+            if not current_rule.is_seq():
+                i = i + 1
+                continue
+
+            item_rule = RuleRef(current_rule.canonical_rule())
+            print("case %d:" % (i))
+            print("{")
+            print("switch (nodecl_get_kind(item))")
+            print("{")
+            for first in item_rule.first():
+                print("case %s:" % (first))
+            print("break;")
+            print("default:")
+            print(
+                "internal_error(\"Node of kind %%s not valid as an item of child %d of %%s\", ast_print_node_type(nodecl_get_kind(item)), ast_print_node_type(%s));"
+                % (i, self.name_to_underscore()))
+            print("break;")
+            print("}")
+            print("break;")
+            print("}")
+
+            i = i + 1
+        print("default:")
+        print("{")
+        print(
+            "internal_error(\"Child %%d of %%s is not a list\", num_child, ast_print_node_type(%s));"
+            % (self.name_to_underscore()))
+        print("break;")
+        print("}")
+        print("}")
+        print("}")
+
 
 class RuleRef(Variable):
     def __init__(self, rule_ref):
@@ -464,6 +579,82 @@ def generate_check_routines(rule_map):
     print("nodecl_check_nodecl(_nodecl_wrap(a));")
     print("}")
 
+    for node in nodes:
+        node.function_shallow_check_code()
+        if node.has_list_children():
+            node.function_list_item_check_code()
+
+    print(
+        "static void nodecl_shallow_check_list_item(nodecl_t owner, int num_child, nodecl_t item)"
+    )
+    print("{")
+    print("switch (nodecl_get_kind(owner))")
+    print("{")
+    for node in nodes:
+        if not node.has_list_children():
+            continue
+        print("case %s:" % (node.name_to_underscore()))
+        print("{")
+        print("%s(item, num_child);" % (node.list_item_check_function_name()))
+        print("break;")
+        print("}")
+    print("default:")
+    print("{")
+    print(
+        "internal_error(\"Node of kind %s cannot have lists\", ast_print_node_type(nodecl_get_kind(owner)));"
+    )
+    print("break;")
+    print("}")
+    print("}")
+    print("}")
+
+    print("void nodecl_check_node(AST a)")
+    print("{")
+    print("nodecl_t n = _nodecl_wrap(a);")
+    print("switch (nodecl_get_kind(n))")
+    print("{")
+    print("case AST_NODE_LIST:")
+    print("{")
+    print("// The item of a list node is checked against the rule of the")
+    print("// node that owns the whole list")
+    print("nodecl_t list_root = n;")
+    print("nodecl_t owner = nodecl_get_parent(n);")
+    print("while (!nodecl_is_null(owner) && nodecl_is_list(owner))")
+    print("{")
+    print("list_root = owner;")
+    print("owner = nodecl_get_parent(owner);")
+    print("}")
+    print("// Lists that are not in the tree yet have no rule to check")
+    print("if (nodecl_is_null(owner))")
+    print("break;")
+    print("int num_child = 0;")
+    print("while (num_child < MCXX_MAX_AST_CHILDREN")
+    print("&& nodecl_get_ast(nodecl_get_child(owner, num_child)) != nodecl_get_ast(list_root))")
+    print("num_child++;")
+    print(
+        "ERROR_CONDITION(num_child == MCXX_MAX_AST_CHILDREN, \"List is not a child of its parent\", 0);"
+    )
+    print("nodecl_t item = nodecl_get_child(n, 1);")
+    print("if (!nodecl_is_null(item))")
+    print("nodecl_shallow_check_list_item(owner, num_child, item);")
+    print("break;")
+    print("}")
+    for node in nodes:
+        print("case %s:" % (node.name_to_underscore()))
+        print("{")
+        print("%s(n);" % (node.shallow_check_function_name()))
+        print("break;")
+        print("}")
+    print("default:")
+    print("{")
+    print(
+        "internal_error(\"Node of kind %s not valid\", ast_print_node_type(nodecl_get_kind(n)));"
+    )
+    print("break;")
+    print("}")
+    print("}")
+    print("}")
+
 
 def from_underscore_to_camel_case(x):
     result = ''
@@ -776,6 +967,8 @@ def generate_visitor_class_header(rule_map):
     print("""
     if (n.is_null())
         return Ret();
+    if (n.get_kind() == NODECL_TOP_LEVEL)
+        ::nodecl_note_top_level_walk();
     switch ((int)n.get_kind())
     {
         case AST_NODE_LIST: { TL::ObjectList<Ret> result; AST tree = nodecl_get_ast(n._n); AST it; for_each_element(tree, it) { AST elem = ASTSon1(it);
@@ -826,6 +1019,8 @@ def generate_visitor_class_impl(rule_map):
     print("""
     if (n.is_null())
         return;
+    if (n.get_kind() == NODECL_TOP_LEVEL)
+        ::nodecl_note_top_level_walk();
     switch ((int)n.get_kind())
     {
         case AST_NODE_LIST: { AST tree = nodecl_get_ast(n._n); AST it; for_each_element(tree, it) { AST elem = ASTSon1(it);
@@ -47,9 +47,11 @@
 #include "cxx-compilerphases.hpp"
 #include "tl-compilerphase.hpp"
 #include "tl-setdto-phase.hpp"
+#include "tl-traversal-phase.hpp"
 #include "tl-objectlist.hpp"
 #include "tl-builtin.hpp"
 #include "tl-nodecl.hpp"
+#include "tl-nodecl-utils.hpp"
 #include "codegen-phase.hpp"
 
 namespace TL
@@ -65,6 +67,25 @@ namespace TL
 #else
             typedef HMODULE lib_handle_t;
 #endif
+
+            // Checks the links of the tree according to --check-tree. In
+            // dirty mode the structure of the modified nodes is checked too
+            static bool check_tree_links(translation_unit_t* translation_unit)
+            {
+                AST tree = nodecl_get_ast(translation_unit->nodecl);
+                switch (CURRENT_CONFIGURATION->check_tree_mode)
+                {
+                    case CHECK_TREE_NONE:
+                        return true;
+                    case CHECK_TREE_DIRTY:
+                        return ast_check_dirty(tree, nodecl_check_node);
+                    case CHECK_TREE_FULL:
+                        return ast_check(tree);
+                    default:
+                        internal_error("Code unreachable", 0);
+                }
+                return false;
+            }
         public:
             static std::set<lib_handle_t> lib_handle_list;
         public :
@@ -125,7 +146,7 @@ namespace TL
 
                     }
 
-                    if (!ast_check(nodecl_get_ast(translation_unit->nodecl)))
+                    if (!check_tree_links(translation_unit))
                     {
                         internal_error("Phase '%s' rendered the AST invalid. Ending compilation\n",
                                 phase->get_phase_name().c_str());
@@ -142,6 +163,108 @@ namespace TL
                 }
             }
 
+            static bool can_be_fused(const std::vector<TL::TraversalPhase*>& fused_phases,
+                    TL::TraversalPhase* phase)
+            {
+                for (std::vector<TL::TraversalPhase*>::const_iterator it = fused_phases.begin();
+                        it != fused_phases.end();
+                        it++)
+                {
+                    if (!(*it)->can_be_fused_with(*phase))
+                        return false;
+                }
+                return true;
+            }
+
+            static void run_fused_phases(const std::vector<TL::TraversalPhase*>& fused_phases,
+                    TL::DTO& dto,
+                    translation_unit_t* translation_unit)
+            {
+                for (std::vector<TL::TraversalPhase*>::const_iterator it = fused_phases.begin();
+                        it != fused_phases.end();
+                        it++)
+                {
+                    DEBUG_CODE()
+                    {
+                        fprintf(stderr, "COMPILERPHASES: Running phase '%s' in a shared walk\n",
+                                (*it)->get_phase_name().c_str());
+                    }
+                    (*it)->pre_traversal(dto);
+                }
+
+                TL::TraversalPhase::traverse(translation_unit->nodecl, fused_phases);
+
+                for (std::vector<TL::TraversalPhase*>::const_iterator it = fused_phases.begin();
+                        it != fused_phases.end();
+                        it++)
+                {
+                    (*it)->post_traversal(dto);
+                }
+            }
+
+            static void check_phase_execution(TL::CompilerPhase* phase,
+                    translation_unit_t* translation_unit,
+                    bool check_tree)
+            {
+                if (phase->get_phase_status() != CompilerPhase::PHASE_STATUS_OK)
+                {
+                    // Ideas to improve this are welcome :)
+                    fatal_error("Compiler phase '%s' notified that it did not end successfully. Ending compilation",
+                            phase->get_phase_name().c_str());
+                }
+
+                char there_were_errors = (diagnostics_get_error_count() != 0);
+                if (CURRENT_CONFIGURATION->warnings_as_errors)
+                {
+                    there_were_errors = there_were_errors || (diagnostics_get_warn_count() != 0);
+                }
+
+                if (there_were_errors)
+                {
+                    fatal_error("Compiler phase '%s' yielded diagnostic errors. Ending compilation",
+                            phase->get_phase_name().c_str());
+                }
+
+                DEBUG_CODE()
+                {
+                    fprintf(stderr, "COMPILERPHASES: Phase '%s' has been run\n", phase->get_phase_name().c_str());
+                }
+
+                if (!check_tree
+                        || CURRENT_CONFIGURATION->check_tree_mode == CHECK_TREE_NONE)
+                    return;
+
+                // For consistency, check the tree
+                DEBUG_CODE()
+                {
+                    fprintf(stderr, "COMPILERPHASES: Checking tree after execution of phase '%s'\n",
+                            phase->get_phase_name().c_str());
+
+                }
+
+                // Check the tree
+                if (!check_tree_links(translation_unit))
+                {
+                    internal_error("Phase '%s' rendered the AST invalid. Ending compilation\n",
+                            phase->get_phase_name().c_str());
+                }
+                else
+                {
+                    DEBUG_CODE()
+                    {
+                        fprintf(stderr, "COMPILERPHASES: Tree seems fine after execution of phase '%s'\n",
+                                phase->get_phase_name().c_str());
+
+                    }
+                }
+                // In dirty mode the structure of the modified nodes has
+                // already been checked along with their links
+                if (CURRENT_CONFIGURATION->check_tree_mode == CHECK_TREE_FULL)
+                {
+                    nodecl_check_tree(nodecl_get_ast(translation_unit->nodecl));
+                }
+            }
+
             static void start_compiler_phase_execution(compilation_configuration_t* config, translation_unit_t* translation_unit)
             {
                 if (compiler_phases.find(config) == compiler_phases.end())
@@ -152,9 +275,12 @@ namespace TL
 
                 compiler_phases_list_t &compiler_phases_list = compiler_phases[config];
 
+                // Phases that do not walk the whole translation unit, or that
+                // skip it, do not count
+                int walks_before = nodecl_get_num_top_level_walks();
                 for (compiler_phases_list_t::iterator it = compiler_phases_list.begin();
                         it != compiler_phases_list.end();
-                        it++)
+                        )
                 {
                     DEBUG_CODE()
                     {
@@ -169,76 +295,65 @@ namespace TL
                         fprintf(stderr, "COMPILERPHASES: DTO: No more keys\n");
                     }
 
-                    TL::CompilerPhase* phase = (*it);
-
-                    DEBUG_CODE()
+                    // Consecutive traversal phases that can share a walk
+                    std::vector<TL::TraversalPhase*> fused_phases;
+                    compiler_phases_list_t::iterator next = it;
+                    while (next != compiler_phases_list.end())
                     {
-                        fprintf(stderr, "COMPILERPHASES: Running phase '%s'\n", phase->get_phase_name().c_str());
-                    }
-
-                    phase->run(dto);
+                        TL::TraversalPhase* traversal_phase = dynamic_cast<TL::TraversalPhase*>(*next);
+                        if (traversal_phase == NULL
+                                || !can_be_fused(fused_phases, traversal_phase))
+                            break;
 
-                    if (phase->get_phase_status() != CompilerPhase::PHASE_STATUS_OK)
-                    {
-                        // Ideas to improve this are welcome :)
-                        fatal_error("Compiler phase '%s' notified that it did not end successfully. Ending compilation",
-                                phase->get_phase_name().c_str());
+                        fused_phases.push_back(traversal_phase);
+                        next++;
                     }
 
-                    char there_were_errors = (diagnostics_get_error_count() != 0);
-                    if (CURRENT_CONFIGURATION->warnings_as_errors)
+                    if (fused_phases.size() > 1)
                     {
-                        there_were_errors = there_were_errors || (diagnostics_get_warn_count() != 0);
+                        run_fused_phases(fused_phases, dto, translation_unit);
                     }
-
-                    if (there_were_errors)
+                    else
                     {
-                        fatal_error("Compiler phase '%s' yielded diagnostic errors. Ending compilation",
-                                phase->get_phase_name().c_str());
-                    }
+                        next = it + 1;
 
-                    DEBUG_CODE()
-                    {
-                        fprintf(stderr, "COMPILERPHASES: Phase '%s' has been run\n", phase->get_phase_name().c_str());
-                    }
+                        TL::CompilerPhase* phase = (*it);
 
-                    // For consistency, check the tree
-                    DEBUG_CODE()
-                    {
-                        fprintf(stderr, "COMPILERPHASES: Checking tree after execution of phase '%s'\n",
-                                phase->get_phase_name().c_str());
+                        DEBUG_CODE()
+                        {
+                            fprintf(stderr, "COMPILERPHASES: Running phase '%s'\n", phase->get_phase_name().c_str());
+                        }
 
+                        phase->run(dto);
                     }
 
-                    // Check the tree
-                    if (!ast_check(nodecl_get_ast(translation_unit->nodecl)))
-                    {
-                        internal_error("Phase '%s' rendered the AST invalid. Ending compilation\n",
-                                phase->get_phase_name().c_str());
-                    }
-                    else
+                    for (; it != next; it++)
                     {
+                        TL::CompilerPhase* phase = (*it);
+
+                        // The tree is checked once after a shared walk
+                        check_phase_execution(phase, translation_unit, /* check_tree */ it + 1 == next);
+
                         DEBUG_CODE()
                         {
-                            fprintf(stderr, "COMPILERPHASES: Tree seems fine after execution of phase '%s'\n",
+                            fprintf(stderr, "COMPILERPHASES: Running phase cleanup of phase '%s'\n",
+                                    phase->get_phase_name().c_str());
+                        }
+                        // Invoke file cleanup for phase
+                        phase->phase_cleanup(dto);
+                        DEBUG_CODE()
+                        {
+                            fprintf(stderr, "COMPILERPHASES: Phase cleanup of phase '%s' finished\n",
                                     phase->get_phase_name().c_str());
-
                         }
                     }
-                    nodecl_check_tree(nodecl_get_ast(translation_unit->nodecl));
+                }
 
-                    DEBUG_CODE()
-                    {
-                        fprintf(stderr, "COMPILERPHASES: Running phase cleanup of phase '%s'\n",
-                                phase->get_phase_name().c_str());
-                    }
-                    // Invoke file cleanup for phase
-                    phase->phase_cleanup(dto);
-                    DEBUG_CODE()
-                    {
-                        fprintf(stderr, "COMPILERPHASES: Phase cleanup of phase '%s' finished\n",
-                                phase->get_phase_name().c_str());
-                    }
+                if (CURRENT_CONFIGURATION->verbose)
+                {
+                    fprintf(stderr, "Ran %d compiler phases with %d walks of the translation unit\n",
+                            (int)compiler_phases_list.size(),
+                            nodecl_get_num_top_level_walks() - walks_before);
                 }
 
                 // Run cleanup after the whole pipeline has been run
@@ -259,6 +374,9 @@ namespace TL
                                 phase->get_phase_name().c_str());
                     }
                 }
+
+                // Structural ids are only compared within a translation unit
+                Nodecl::Utils::clear_structural_ids();
             }
 
             static void unload_compiler_phases(void)
@@ -34,6 +34,7 @@
 #include "tl-tribool.hpp"
 
 #include <set>
+#include <tr1/unordered_set>
 #include <map>
 
 #define VERBOSE (debug_options.analysis_verbose || \
@@ -54,6 +55,9 @@ namespace Analysis {
     typedef std::pair<NBase, NBase> NodeclPair;
     typedef std::multimap<NBase, NodeclPair, Nodecl::Utils::Nodecl_structural_less> NodeclMap; 
     typedef std::map<Nodecl::NodeclBase, tribool, Nodecl::Utils::Nodecl_structural_less> NodeclTriboolMap;
+    // Like NodeclSet but unordered and with constant time lookups (see Nodecl::Utils::get_structural_id)
+    typedef std::tr1::unordered_set<NBase, Nodecl::Utils::Nodecl_structural_id_hash,
+            Nodecl::Utils::Nodecl_structural_id_equal> NodeclIdSet;
 
 namespace Utils {
 
@@ -872,7 +872,7 @@ namespace {
 
     void OldTaskDependencyGraph::store_condition_list_of_symbols(const NBase& condition, const NodeclMap& reach_defs)
     {
-        NodeclSet already_treated;
+        NodeclIdSet already_treated;
         NodeclList tmp = Nodecl::Utils::get_all_memory_accesses(condition);
         std::queue<NBase, std::deque<NBase> > vars(std::deque<NBase>(tmp.begin(), tmp.end()));
         while (!vars.empty())
@@ -891,7 +891,7 @@ namespace {
                             n.prettyprint().c_str());
             
             std::pair<NodeclMap::const_iterator, NodeclMap::const_iterator> reach_defs_map = reach_defs.equal_range(n);
-            NodeclSet to_treat;
+            NodeclIdSet to_treat;
             for(NodeclMap::const_iterator it = reach_defs_map.first; it != reach_defs_map.second; ++it)
             {
                 tmp = Nodecl::Utils::get_all_memory_accesses(it->second.first);
@@ -31,24 +31,52 @@
 namespace TL { namespace Checkpoint {
 
     Base::Base()
-        : PragmaCustomCompilerPhase()
+        : TraversalPhase()
     {
         set_phase_name("Checkpoint directives to IR");
         set_phase_description("This phase lowers our checkpoints directives into Mercurium's IR");
 
-        register_directive("chk", "store");
-        register_directive("chk", "load");
-        register_directive("chk", "init");
-        register_directive("chk", "shutdown");
-
-        dispatcher("chk").directive.post["store"].connect(
-                std::bind(&Base::store_directive_handler_post, this, std::placeholders::_1));
-        dispatcher("chk").directive.post["load"].connect(
-                std::bind(&Base::load_directive_handler_post, this, std::placeholders::_1));
-        dispatcher("chk").directive.post["init"].connect(
-                std::bind(&Base::init_directive_handler_post, this, std::placeholders::_1));
-        dispatcher("chk").directive.post["shutdown"].connect(
-                std::bind(&Base::shutdown_directive_handler_post, this, std::placeholders::_1));
+        register_new_directive(CURRENT_CONFIGURATION, "chk", "store", 0, 0);
+        register_new_directive(CURRENT_CONFIGURATION, "chk", "load", 0, 0);
+        register_new_directive(CURRENT_CONFIGURATION, "chk", "init", 0, 0);
+        register_new_directive(CURRENT_CONFIGURATION, "chk", "shutdown", 0, 0);
+
+        visit_kind(NODECL_PRAGMA_CUSTOM_DIRECTIVE);
+
+        read_kind(NODECL_PRAGMA_CUSTOM_LINE);
+        read_kind(NODECL_PRAGMA_CUSTOM_CLAUSE);
+        read_kind(NODECL_PRAGMA_CLAUSE_ARG);
+
+        replace_kind(NODECL_CHECKPOINT_STORE);
+        replace_kind(NODECL_CHECKPOINT_LOAD);
+        replace_kind(NODECL_CHECKPOINT_INIT);
+        replace_kind(NODECL_CHECKPOINT_SHUTDOWN);
+
+        // Besides these, the environment contains the arguments of the
+        // clauses parsed as expressions
+        write_kind(NODECL_CHECKPOINT_DATA);
+        write_kind(NODECL_CHECKPOINT_LEVEL);
+        write_kind(NODECL_CHECKPOINT_ID);
+        write_kind(NODECL_CHECKPOINT_KIND);
+        write_kind(NODECL_CHECKPOINT_IF);
+        write_kind(NODECL_CHECKPOINT_COMM);
+    }
+
+    void Base::transform(Nodecl::NodeclBase node)
+    {
+        TL::PragmaCustomDirective directive(node.as<Nodecl::PragmaCustomDirective>());
+        if (directive.get_text() != "chk")
+            return;
+
+        std::string directive_name = directive.get_pragma_line().get_text();
+        if (directive_name == "store")
+            store_directive_handler_post(directive);
+        else if (directive_name == "load")
+            load_directive_handler_post(directive);
+        else if (directive_name == "init")
+            init_directive_handler_post(directive);
+        else if (directive_name == "shutdown")
+            shutdown_directive_handler_post(directive);
     }
 
     void Base::store_directive_handler_post(TL::PragmaCustomDirective directive)
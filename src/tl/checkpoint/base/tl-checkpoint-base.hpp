@@ -28,17 +28,24 @@
 #define TL_CHECKPOINT_BASE_HPP
 
 #include "tl-pragmasupport.hpp"
+#include "tl-traversal-phase.hpp"
 
 namespace TL
 {
     namespace Checkpoint
     {
         //! This class transforms Checkpoint pragmas to the Nodecl representation of parallelism
-        class Base : public TL::PragmaCustomCompilerPhase
+        /*!
+         * Every chk directive is replaced by the checkpoint node that the
+         * checkpoint lowering visits, so both phases share a single walk
+         */
+        class Base : public TL::TraversalPhase
         {
             public:
                 Base();
 
+                virtual void transform(Nodecl::NodeclBase node);
+
                 void store_directive_handler_post(TL::PragmaCustomDirective);
                 void load_directive_handler_post(TL::PragmaCustomDirective);
                 void init_directive_handler_post(TL::PragmaCustomDirective);
@@ -61,9 +61,40 @@ namespace TL { namespace Checkpoint {
     {
         set_phase_name("Checkpoint lowering");
         set_phase_description("This phase lowers from Mercurium'c checkpoint IR into real code involving calls to TCL");
+
+        visit_kind(NODECL_CHECKPOINT_INIT);
+        visit_kind(NODECL_CHECKPOINT_SHUTDOWN);
+        visit_kind(NODECL_CHECKPOINT_LOAD);
+        visit_kind(NODECL_CHECKPOINT_STORE);
+
+        read_kind(NODECL_CHECKPOINT_DATA);
+        read_kind(NODECL_CHECKPOINT_LEVEL);
+        read_kind(NODECL_CHECKPOINT_ID);
+        read_kind(NODECL_CHECKPOINT_COMM);
+        read_kind(NODECL_CHECKPOINT_IF);
+        read_kind(NODECL_CHECKPOINT_KIND);
+
+        // Besides these, the calls to TCL only contain copies of the
+        // expressions of the environment, which have already been visited
+        write_kind(NODECL_EXPRESSION_STATEMENT);
+        write_kind(NODECL_FUNCTION_CALL);
+        write_kind(NODECL_FORTRAN_ACTUAL_ARGUMENT);
+        write_kind(NODECL_SYMBOL);
+        write_kind(NODECL_INTEGER_LITERAL);
+        write_kind(NODECL_CONVERSION);
+        write_kind(NODECL_REFERENCE);
+        write_kind(NODECL_PARENTHESIZED_EXPRESSION);
+        write_kind(NODECL_ADD);
+        write_kind(NODECL_MINUS);
+        write_kind(NODECL_MUL);
+        write_kind(NODECL_SIZEOF);
+        write_kind(NODECL_TYPE);
+        write_kind(NODECL_IF_ELSE_STATEMENT);
+        write_kind(NODECL_CONTEXT);
+        write_kind(NODECL_COMPOUND_STATEMENT);
     }
 
-    void LoweringPhase::run(DTO& dto)
+    void LoweringPhase::pre_traversal(DTO& dto)
     {
         Nodecl::NodeclBase translation_unit =
             *std::static_pointer_cast<Nodecl::NodeclBase>(dto["nodecl"]);
@@ -90,9 +121,12 @@ namespace TL { namespace Checkpoint {
         {
            fortran_fixup_api(_tcl_max_dims);
         }
+    }
 
+    void LoweringPhase::transform(Nodecl::NodeclBase node)
+    {
         CheckpointVisitor visitor(this);
-        visitor.walk(translation_unit);
+        visitor.walk(node);
     }
 
     int LoweringPhase::get_tcl_max_dims() const
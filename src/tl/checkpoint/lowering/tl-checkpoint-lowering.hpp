@@ -27,19 +27,20 @@
 #ifndef TL_CHECKPOINT_LOWERING_HPP
 #define TL_CHECKPOINT_LOWERING_HPP
 
-#include "tl-compilerphase.hpp"
+#include "tl-traversal-phase.hpp"
 #include "tl-nodecl.hpp"
 
 namespace TL { namespace Checkpoint {
 
-    class LoweringPhase : public TL::CompilerPhase
+    class LoweringPhase : public TL::TraversalPhase
     {
         private:
             int _tcl_max_dims;
 
         public:
             LoweringPhase();
-            virtual void run(DTO& dto);
+            virtual void pre_traversal(DTO& dto);
+            virtual void transform(Nodecl::NodeclBase node);
 
             int get_tcl_max_dims() const;
     };
@@ -27,6 +27,9 @@
 #include"tl-omp-lowering-atomics.hpp"
 #include"tl-nodecl-utils.hpp"
 #include"tl-counters.hpp"
+#include"tl-nodecl-builder.hpp"
+
+#include <sstream>
 
 namespace TL { namespace OpenMP { namespace Lowering {
 
@@ -374,7 +377,10 @@ namespace TL { namespace OpenMP { namespace Lowering {
     Nodecl::NodeclBase builtin_atomic_int_op(Nodecl::NodeclBase expr)
     {
         node_t op_kind = expr.get_kind();
-        Source critical_source;
+        // The size specific builtin is checked like it would be if the call
+        // had been parsed, including overload resolution in C++
+        Nodecl::Builder builder(expr.retrieve_context(), expr);
+        Nodecl::NodeclBase atomic_call;
         if (op_kind == NODECL_PREINCREMENT  // ++x
                 || op_kind == NODECL_POSTINCREMENT // x++
                 || op_kind == NODECL_PREDECREMENT // --x
@@ -402,11 +408,15 @@ namespace TL { namespace OpenMP { namespace Lowering {
                     internal_error("Code unreachable", 0);
             }
 
-            Source op_size;
-            op_size << expr.as<Nodecl::Preincrement>().get_rhs().get_type().no_ref().get_size();
+            Nodecl::NodeclBase op = expr.as<Nodecl::Preincrement>().get_rhs();
+
+            std::stringstream function_name;
+            function_name << intrinsic_function_name << "_" << op.get_type().no_ref().get_size();
 
-            critical_source << intrinsic_function_name << "_" << op_size << "(&(" << as_expression(expr.as<Nodecl::Preincrement>().get_rhs()) << "), 1);"
-                ;
+            atomic_call = builder.call(function_name.str(),
+                    TL::ObjectList<Nodecl::NodeclBase>()
+                    .append(builder.address_of(op.shallow_copy()))
+                    .append(builder.integer(1)));
         }
         // No need to check the other case as allowed_expression_atomic
         // already did this for us
@@ -468,18 +478,18 @@ namespace TL { namespace OpenMP { namespace Lowering {
                     internal_error("Code unreachable", 0);
             }
 
-            Source op_size;
-            op_size << expr.as<Nodecl::AddAssignment>().get_rhs().get_type().no_ref().get_size();
+            Nodecl::NodeclBase lhs = expr.as<Nodecl::AddAssignment>().get_lhs();
+            Nodecl::NodeclBase rhs = expr.as<Nodecl::AddAssignment>().get_rhs();
 
-            critical_source
-                << "{"
-                << as_type(expr.as<Nodecl::AddAssignment>().get_rhs().get_type()) << "__tmp = "
-                << as_expression(expr.as<Nodecl::AddAssignment>().get_rhs()) << ";"
-                << intrinsic_function_name << "_" << op_size << "(&(" << as_expression(expr.as<Nodecl::AddAssignment>().get_lhs()) << "), __tmp);"
-                << "}"
-                ;
+            std::stringstream function_name;
+            function_name << intrinsic_function_name << "_" << rhs.get_type().no_ref().get_size();
+
+            atomic_call = builder.call(function_name.str(),
+                    TL::ObjectList<Nodecl::NodeclBase>()
+                    .append(builder.address_of(lhs.shallow_copy()))
+                    .append(rhs.shallow_copy()));
         }
 
-        return critical_source.parse_statement(expr);
+        return builder.expression_statement(atomic_call);
     }
 }}}
@@ -39,6 +39,7 @@
 #include "tl-nodecl-visitor.hpp"
 #include "tl-nodecl-utils.hpp"
 #include "tl-nodecl-utils-fortran.hpp"
+#include "tl-nodecl-builder.hpp"
 #include "tl-symbol-utils.hpp"
 #include "tl-counters.hpp"
 
@@ -1709,6 +1710,7 @@ void TaskProperties::create_task_implementations_info(
                 TL::Symbol induction_variable,
                 TL::Scope scope,
                 bool define_induction_variable,
+                const locus_t* locus,
                 Nodecl::Utils::SimpleSymbolMap &symbol_map,
                 Nodecl::NodeclBase &extra_stmts)
         {
@@ -1793,16 +1795,13 @@ void TaskProperties::create_task_implementations_info(
                     symbol_map.add_map(induction_variable, new_ind_var);
                 }
 
-                Nodecl::NodeclBase cond =
-                    Nodecl::LowerThan::make(
-                            induction_variable.make_nodecl(/* set_ref_type */ true),
-                            upper_bound_sym.make_nodecl(/* set_ref_type */ true),
-                            induction_variable.get_type());
+                Nodecl::Builder builder(scope, locus);
+                Nodecl::NodeclBase cond = builder.lower_than(
+                        builder.symbol(induction_variable),
+                        builder.symbol(upper_bound_sym));
 
-                Nodecl::NodeclBase step =
-                    Nodecl::Preincrement::make(
-                            induction_variable.make_nodecl(/*set_ref_type*/ true),
-                            induction_variable.get_type());
+                Nodecl::NodeclBase step = builder.preincrement(
+                        builder.symbol(induction_variable));
 
                 loop_control = Nodecl::LoopControl::make(Nodecl::List::make(init), cond, step);
             }
@@ -2881,6 +2880,7 @@ void TaskProperties::create_task_implementations_info(
                         ind_var,
                         unpacked_fun_inside_scope,
                         for_stmt.induction_variable_in_separate_scope(),
+                        for_stmt.get_locus(),
                         symbol_map,
                         unpacked_fun_empty_stmt));
         }
@@ -32,6 +32,7 @@
 
 #include "tl-omp-core.hpp"
 #include "tl-omp-lowering-utils.hpp"
+#include "tl-nodecl-utils.hpp"
 
 #include "tl-compilerpipeline.hpp"
 #include "tl-omp-lowering-final-stmts-generator.hpp"
@@ -97,11 +98,12 @@ namespace TL { namespace Nanos6 {
 
         TL::OpenMP::Lowering::FinalStmtsGenerator final_generator(/* ompss_mode */ true, "nanos6_in_final");
         // If the final clause transformation is disabled we shouldn't generate the final stmts
+        // Both visitors only act on OpenMP and OmpSs constructs
         if (!_final_clause_transformation_disabled)
-            final_generator.walk(translation_unit);
+            Nodecl::Utils::walk_constructs(final_generator, translation_unit);
 
         Lower lower(this, final_generator.get_final_stmts());
-        lower.walk(translation_unit);
+        Nodecl::Utils::walk_constructs(lower, translation_unit);
     }
 
     void LoweringPhase::pre_run(DTO& dto)
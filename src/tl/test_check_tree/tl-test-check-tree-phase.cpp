@@ -0,0 +1,72 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#include "tl-test-check-tree-phase.hpp"
+#include "tl-nodecl.hpp"
+#include "cxx-cexpr.h"
+#include "cxx-utils.h"
+
+namespace TL
+{
+    TestCheckTreePhase::TestCheckTreePhase()
+    {
+        set_phase_name("Phase for testing --check-tree");
+        set_phase_description("This phase renders the tree invalid on purpose");
+
+        register_parameter("check_tree_test_edit",
+                "Wrong edit done to return statements: 'reuse' or 'replace'",
+                _edit,
+                "reuse");
+
+        visit_kind(NODECL_RETURN_STATEMENT);
+        write_kind(NODECL_EXPRESSION_STATEMENT);
+        write_kind(NODECL_INTEGER_LITERAL);
+    }
+
+    void TestCheckTreePhase::transform(Nodecl::NodeclBase node)
+    {
+        if (_edit == "reuse")
+        {
+            Nodecl::NodeclBase value = node.as<Nodecl::ReturnStatement>().get_value();
+            if (!value.is_null())
+            {
+                // The result is discarded, value should have been copied
+                Nodecl::ExpressionStatement::make(value);
+            }
+        }
+        else if (_edit == "replace")
+        {
+            node.replace(const_value_to_nodecl(const_value_get_signed_int(0)));
+        }
+        else
+        {
+            fatal_error("Invalid value '%s' for 'check_tree_test_edit'\n", _edit.c_str());
+        }
+    }
+}
+
+EXPORT_PHASE(TL::TestCheckTreePhase);
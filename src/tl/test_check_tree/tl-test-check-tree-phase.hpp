@@ -0,0 +1,54 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#ifndef TL_TEST_CHECK_TREE_PHASE_HPP
+#define TL_TEST_CHECK_TREE_PHASE_HPP
+
+#include "tl-traversal-phase.hpp"
+
+namespace TL
+{
+    //! Phase that breaks the tree on purpose to test --check-tree
+    /*!
+     * Variable check_tree_test_edit selects the wrong edit done to every
+     * return statement:
+     *  - reuse: its value is used in a new node without being copied, so
+     *    the return statement is no longer the parent of its own child
+     *  - replace: it is replaced by an integer literal, which is not a
+     *    statement
+     */
+    class TestCheckTreePhase : public TL::TraversalPhase
+    {
+        private:
+            std::string _edit;
+        public:
+            TestCheckTreePhase();
+            virtual void transform(Nodecl::NodeclBase node);
+    };
+}
+
+#endif // TL_TEST_CHECK_TREE_PHASE_HPP
@@ -0,0 +1,202 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#include "tl-test-nodecl-builder-phase.hpp"
+#include "tl-nodecl-builder.hpp"
+#include "cxx-diagnostic.h"
+#include "cxx-driver.h"
+
+namespace TL
+{
+    TestNodeclBuilderPhase::TestNodeclBuilderPhase()
+    {
+        set_phase_name("Phase for testing Nodecl::Builder");
+        set_phase_description("This phase checks that Nodecl::Builder computes the types of the parsed expressions");
+    }
+
+    namespace
+    {
+        bool is_binary_operation(node_t kind)
+        {
+            switch (kind)
+            {
+                case NODECL_ADD:
+                case NODECL_MINUS:
+                case NODECL_MUL:
+                case NODECL_DIV:
+                case NODECL_MOD:
+                case NODECL_LOWER_THAN:
+                case NODECL_GREATER_THAN:
+                case NODECL_EQUAL:
+                case NODECL_DIFFERENT:
+                case NODECL_BITWISE_AND:
+                case NODECL_BITWISE_OR:
+                case NODECL_LOGICAL_AND:
+                case NODECL_ASSIGNMENT:
+                case NODECL_ADD_ASSIGNMENT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_unary_operation(node_t kind)
+        {
+            switch (kind)
+            {
+                case NODECL_DEREFERENCE:
+                case NODECL_REFERENCE:
+                case NODECL_NEG:
+                case NODECL_LOGICAL_NOT:
+                case NODECL_BITWISE_NOT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // The operand as it was before the frontend converted it
+        Nodecl::NodeclBase unconverted(Nodecl::NodeclBase n)
+        {
+            if (n.is<Nodecl::Conversion>())
+                n = n.as<Nodecl::Conversion>().get_nest();
+            return n.shallow_copy();
+        }
+
+        // Returns a null tree if n is not built by the test
+        Nodecl::NodeclBase rebuild(Nodecl::NodeclBase n)
+        {
+            if (n.is_type_dependent()
+                    || n.is_value_dependent())
+                return Nodecl::NodeclBase::null();
+
+            Nodecl::Builder builder(n.retrieve_context(), n);
+            node_t kind = n.get_kind();
+            if (is_binary_operation(kind))
+            {
+                return builder.binary(kind,
+                        unconverted(n.children()[0]),
+                        unconverted(n.children()[1]));
+            }
+            else if (is_unary_operation(kind))
+            {
+                return builder.unary(kind, unconverted(n.children()[0]));
+            }
+            else if (n.is<Nodecl::ArraySubscript>())
+            {
+                Nodecl::List subscripts = n.as<Nodecl::ArraySubscript>().get_subscripts().as<Nodecl::List>();
+                if (subscripts.size() != 1)
+                    return Nodecl::NodeclBase::null();
+
+                return builder.subscript(
+                        unconverted(n.as<Nodecl::ArraySubscript>().get_subscripted()),
+                        unconverted(subscripts[0]));
+            }
+            else if (n.is<Nodecl::FunctionCall>())
+            {
+                Nodecl::NodeclBase called = n.as<Nodecl::FunctionCall>().get_called();
+                TL::Symbol function = called.get_symbol();
+                if (!called.is<Nodecl::Symbol>()
+                        || !function.is_function()
+                        || function.is_member()
+                        || function.is_builtin())
+                    return Nodecl::NodeclBase::null();
+
+                // Default arguments are not part of the parsed call
+                TL::ObjectList<Nodecl::NodeclBase> arguments;
+                Nodecl::List parsed_arguments = n.as<Nodecl::FunctionCall>().get_arguments().as<Nodecl::List>();
+                if ((int)parsed_arguments.size() != (int)function.get_type().parameters().size())
+                    return Nodecl::NodeclBase::null();
+
+                for (Nodecl::List::iterator it = parsed_arguments.begin();
+                        it != parsed_arguments.end();
+                        it++)
+                {
+                    arguments.append(unconverted(*it));
+                }
+
+                return builder.call(function.get_name(), arguments);
+            }
+
+            return Nodecl::NodeclBase::null();
+        }
+
+        void check_nodes(Nodecl::NodeclBase n, int& num_rebuilt)
+        {
+            if (n.is_null()
+                    || n.is<Nodecl::TemplateFunctionCode>())
+                return;
+
+            Nodecl::NodeclBase::Children children = n.children();
+            for (Nodecl::NodeclBase::Children::iterator it = children.begin();
+                    it != children.end();
+                    it++)
+            {
+                check_nodes(*it, num_rebuilt);
+            }
+
+            Nodecl::NodeclBase rebuilt = rebuild(n);
+            if (rebuilt.is_null())
+                return;
+
+            if (!rebuilt.get_type().is_same_type(n.get_type()))
+            {
+                error_printf_at(n.get_locus(),
+                        "type of '%s' is '%s' but Nodecl::Builder computed '%s'\n",
+                        n.prettyprint().c_str(),
+                        n.get_type().get_declaration(n.retrieve_context(), "").c_str(),
+                        rebuilt.get_type().get_declaration(n.retrieve_context(), "").c_str());
+            }
+            else if (n.is_constant() != rebuilt.is_constant())
+            {
+                error_printf_at(n.get_locus(),
+                        "'%s' is %sconstant but Nodecl::Builder built a %sconstant expression\n",
+                        n.prettyprint().c_str(),
+                        n.is_constant() ? "" : "not ",
+                        rebuilt.is_constant() ? "" : "non-");
+            }
+            num_rebuilt++;
+
+            nodecl_free(rebuilt.get_internal_nodecl());
+        }
+    }
+
+    void TestNodeclBuilderPhase::run(TL::DTO& dto)
+    {
+        Nodecl::NodeclBase top_level = *std::static_pointer_cast<Nodecl::NodeclBase>(dto["nodecl"]);
+
+        int num_rebuilt = 0;
+        check_nodes(top_level, num_rebuilt);
+
+        if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "Built %d expressions again with Nodecl::Builder\n", num_rebuilt);
+        }
+    }
+}
+
+EXPORT_PHASE(TL::TestNodeclBuilderPhase);
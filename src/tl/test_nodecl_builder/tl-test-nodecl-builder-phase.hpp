@@ -0,0 +1,51 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#ifndef TL_TEST_NODECL_BUILDER_PHASE_HPP
+#define TL_TEST_NODECL_BUILDER_PHASE_HPP
+
+#include "tl-compilerphase.hpp"
+
+namespace TL
+{
+    //! Phase that checks the types computed by Nodecl::Builder
+    /*!
+     * Operators, array subscripts and direct calls to non-member functions
+     * of the translation unit are built again with Nodecl::Builder from
+     * their operands, without the implicit conversions the frontend added to
+     * them. The type of the new expression must be the type of the parsed
+     * one. Mismatches are reported as errors
+     */
+    class TestNodeclBuilderPhase : public TL::CompilerPhase
+    {
+        public:
+            TestNodeclBuilderPhase();
+            virtual void run(TL::DTO& dto);
+    };
+}
+
+#endif // TL_TEST_NODECL_BUILDER_PHASE_HPP
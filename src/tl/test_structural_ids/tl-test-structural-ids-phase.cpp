@@ -0,0 +1,105 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#include "tl-test-structural-ids-phase.hpp"
+#include "tl-nodecl-utils.hpp"
+#include "cxx-diagnostic.h"
+#include "cxx-driver.h"
+
+namespace TL
+{
+    TestStructuralIdsPhase::TestStructuralIdsPhase()
+    {
+        set_phase_name("Phase for testing structural ids");
+        set_phase_description("This phase checks that structural ids agree with Nodecl_structural_less");
+    }
+
+    namespace
+    {
+        void collect_nodes(Nodecl::NodeclBase n, TL::ObjectList<Nodecl::NodeclBase>& nodes)
+        {
+            if (n.is_null())
+                return;
+
+            nodes.append(n);
+
+            Nodecl::NodeclBase::Children children = n.children();
+            for (Nodecl::NodeclBase::Children::iterator it = children.begin();
+                    it != children.end();
+                    it++)
+            {
+                collect_nodes(*it, nodes);
+            }
+        }
+    }
+
+    void TestStructuralIdsPhase::run(TL::DTO& dto)
+    {
+        Nodecl::NodeclBase top_level = *std::static_pointer_cast<Nodecl::NodeclBase>(dto["nodecl"]);
+
+        TL::ObjectList<Nodecl::NodeclBase> nodes;
+        collect_nodes(top_level, nodes);
+
+        Nodecl::Utils::Nodecl_structural_less less;
+        int num_equivalent_pairs = 0;
+        for (TL::ObjectList<Nodecl::NodeclBase>::iterator it = nodes.begin();
+                it != nodes.end();
+                it++)
+        {
+            for (TL::ObjectList<Nodecl::NodeclBase>::iterator it2 = it + 1;
+                    it2 != nodes.end();
+                    it2++)
+            {
+                bool equivalent = !less(*it, *it2) && !less(*it2, *it);
+                bool same_id = Nodecl::Utils::get_structural_id(*it)
+                    == Nodecl::Utils::get_structural_id(*it2);
+
+                if (equivalent != same_id)
+                {
+                    error_printf_at(it->get_locus(),
+                            "structural ids of '%s' and '%s' are %s but the trees are %s\n",
+                            it->prettyprint().c_str(),
+                            it2->prettyprint().c_str(),
+                            same_id ? "equal" : "different",
+                            equivalent ? "equivalent" : "not equivalent");
+                }
+                else if (equivalent)
+                {
+                    num_equivalent_pairs++;
+                }
+            }
+        }
+
+        if (CURRENT_CONFIGURATION->verbose)
+        {
+            fprintf(stderr, "Checked the structural ids of %d nodes, %d pairs are equivalent\n",
+                    (int)nodes.size(), num_equivalent_pairs);
+        }
+    }
+}
+
+EXPORT_PHASE(TL::TestStructuralIdsPhase);
@@ -0,0 +1,49 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2015 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+#ifndef TL_TEST_STRUCTURAL_IDS_PHASE_HPP
+#define TL_TEST_STRUCTURAL_IDS_PHASE_HPP
+
+#include "tl-compilerphase.hpp"
+
+namespace TL
+{
+    //! Phase that checks Nodecl::Utils::get_structural_id
+    /*!
+     * Every pair of nodes of the translation unit must have the same
+     * structural id if and only if Nodecl_structural_less considers them
+     * equivalent. Mismatches are reported as errors
+     */
+    class TestStructuralIdsPhase : public TL::CompilerPhase
+    {
+        public:
+            TestStructuralIdsPhase();
+            virtual void run(TL::DTO& dto);
+    };
+}
+
+#endif // TL_TEST_STRUCTURAL_IDS_PHASE_HPP
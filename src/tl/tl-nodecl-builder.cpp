@@ -0,0 +1,211 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#include "tl-nodecl-builder.hpp"
+#include "cxx-exprtype.h"
+#include "cxx-cexpr.h"
+#include "cxx-utils.h"
+
+namespace Nodecl {
+
+    Builder::Builder(TL::Scope sc, const locus_t* locus)
+        : _sc(sc), _locus(locus)
+    {
+        ERROR_CONDITION(IS_FORTRAN_LANGUAGE,
+                "The nodecl builder is only available for C/C++", 0);
+        ERROR_CONDITION(_locus == NULL, "Invalid locus", 0);
+    }
+
+    Builder::Builder(TL::Scope sc, NodeclBase replaced)
+        : _sc(sc), _locus(replaced.get_locus())
+    {
+        ERROR_CONDITION(IS_FORTRAN_LANGUAGE,
+                "The nodecl builder is only available for C/C++", 0);
+        ERROR_CONDITION(_locus == NULL, "Invalid locus", 0);
+    }
+
+    NodeclBase Builder::checked(nodecl_t n, const char* what) const
+    {
+        if (nodecl_is_err_expr(n))
+        {
+            internal_error("%s: could not build %s\n", locus_to_str(_locus), what);
+        }
+        return n;
+    }
+
+    NodeclBase Builder::symbol(TL::Symbol sym) const
+    {
+        return sym.make_nodecl(/* set_ref_type */ true, _locus);
+    }
+
+    NodeclBase Builder::name(const std::string& name) const
+    {
+        return checked(
+                cxx_nodecl_make_id_expression(name.c_str(),
+                    _sc.get_decl_context(),
+                    _locus),
+                "name");
+    }
+
+    NodeclBase Builder::integer(int value) const
+    {
+        NodeclBase n = const_value_to_nodecl(const_value_get_signed_int(value));
+        n.set_locus(_locus);
+        return n;
+    }
+
+    NodeclBase Builder::unary(node_t kind, NodeclBase op) const
+    {
+        return checked(
+                cxx_nodecl_make_unary_operation(kind,
+                    op.get_internal_nodecl(),
+                    _sc.get_decl_context(),
+                    _locus),
+                "unary operation");
+    }
+
+    NodeclBase Builder::binary(node_t kind, NodeclBase lhs, NodeclBase rhs) const
+    {
+        return checked(
+                cxx_nodecl_make_binary_operation(kind,
+                    lhs.get_internal_nodecl(),
+                    rhs.get_internal_nodecl(),
+                    _sc.get_decl_context(),
+                    _locus),
+                "binary operation");
+    }
+
+    NodeclBase Builder::assign(NodeclBase lhs, NodeclBase rhs) const
+    {
+        return binary(NODECL_ASSIGNMENT, lhs, rhs);
+    }
+
+    NodeclBase Builder::add(NodeclBase lhs, NodeclBase rhs) const
+    {
+        return binary(NODECL_ADD, lhs, rhs);
+    }
+
+    NodeclBase Builder::sub(NodeclBase lhs, NodeclBase rhs) const
+    {
+        return binary(NODECL_MINUS, lhs, rhs);
+    }
+
+    NodeclBase Builder::mul(NodeclBase lhs, NodeclBase rhs) const
+    {
+        return binary(NODECL_MUL, lhs, rhs);
+    }
+
+    NodeclBase Builder::lower_than(NodeclBase lhs, NodeclBase rhs) const
+    {
+        return binary(NODECL_LOWER_THAN, lhs, rhs);
+    }
+
+    NodeclBase Builder::preincrement(NodeclBase op) const
+    {
+        return unary(NODECL_PREINCREMENT, op);
+    }
+
+    NodeclBase Builder::dereference(NodeclBase op) const
+    {
+        return unary(NODECL_DEREFERENCE, op);
+    }
+
+    NodeclBase Builder::address_of(NodeclBase op) const
+    {
+        return unary(NODECL_REFERENCE, op);
+    }
+
+    NodeclBase Builder::member(NodeclBase obj, const std::string& name) const
+    {
+        return checked(
+                cxx_nodecl_make_member_access(obj.get_internal_nodecl(),
+                    uniquestr(name.c_str()),
+                    /* is_arrow */ 0,
+                    _sc.get_decl_context(),
+                    _locus),
+                "member access");
+    }
+
+    NodeclBase Builder::arrow(NodeclBase ptr, const std::string& name) const
+    {
+        return checked(
+                cxx_nodecl_make_member_access(ptr.get_internal_nodecl(),
+                    uniquestr(name.c_str()),
+                    /* is_arrow */ 1,
+                    _sc.get_decl_context(),
+                    _locus),
+                "member access");
+    }
+
+    NodeclBase Builder::subscript(NodeclBase subscripted, NodeclBase subscript) const
+    {
+        return checked(
+                cxx_nodecl_make_array_subscript(subscripted.get_internal_nodecl(),
+                    subscript.get_internal_nodecl(),
+                    _sc.get_decl_context()),
+                "array subscript");
+    }
+
+    NodeclBase Builder::cast(NodeclBase expr, TL::Type dest_type,
+            const std::string& cast_kind) const
+    {
+        return checked(
+                cxx_nodecl_make_cast(expr.get_internal_nodecl(),
+                    dest_type.get_internal_type(),
+                    uniquestr(cast_kind.c_str()),
+                    _sc.get_decl_context(),
+                    _locus),
+                "cast");
+    }
+
+    NodeclBase Builder::call(NodeclBase called,
+            const TL::ObjectList<NodeclBase>& arguments) const
+    {
+        return checked(
+                cxx_nodecl_make_checked_function_call(called.get_internal_nodecl(),
+                    Nodecl::List::make(arguments).get_internal_nodecl(),
+                    _sc.get_decl_context()),
+                "function call");
+    }
+
+    NodeclBase Builder::call(TL::Symbol function,
+            const TL::ObjectList<NodeclBase>& arguments) const
+    {
+        return call(function.make_nodecl(/* set_ref_type */ true, _locus), arguments);
+    }
+
+    NodeclBase Builder::call(const std::string& function_name,
+            const TL::ObjectList<NodeclBase>& arguments) const
+    {
+        return call(name(function_name), arguments);
+    }
+
+    NodeclBase Builder::expression_statement(NodeclBase expr) const
+    {
+        return Nodecl::ExpressionStatement::make(expr, _locus);
+    }
+
+}
@@ -0,0 +1,113 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#ifndef TL_NODECL_BUILDER_HPP
+#define TL_NODECL_BUILDER_HPP
+
+#include "tl-nodecl.hpp"
+#include "tl-scope.hpp"
+#include "tl-symbol.hpp"
+#include "tl-type.hpp"
+#include "tl-objectlist.hpp"
+
+#include <string>
+
+namespace Nodecl {
+
+    //! Builds checked C/C++ expressions without going through TL::Source
+    /*!
+     * Unlike the generated Nodecl::*::make functions, which take the type of
+     * the node as a parameter, the type (and the conversions, overload
+     * resolution and constant value) of every expression is computed by the
+     * frontend as if the equivalent code had been parsed in the scope of the
+     * builder. Operands must be already checked expressions.
+     *
+     * An expression the frontend rejects is a bug in the phase, so the
+     * builder emits the frontend diagnostic and stops.
+     *
+     * Every node built gets the locus of the builder, either given
+     * explicitly or taken from the node the built code replaces.
+     */
+    class Builder
+    {
+        private:
+            TL::Scope _sc;
+            const locus_t* _locus;
+
+            NodeclBase checked(nodecl_t n, const char* what) const;
+        public:
+            Builder(TL::Scope sc, const locus_t* locus);
+            //! Uses the locus of the node that the built code replaces
+            Builder(TL::Scope sc, NodeclBase replaced);
+
+            TL::Scope get_scope() const { return _sc; }
+
+            //! Lvalue that names sym
+            NodeclBase symbol(TL::Symbol sym) const;
+            //! Looks up name in the scope of the builder, like an
+            //! id-expression. In C++ overloaded functions are resolved when
+            //! the result is called
+            NodeclBase name(const std::string& name) const;
+            //! Signed int literal
+            NodeclBase integer(int value) const;
+
+            //! kind is a NODECL_* unary operator, e.g. NODECL_PREINCREMENT
+            NodeclBase unary(node_t kind, NodeclBase op) const;
+            //! kind is a NODECL_* binary operator, e.g. NODECL_ADD
+            NodeclBase binary(node_t kind, NodeclBase lhs, NodeclBase rhs) const;
+
+            NodeclBase assign(NodeclBase lhs, NodeclBase rhs) const;
+            NodeclBase add(NodeclBase lhs, NodeclBase rhs) const;
+            NodeclBase sub(NodeclBase lhs, NodeclBase rhs) const;
+            NodeclBase mul(NodeclBase lhs, NodeclBase rhs) const;
+            NodeclBase lower_than(NodeclBase lhs, NodeclBase rhs) const;
+            NodeclBase preincrement(NodeclBase op) const;
+            NodeclBase dereference(NodeclBase op) const;
+            NodeclBase address_of(NodeclBase op) const;
+
+            //! obj.name
+            NodeclBase member(NodeclBase obj, const std::string& name) const;
+            //! ptr->name
+            NodeclBase arrow(NodeclBase ptr, const std::string& name) const;
+            //! subscripted[subscript]
+            NodeclBase subscript(NodeclBase subscripted, NodeclBase subscript) const;
+            //! cast_kind is "C", "static_cast", "reinterpret_cast", ...
+            NodeclBase cast(NodeclBase expr, TL::Type dest_type,
+                    const std::string& cast_kind = "C") const;
+
+            NodeclBase call(NodeclBase called,
+                    const TL::ObjectList<NodeclBase>& arguments) const;
+            NodeclBase call(TL::Symbol function,
+                    const TL::ObjectList<NodeclBase>& arguments) const;
+            NodeclBase call(const std::string& function_name,
+                    const TL::ObjectList<NodeclBase>& arguments) const;
+
+            NodeclBase expression_statement(NodeclBase expr) const;
+    };
+
+}
+
+#endif // TL_NODECL_BUILDER_HPP
@@ -813,6 +813,130 @@ namespace Nodecl
         return structurally_less_nodecls(n1, n2, /*skip_conversion_nodes*/true);
     }
 
+    namespace
+    {
+        // A node reduced to what cmp_trees_rec compares: the ids of its
+        // children stand for the children themselves
+        struct StructuralShape
+        {
+            node_t kind;
+            scope_entry_t* symbol;
+            const_value_t* constant;
+            Utils::structural_id_t children[MCXX_MAX_AST_CHILDREN];
+
+            bool operator==(const StructuralShape& s) const
+            {
+                return kind == s.kind
+                    && symbol == s.symbol
+                    && constant == s.constant
+                    && std::equal(children, children + MCXX_MAX_AST_CHILDREN, s.children);
+            }
+        };
+
+        struct StructuralShapeHash
+        {
+            size_t operator()(const StructuralShape& s) const
+            {
+                size_t h = (size_t)s.kind;
+                h = h * 31 + (size_t)s.symbol;
+                h = h * 31 + (size_t)s.constant;
+                for (int i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
+                    h = h * 31 + s.children[i];
+                return h;
+            }
+        };
+
+        typedef std::tr1::unordered_map<StructuralShape,
+                Utils::structural_id_t, StructuralShapeHash> structural_shape_ids_t;
+        // Only shrinks in clear_structural_ids, so ids remain stable during
+        // the compilation of a translation unit
+        structural_shape_ids_t _structural_shape_ids;
+
+        // Only meaningful for nodes with ast_get_structural_id_valid. Nodes
+        // marked as valid may be missing after clear_structural_ids
+        typedef std::tr1::unordered_map<AST, Utils::structural_id_t> structural_node_ids_t;
+        structural_node_ids_t _structural_node_ids;
+
+        Utils::structural_id_t structural_id_rec(nodecl_t n);
+
+        // Id of the shape of n itself, without skipping a conversion
+        Utils::structural_id_t structural_shape_id(nodecl_t n)
+        {
+            StructuralShape shape;
+            shape.kind = nodecl_get_kind(n);
+            shape.symbol = nodecl_get_symbol(n);
+            shape.constant = nodecl_get_constant(n);
+            // Like cmp_trees_rec
+            if (shape.constant != NULL
+                    && (const_value_is_object(shape.constant)
+                        || const_value_is_address(shape.constant)))
+                shape.constant = NULL;
+            for (int i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
+                shape.children[i] = structural_id_rec(nodecl_get_child(n, i));
+
+            // 0 is the id of the null tree
+            std::pair<structural_shape_ids_t::iterator, bool> it
+                = _structural_shape_ids.insert(
+                        std::make_pair(shape, _structural_shape_ids.size() + 1));
+            return it.first->second;
+        }
+
+        Utils::structural_id_t structural_id_rec(nodecl_t n)
+        {
+            if (nodecl_is_null(n))
+                return 0;
+
+            AST a = nodecl_get_ast(n);
+            if (ast_get_structural_id_valid(a))
+            {
+                structural_node_ids_t::iterator it = _structural_node_ids.find(a);
+                if (it != _structural_node_ids.end())
+                    return it->second;
+            }
+
+            // cmp_trees_rec skips one conversion when comparing
+            Utils::structural_id_t result;
+            nodecl_t converted = nodecl_get_child(n, 0);
+            if (nodecl_get_kind(n) == NODECL_CONVERSION
+                    && !nodecl_is_null(converted))
+            {
+                result = structural_id_rec(converted);
+                if (nodecl_get_kind(converted) == NODECL_CONVERSION)
+                    result = structural_shape_id(converted);
+            }
+            else
+            {
+                result = structural_shape_id(n);
+            }
+
+            _structural_node_ids[a] = result;
+            ast_set_structural_id_valid(a);
+
+            return result;
+        }
+    }
+
+    Utils::structural_id_t Utils::get_structural_id(Nodecl::NodeclBase n)
+    {
+        return structural_id_rec(n.get_internal_nodecl());
+    }
+
+    void Utils::clear_structural_ids()
+    {
+        _structural_node_ids.clear();
+        _structural_shape_ids.clear();
+    }
+
+    size_t Utils::Nodecl_structural_id_hash::operator() (const Nodecl::NodeclBase& n) const
+    {
+        return get_structural_id(n);
+    }
+
+    bool Utils::Nodecl_structural_id_equal::operator() (const Nodecl::NodeclBase& n1, const Nodecl::NodeclBase& n2) const
+    {
+        return get_structural_id(n1) == get_structural_id(n2);
+    }
+
     Nodecl::List Utils::get_all_list_from_list_node(Nodecl::List n)
     {
         while (n.get_parent().is<Nodecl::List>())
@@ -32,6 +32,7 @@
 #include "tl-source.hpp"
 
 #include "cxx-nodecl-deep-copy.h"
+#include "cxx-ast.h"
 
 #include <tr1/unordered_map>
 #include <functional>
@@ -88,6 +89,29 @@ namespace Utils {
         bool operator() (const Nodecl::NodeclBase& n1, const Nodecl::NodeclBase& n2) const;
     };
 
+    // Structural identity of trees
+    //
+    // Every distinct shape of tree gets a stable integer id: two trees have
+    // the same id if and only if Nodecl_structural_less considers them
+    // equivalent. Ids are memoized in the nodes and forgotten when a tree is
+    // modified, so once computed they are compared in constant time. A
+    // modification is only seen by the ancestors of the node along its
+    // parent pointers, so trees must not share nodes
+    typedef unsigned int structural_id_t;
+    structural_id_t get_structural_id(Nodecl::NodeclBase n);
+
+    // Forgets all the ids. Ids obtained before are not comparable with the
+    // ones obtained after. Called at the end of every translation unit
+    void clear_structural_ids();
+
+    struct Nodecl_structural_id_hash {
+        size_t operator() (const Nodecl::NodeclBase& n) const;
+    };
+
+    struct Nodecl_structural_id_equal {
+        bool operator() (const Nodecl::NodeclBase& n1, const Nodecl::NodeclBase& n2) const;
+    };
+
     // Basic replacement
     //
     // After this operation dest will be updated to have the same contents
@@ -162,6 +186,44 @@ namespace Utils {
         return n;
     }
 
+    // Walks with v the outermost pragma, OpenMP and OmpSs constructs of n,
+    // nested ones are left to v. Subtrees without any construct (see
+    // ast_has_construct_in_subtree) are skipped altogether, so this is only
+    // equivalent to v.walk(n) when v does nothing outside the constructs
+    template <typename Visitor>
+    void walk_constructs(Visitor& v, Nodecl::NodeclBase n)
+    {
+        if (n.is_null()
+                || !ast_has_construct_in_subtree(nodecl_get_ast(n.get_internal_nodecl())))
+            return;
+
+        if (ast_kind_is_construct(n.get_kind()))
+        {
+            v.walk(n);
+        }
+        else if (n.is<Nodecl::List>())
+        {
+            // Walking an element may add new ones around it
+            TL::ObjectList<Nodecl::NodeclBase> l = n.as<Nodecl::List>().to_object_list();
+            for (TL::ObjectList<Nodecl::NodeclBase>::iterator it = l.begin();
+                    it != l.end();
+                    it++)
+            {
+                walk_constructs(v, *it);
+            }
+        }
+        else
+        {
+            Nodecl::NodeclBase::Children children = n.children();
+            for (Nodecl::NodeclBase::Children::iterator it = children.begin();
+                    it != children.end();
+                    it++)
+            {
+                walk_constructs(v, *it);
+            }
+        }
+    }
+
     struct SymbolMap
     {
         private:
@@ -222,17 +284,17 @@ namespace Utils {
     struct SimpleSymbolMap : public SymbolMap
     {
         SimpleSymbolMap()
-            : _symbol_map(), _enclosing(NULL) { }
+            : _symbol_map(), _symbol_index(), _enclosing(NULL) { }
         explicit SimpleSymbolMap(SymbolMap* enclosing)
-            : _symbol_map(), _enclosing(enclosing) { }
+            : _symbol_map(), _symbol_index(), _enclosing(enclosing) { }
 
         virtual TL::Symbol map(TL::Symbol s)
         {
             if (!s.is_valid())
                 return s;
 
-            symbol_map_t::iterator it = _symbol_map.find(s);
-            if (it != _symbol_map.end())
+            symbol_index_t::iterator it = _symbol_index.find(s.get_internal_symbol());
+            if (it != _symbol_index.end())
                 return it->second;
             else if (_enclosing != NULL)
                 return _enclosing->map(s);
@@ -243,6 +305,7 @@ namespace Utils {
         virtual void add_map(TL::Symbol source, TL::Symbol target)
         {
             _symbol_map[source] = target;
+            _symbol_index[source.get_internal_symbol()] = target.get_internal_symbol();
         }
 
         const std::map<TL::Symbol, TL::Symbol>* get_simple_symbol_map() const
@@ -252,7 +315,11 @@ namespace Utils {
 
         private:
         typedef std::map<TL::Symbol, TL::Symbol> symbol_map_t;
+        // Ordered, for get_simple_symbol_map
         symbol_map_t _symbol_map;
+        // Hashed, for map which is called for every symbol of a deep copy
+        typedef std::tr1::unordered_map<scope_entry_t*, scope_entry_t*> symbol_index_t;
+        symbol_index_t _symbol_index;
         SymbolMap* _enclosing;
     };
 
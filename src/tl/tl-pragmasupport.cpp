@@ -143,7 +143,51 @@ namespace TL
     void PragmaCustomCompilerPhase::walk(Nodecl::NodeclBase& node)
     {
         PragmaVisitor visitor(_pragma_map_dispatcher, _ignore_template_functions);
-        visitor.walk(node);
+        visitor.walk_constructs(node);
+    }
+
+    void PragmaVisitor::walk_constructs(const Nodecl::NodeclBase& n)
+    {
+        if (n.is_null()
+                || !ast_has_construct_in_subtree(nodecl_get_ast(n.get_internal_nodecl())))
+            return;
+
+        if (n.is<Nodecl::TopLevel>())
+            nodecl_note_top_level_walk();
+
+        if (n.is<Nodecl::PragmaCustomDirective>()
+                || n.is<Nodecl::PragmaCustomStatement>()
+                || n.is<Nodecl::PragmaCustomDeclaration>())
+        {
+            // Nested constructs are handled by the regular visitor
+            this->walk(n);
+        }
+        else if (n.is<Nodecl::FunctionCode>()
+                && is_ignored_function(n.as<Nodecl::FunctionCode>()))
+        {
+            return;
+        }
+        else if (n.is<Nodecl::TemplateFunctionCode>()
+                && _ignore_template_functions)
+        {
+            return;
+        }
+        else if (n.is<Nodecl::List>())
+        {
+            AST tree = nodecl_get_ast(n.get_internal_nodecl());
+            AST it;
+            for_each_element(tree, it)
+            {
+                walk_constructs(Nodecl::NodeclBase(_nodecl_wrap(ASTSon1(it))));
+            }
+        }
+        else
+        {
+            for (int i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
+            {
+                walk_constructs(Nodecl::NodeclBase(nodecl_get_child(n.get_internal_nodecl(), i)));
+            }
+        }
     }
 
     void PragmaCustomCompilerPhase::register_directive(
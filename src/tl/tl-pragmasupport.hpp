@@ -413,6 +413,14 @@ namespace TL
             }
 
             bool _ignore_template_functions;
+
+            bool is_ignored_function(const Nodecl::FunctionCode& n) const
+            {
+                return IS_CXX_LANGUAGE
+                    && _ignore_template_functions
+                    && n.get_symbol().is_member()
+                    && n.get_symbol().get_class_type().is_dependent();
+            }
         public:
             PragmaVisitor(PragmaMapDispatcher & map_dispatcher,
                     bool ignore_template_functions)
@@ -420,6 +428,13 @@ namespace TL
                 _ignore_template_functions(ignore_template_functions)
             { }
 
+            //! Like walk but only visits the pragma constructs of the tree
+            /*!
+             * Subtrees that do not contain any construct (see
+             * ast_has_construct_in_subtree) are skipped altogether
+             */
+            void walk_constructs(const Nodecl::NodeclBase& n);
+
             virtual void visit_pre(const Nodecl::PragmaCustomDirective & n)
             {
                 std::string pragma_handled = n.get_text();
@@ -510,10 +525,7 @@ namespace TL
 
             virtual void visit(const Nodecl::FunctionCode& n)
             {
-                if (IS_CXX_LANGUAGE
-                        && _ignore_template_functions
-                        && n.get_symbol().is_member()
-                        && n.get_symbol().get_class_type().is_dependent())
+                if (is_ignored_function(n))
                     return;
 
                 this->Nodecl::ExhaustiveVisitor<void>::visit(n);
@@ -46,6 +46,9 @@
 #include <sstream>
 #include <iomanip>
 #include <cstring>
+#include <cctype>
+#include <map>
+#include <vector>
 
 namespace TL
 {
@@ -471,6 +474,208 @@ namespace TL
         CURRENT_CONFIGURATION->source_language = lang;
     }
 
+    namespace
+    {
+        // Trees parsed for previous fragments. Fragments that only differ in
+        // the pointers packed in them (see as_expression, as_symbol, as_type
+        // and statement_placeholder) share the same tree: in the key every
+        // distinct packed pointer is replaced by its ordinal
+        struct ParsedFragment
+        {
+            AST tree;
+            std::vector<std::string> packed_pointers;
+        };
+
+        typedef std::map<std::string, ParsedFragment> parsed_fragment_cache_t;
+        parsed_fragment_cache_t _parsed_fragment_cache;
+
+        // Cached trees must outlive the region of the current translation unit
+        ast_region_t* _parsed_fragment_region = NULL;
+
+        bool is_hexdigit(char c)
+        {
+            return ('0' <= c && c <= '9')
+                || ('a' <= c && c <= 'f')
+                || ('A' <= c && c <= 'F');
+        }
+
+        // Length of the packed pointer that starts at position i of str, zero
+        // if there is none. A packed pointer is either "prefix:0x1234" (or
+        // "prefix:(nil)") or @STATEMENT-PH::0x1234@
+        std::string::size_type packed_pointer_length(const std::string& str, std::string::size_type i)
+        {
+            std::string::size_type j = i;
+            if (str[j] == '"')
+            {
+                j++;
+                while (j < str.size()
+                        && (std::isalpha(str[j]) || str[j] == '_'))
+                    j++;
+                if (j == i + 1
+                        || j >= str.size()
+                        || str[j] != ':')
+                    return 0;
+                j++;
+                if (str.compare(j, 5, "(nil)") == 0)
+                {
+                    j += 5;
+                }
+                else
+                {
+                    if (str.compare(j, 2, "0x") != 0)
+                        return 0;
+                    j += 2;
+                    while (j < str.size() && is_hexdigit(str[j]))
+                        j++;
+                }
+                if (j >= str.size()
+                        || str[j] != '"')
+                    return 0;
+                return j + 1 - i;
+            }
+            else if (str.compare(j, 15, "@STATEMENT-PH::") == 0)
+            {
+                j += 15;
+                while (j < str.size() && str[j] != '@')
+                    j++;
+                if (j >= str.size())
+                    return 0;
+                return j + 1 - i;
+            }
+
+            return 0;
+        }
+
+        // Returns str with every packed pointer replaced by its ordinal, and
+        // the distinct packed pointers in packed_pointers
+        std::string normalize_fragment(const std::string& str,
+                std::vector<std::string>& packed_pointers)
+        {
+            std::string result;
+            result.reserve(str.size());
+
+            std::string::size_type i = 0;
+            while (i < str.size())
+            {
+                std::string::size_type length = packed_pointer_length(str, i);
+                if (length == 0)
+                {
+                    result += str[i];
+                    i++;
+                    continue;
+                }
+
+                std::string packed_pointer = str.substr(i, length);
+                std::vector<std::string>::size_type ordinal = 0;
+                while (ordinal < packed_pointers.size()
+                        && packed_pointers[ordinal] != packed_pointer)
+                    ordinal++;
+                if (ordinal == packed_pointers.size())
+                    packed_pointers.push_back(packed_pointer);
+
+                // A NUL character cannot appear in a source
+                std::stringstream ss;
+                ss << '\0' << ordinal << '\0';
+                result += ss.str();
+
+                i += length;
+            }
+
+            return result;
+        }
+
+        void replace_packed_pointers(AST a, const std::map<std::string, const char*>& replacements)
+        {
+            if (a == NULL)
+                return;
+
+            if (ASTText(a) != NULL)
+            {
+                std::map<std::string, const char*>::const_iterator it = replacements.find(ASTText(a));
+                if (it != replacements.end())
+                    ast_set_text(a, it->second);
+            }
+
+            if (ASTKind(a) == AST_AMBIGUITY)
+            {
+                for (int i = 0; i < ast_get_num_ambiguities(a); i++)
+                    replace_packed_pointers(ast_get_ambiguity(a, i), replacements);
+            }
+            else
+            {
+                for (int i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
+                    replace_packed_pointers(ast_get_child(a, i), replacements);
+            }
+        }
+
+        AST parse_fragment_cached(const std::string& mangled_text,
+                int (*prepare_lexer)(const char*),
+                int (*parse)(AST*),
+                const std::string& extended_source)
+        {
+            // Fortran lexing depends on the form of the source, do not cache it
+            bool cacheable = (CURRENT_CONFIGURATION->source_language != SOURCE_LANGUAGE_FORTRAN);
+
+            std::vector<std::string> packed_pointers;
+            std::string key;
+            if (cacheable)
+            {
+                std::stringstream ss;
+                ss << (void*)CURRENT_CONFIGURATION
+                    << ":" << (void*)parse
+                    << ":" << (int)CURRENT_CONFIGURATION->preserve_parentheses
+                    << ":" << normalize_fragment(mangled_text, packed_pointers);
+                key = ss.str();
+
+                parsed_fragment_cache_t::iterator it = _parsed_fragment_cache.find(key);
+                if (it != _parsed_fragment_cache.end())
+                {
+                    DEBUG_CODE()
+                    {
+                        std::cerr << "SOURCE: Reusing the tree of a previously parsed fragment" << std::endl;
+                    }
+                    std::map<std::string, const char*> replacements;
+                    for (std::vector<std::string>::size_type i = 0;
+                            i < packed_pointers.size();
+                            i++)
+                    {
+                        if (it->second.packed_pointers[i] != packed_pointers[i])
+                            replacements[it->second.packed_pointers[i]] = uniquestr(packed_pointers[i].c_str());
+                    }
+
+                    AST a = ast_copy(it->second.tree);
+                    replace_packed_pointers(a, replacements);
+                    return a;
+                }
+            }
+
+            prepare_lexer(mangled_text.c_str());
+
+            AST a = NULL;
+            int parse_result = parse(&a);
+
+            if (parse_result != 0)
+            {
+                fatal_error("Could not parse source\n\n%s\n",
+                        Source::format_source(extended_source).c_str());
+            }
+
+            if (cacheable)
+            {
+                if (_parsed_fragment_region == NULL)
+                    _parsed_fragment_region = ast_region_new();
+
+                ParsedFragment& fragment = _parsed_fragment_cache[key];
+                ast_region_push(_parsed_fragment_region);
+                fragment.tree = ast_copy(a);
+                ast_region_pop(_parsed_fragment_region);
+                fragment.packed_pointers = packed_pointers;
+            }
+
+            return a;
+        }
+    }
+
     Nodecl::NodeclBase Source::parse_common(ReferenceScope ref_scope,
             ParseFlags parse_flags,
             const std::string& subparsing_prefix,
@@ -487,18 +692,9 @@ namespace TL
 
         std::string mangled_text = subparsing_prefix + extended_source;
 
-        prepare_lexer(mangled_text.c_str());
-
-        int parse_result = 0;
-        AST a = NULL;
-
-        parse_result = parse(&a);
-
-        if (parse_result != 0)
-        {
-            fatal_error("Could not parse source\n\n%s\n", 
-                    format_source(extended_source).c_str());
-        }
+        // Only the parse is shared, semantic analysis depends on ref_scope
+        // and parse_flags
+        AST a = parse_fragment_cached(mangled_text, prepare_lexer, parse, extended_source);
 
         const decl_context_t* decl_context = decl_context_map_fun(ref_scope.get_scope().get_decl_context());
 
@@ -0,0 +1,134 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#include "tl-traversal-phase.hpp"
+#include "cxx-nodecl.h"
+#include "cxx-utils.h"
+
+namespace TL
+{
+    void TraversalPhase::visit_kind(node_t kind)
+    {
+        _visited_kinds.insert(kind);
+    }
+
+    void TraversalPhase::read_kind(node_t kind)
+    {
+        _read_kinds.insert(kind);
+    }
+
+    void TraversalPhase::write_kind(node_t kind)
+    {
+        _written_kinds.insert(kind);
+    }
+
+    void TraversalPhase::replace_kind(node_t kind)
+    {
+        _replaced_kinds.insert(kind);
+    }
+
+    bool TraversalPhase::visits_kind(node_t kind) const
+    {
+        return _visited_kinds.find(kind) != _visited_kinds.end();
+    }
+
+    bool TraversalPhase::intersects(const std::set<node_t>& s1, const std::set<node_t>& s2)
+    {
+        for (std::set<node_t>::const_iterator it = s1.begin();
+                it != s1.end();
+                it++)
+        {
+            if (s2.find(*it) != s2.end())
+                return true;
+        }
+        return false;
+    }
+
+    bool TraversalPhase::can_be_fused_with(const TraversalPhase& other) const
+    {
+        // The walk is post-order and both phases only rewrite the subtree of
+        // the node they visit, so when other is called at a node this phase
+        // has already been called for the whole subtree, as if it had run
+        // before. Two things differ from running them in sequence:
+        //  - other is not called for the nodes this phase creates below the
+        //    visited node (it is called for the node it replaces the visited
+        //    node with, though)
+        //  - this phase, at an ancestor, reads nodes that other has already
+        //    created
+        return !intersects(_written_kinds, other._visited_kinds)
+            && !intersects(other._written_kinds, _read_kinds)
+            && !intersects(other._replaced_kinds, _read_kinds);
+    }
+
+    namespace
+    {
+        void traverse_rec(nodecl_t n, const std::vector<TraversalPhase*>& phases)
+        {
+            if (nodecl_is_null(n))
+                return;
+
+            if (nodecl_is_list(n))
+            {
+                // Iterate lists so long lists do not nest the recursion
+                int num_items = 0;
+                nodecl_t* list = nodecl_unpack_list(n, &num_items);
+                for (int i = 0; i < num_items; i++)
+                    traverse_rec(list[i], phases);
+                DELETE(list);
+                return;
+            }
+
+            for (int i = 0; i < MCXX_MAX_AST_CHILDREN; i++)
+                traverse_rec(nodecl_get_child(n, i), phases);
+
+            for (std::vector<TraversalPhase*>::const_iterator it = phases.begin();
+                    it != phases.end();
+                    it++)
+            {
+                // A previous phase may have changed the kind of the node
+                if ((*it)->visits_kind(nodecl_get_kind(n)))
+                    (*it)->transform(n);
+            }
+        }
+    }
+
+    void TraversalPhase::traverse(Nodecl::NodeclBase root,
+            const std::vector<TraversalPhase*>& phases)
+    {
+        if (nodecl_get_kind(root.get_internal_nodecl()) == NODECL_TOP_LEVEL)
+            nodecl_note_top_level_walk();
+        traverse_rec(root.get_internal_nodecl(), phases);
+    }
+
+    void TraversalPhase::run(DTO& dto)
+    {
+        Nodecl::NodeclBase top_level = *std::static_pointer_cast<Nodecl::NodeclBase>(dto["nodecl"]);
+
+        pre_traversal(dto);
+        traverse(top_level, std::vector<TraversalPhase*>(1, this));
+        post_traversal(dto);
+    }
+}
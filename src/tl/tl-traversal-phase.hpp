@@ -0,0 +1,94 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2014 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+
+  This file is part of Mercurium C/C++ source-to-source compiler.
+
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+#ifndef TL_TRAVERSAL_PHASE_HPP
+#define TL_TRAVERSAL_PHASE_HPP
+
+#include "tl-common.hpp"
+#include "tl-compilerphase.hpp"
+#include "tl-nodecl-base.hpp"
+#include <set>
+#include <vector>
+
+namespace TL
+{
+    //! Base class for phases that only perform local rewrites
+    /*!
+     * Instead of walking the whole translation unit in run, a traversal phase
+     * declares the kinds of node it visits and its member transform is called
+     * for every node of those kinds after the children of the node have been
+     * visited. transform may inspect the subtree of the node and replace the
+     * node, but nothing else.
+     *
+     * The phase runner fuses consecutive traversal phases into a single walk
+     * of the translation unit when the result is the same as running them in
+     * sequence (see can_be_fused_with). At every node the fused phases are
+     * called in pipeline order, so a phase sees the node a previous phase
+     * replaced the visited node with. phase_cleanup of the fused phases is
+     * called after the shared walk.
+     */
+    class LIBTL_CLASS TraversalPhase : public CompilerPhase
+    {
+        private:
+            std::set<node_t> _visited_kinds;
+            std::set<node_t> _read_kinds;
+            std::set<node_t> _written_kinds;
+            std::set<node_t> _replaced_kinds;
+
+            static bool intersects(const std::set<node_t>& s1, const std::set<node_t>& s2);
+        protected:
+            //! transform will be called for nodes of this kind
+            void visit_kind(node_t kind);
+            //! transform inspects nodes of this kind below the visited node
+            void read_kind(node_t kind);
+            //! transform may create nodes of this kind
+            void write_kind(node_t kind);
+            //! transform may replace the visited node with a node of this kind
+            void replace_kind(node_t kind);
+        public:
+            //! Called once before the walk
+            virtual void pre_traversal(DTO& dto) { }
+            //! Called for every visited node, after its children
+            virtual void transform(Nodecl::NodeclBase node) = 0;
+            //! Called once after the walk
+            virtual void post_traversal(DTO& dto) { }
+
+            //! Runs this phase in a walk of its own
+            virtual void run(DTO& dto);
+
+            bool visits_kind(node_t kind) const;
+            //! States whether other can share a walk with this phase when it
+            //! comes after this phase in the pipeline
+            bool can_be_fused_with(const TraversalPhase& other) const;
+
+            //! Walks root once calling, at every node, the phases that visit
+            //! it in the given order
+            static void traverse(Nodecl::NodeclBase root,
+                    const std::vector<TraversalPhase*>& phases);
+    };
+}
+
+#endif // TL_TRAVERSAL_PHASE_HPP
@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+good_tu=$(mktemp --suffix=_good.c)
+bad_tu=$(mktemp --suffix=_bad.c)
+last_tu=$(mktemp --suffix=_last.c)
+printf 'int good(void) { return 1; }\n' > ${good_tu}
+printf '__asm__(".error \\"this object cannot be assembled\\"");\n' > ${bad_tu}
+printf 'int last(void) { return 2; }\n' > ${last_tu}
+compile_versions="sync async"
+test_compile_fail=yes
+test_CFLAGS="${good_tu} ${bad_tu} ${last_tu}"
+test_CFLAGS_sync="--native-jobs=0"
+test_CFLAGS_async="--native-jobs=2"
+test_compile_output_sync=("_good\.c' .* natively compiled" "Native compilation failed for file '.*_bad\.c'")
+test_compile_output_async=("_good\.c' .* natively compiled" "_last\.c' .* natively compiled" "Native compilation failed for file '.*_bad\.c'")
+</testinfo>
+*/
+
+// The files are compiled in the order good, bad, last and this one. The
+// native compilation of the bad one fails. In background, the one of the
+// last file has already been launched by then and the driver must wait for
+// it before reporting the failure. This file is never natively compiled
+int main(void)
+{
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium-fe-only
+second_tu=$(mktemp --suffix=.c)
+printf '#warning second translation unit\nint g(void) { return 1; }\n' > ${second_tu}
+compile_versions="short long"
+test_CFLAGS="${second_tu}"
+test_CFLAGS_short="-j 2"
+test_CFLAGS_long="--jobs=4"
+test_compile_output=("warning: #warning first translation unit" "warning: #warning second translation unit")
+</testinfo>
+*/
+
+// Both translation units are compiled concurrently but their diagnostics
+// must be printed in the order of the input files
+#warning first translation unit
+
+int main(void)
+{
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+export test_nolink=no
+test_generator=config/mercurium
+pp_cache=$(mktemp -d)
+compile_versions="miss hit changed"
+test_CFLAGS_miss="--pp-cache=${pp_cache} -DVALUE=42"
+test_CFLAGS_hit="--pp-cache=${pp_cache} -DVALUE=42"
+test_CFLAGS_changed="--pp-cache=${pp_cache} -DVALUE=43"
+test_ENV_miss="EXPECTED=42"
+test_ENV_hit="EXPECTED=42"
+test_ENV_changed="EXPECTED=43"
+test_compile_output_miss=("Preprocessed file of .* stored in the cache")
+test_compile_output_hit=("Using cached preprocessed file")
+test_compile_output_changed=("Preprocessed file of .* stored in the cache")
+</testinfo>
+*/
+
+#include <stdlib.h>
+
+// The preprocessed file reused by the second version must not be reused
+// by the third one since the macro has changed. The expected value is not
+// a macro because a stale preprocessed file would carry a stale one too
+int value = VALUE;
+
+int main(void)
+{
+    const char* expected = getenv("EXPECTED");
+    if (expected == NULL
+            || value != atoi(expected))
+        abort();
+
+    return 0;
+}
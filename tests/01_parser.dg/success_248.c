@@ -0,0 +1,59 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+export test_nolink=no
+test_generator=config/mercurium
+compile_versions="miss hit changed"
+output_cache=$(mktemp -d)
+test_CFLAGS_miss="--output-cache=${output_cache} -DVALUE=1"
+test_CFLAGS_hit="--output-cache=${output_cache} -DVALUE=1"
+test_CFLAGS_changed="--output-cache=${output_cache} -DVALUE=2 -DCHANGED"
+test_compile_output_miss=("Output .* stored in the cache")
+test_compile_output_hit=("Using cached output")
+test_compile_output_changed=("Output .* stored in the cache")
+</testinfo>
+*/
+
+#include <stdlib.h>
+
+// Every version links into a different executable so the second one can only
+// reuse the object of the first one if -o is not part of the cache key.
+// The third one must not reuse it because its input is different
+int main(void)
+{
+#ifdef CHANGED
+    if (VALUE != 2)
+        abort();
+#else
+    if (VALUE != 1)
+        abort();
+#endif
+    return 0;
+}
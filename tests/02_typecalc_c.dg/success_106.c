@@ -0,0 +1,60 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+test_CFLAGS="--structural-ids-test"
+test_compile_output=("Checked the structural ids of [0-9]+ nodes, [1-9][0-9]* pairs are equivalent")
+</testinfo>
+*/
+
+// Trees that only differ in an implicit conversion must have the same
+// structural id, trees that differ in anything else must not
+
+int i, j;
+long l;
+double d;
+char c;
+
+void f(void)
+{
+    l = i;
+    l = i + 1;
+    l = i + j;
+    l = j + i;
+    d = i;
+    d = l;
+    d = c;
+    i = c + c;
+    i = (int)c;
+    i = 1;
+    l = 1;
+    l = 1L;
+    d = i + 1;
+}
@@ -0,0 +1,83 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+</testinfo>
+*/
+
+// Builtin operator candidates are refilled in every expression, so a
+// previous overload resolution with the same argument types must not be
+// reused for a different operator
+
+template <typename T, typename S>
+struct same_type;
+
+template <typename T>
+struct same_type<T, T>
+{
+    typedef int ok;
+};
+
+typedef __typeof__((int*)0 - (int*)0) ptrdiff_t;
+
+struct I
+{
+    operator int();
+};
+
+struct D
+{
+    operator double();
+};
+
+struct P
+{
+    operator int*();
+};
+
+void f(I i, D d, P p)
+{
+    typedef same_type<__typeof__(i + i), int>::ok t1;
+    typedef same_type<__typeof__(i < i), bool>::ok t2;
+    typedef same_type<__typeof__(i % i), int>::ok t3;
+    typedef same_type<__typeof__(i << i), int>::ok t4;
+    typedef same_type<__typeof__(i == i), bool>::ok t5;
+    typedef same_type<__typeof__(-i), int>::ok t6;
+    typedef same_type<__typeof__(!i), bool>::ok t7;
+
+    typedef same_type<__typeof__(d + d), double>::ok t8;
+    typedef same_type<__typeof__(d < d), bool>::ok t9;
+    typedef same_type<__typeof__(d * i), double>::ok t10;
+
+    typedef same_type<__typeof__(p - p), ptrdiff_t>::ok t11;
+    typedef same_type<__typeof__(p < p), bool>::ok t12;
+    typedef same_type<__typeof__(p + 1), int*>::ok t13;
+    typedef same_type<__typeof__(p[0]), int>::ok t14;
+    typedef same_type<__typeof__(*p), int>::ok t15;
+}
@@ -0,0 +1,79 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+export test_nolink=no
+</testinfo>
+*/
+
+#include <stdlib.h>
+
+// Instantiating a member must not change the default arguments of the
+// member of the template, otherwise later instantiations lose them
+
+template <typename T>
+struct A
+{
+    T f(T x, T y = T(2), int z = 3) { return x + y + T(z); }
+    static T g(T x = T(10)) { return x; }
+    A(T v = T(5)) : v(v) { }
+
+    T v;
+};
+
+int main()
+{
+    A<int> ai;
+    if (ai.v != 5)
+        abort();
+    if (ai.f(1) != 6)
+        abort();
+    if (ai.f(1, 1) != 5)
+        abort();
+    if (A<int>::g() != 10)
+        abort();
+
+    A<long> al;
+    if (al.v != 5)
+        abort();
+    if (al.f(1) != 6)
+        abort();
+    if (A<long>::g() != 10)
+        abort();
+
+    A<double> ad(1.0);
+    if (ad.v != 1.0)
+        abort();
+    if (ad.f(1.0) != 6.0)
+        abort();
+    if (A<double>::g() != 10.0)
+        abort();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+if [ "$(uname -m)" != "x86_64" ]; then
+    test_ignore=yes
+    test_ignore_reason="uses x86-64 builtins"
+fi
+</testinfo>
+*/
+
+// The SSE builtins are only created the first time their name is looked
+// up. They must be found from any scope and have the right type
+
+typedef float v4sf __attribute__((vector_size(16)));
+
+template <bool b> struct static_assert_test;
+template <> struct static_assert_test<true> { };
+
+template <typename T, typename U> struct is_same { static const bool value = false; };
+template <typename T> struct is_same<T, T> { static const bool value = true; };
+
+v4sf f(v4sf a, v4sf b)
+{
+    return __builtin_ia32_addps(a, b);
+}
+
+namespace N
+{
+    v4sf g(v4sf a, v4sf b)
+    {
+        static_assert_test<is_same<__typeof__(__builtin_ia32_addps(a, b)), v4sf>::value> check;
+        return __builtin_ia32_mulps(__builtin_ia32_addps(a, b), b);
+    }
+}
+
+template <typename T>
+T h(T a, T b)
+{
+    return __builtin_ia32_subps(a, b);
+}
+
+template v4sf h(v4sf, v4sf);
@@ -0,0 +1,101 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator="config/mercurium run"
+</testinfo>
+*/
+
+// Expression statements and conditions that are ambiguous with a
+// declaration. The expression checked to solve the ambiguity is the one
+// kept in the tree, so it must be evaluated exactly once
+
+#include <stdlib.h>
+
+int calls = 0;
+
+struct F
+{
+    int operator()(int x) { calls += x; return x; }
+};
+
+F f;
+
+int g(int x)
+{
+    calls += 10 * x;
+    return x;
+}
+
+struct T
+{
+    int v;
+    T(int v = 0) : v(v) { }
+};
+
+void k(int x)
+{
+    f(x);
+    g(x);
+    (g)(x);
+    T(z);
+    z.v = g(x);
+
+    if (f(x))
+    {
+        calls += 1000;
+    }
+
+    while (g(x) > 100)
+    {
+    }
+}
+
+template <typename U>
+void t(U u)
+{
+    f(u);
+    g(u);
+}
+
+int main(int, char**)
+{
+    k(1);
+    // f(x) + g(x) + (g)(x) + z.v = g(x) + f(x) + 1000 + g(x)
+    if (calls != 1 + 10 + 10 + 10 + 1 + 1000 + 10)
+        abort();
+
+    calls = 0;
+    t(2);
+    t(3L);
+    if (calls != (2 + 20) + (3 + 30))
+        abort();
+
+    return 0;
+}
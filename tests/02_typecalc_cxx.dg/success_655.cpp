@@ -0,0 +1,84 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator="config/mercurium run"
+</testinfo>
+*/
+
+// Declarations whose initializers contain nested ambiguities. The same
+// nested subtrees are checked by several interpretations of the enclosing
+// declaration and must be solved the same way in all of them
+
+#include <stdlib.h>
+
+struct T
+{
+    int v;
+    T(int v) : v(v) { }
+};
+
+struct S
+{
+    int w;
+    S(T t, int x) : w(t.v + x) { }
+    int m() { return w; }
+};
+
+S s2(T t, int b)
+{
+    return S(t, b);
+}
+
+int a = 1, b = 2, c = 3;
+
+int main(int, char**)
+{
+    // An object: int(b) + 1 cannot be a parameter
+    S s1(T(a), int(b) + 1);
+    if (s1.m() != 4)
+        abort();
+
+    // A function declaration: both are parameter declarations
+    S s2(T(a), int(b));
+    S (*p)(T, int) = s2;
+    if (p(T(a), b).m() != 3)
+        abort();
+
+    // An object with two nested ambiguities that are expressions
+    S s3(T(a), int(b) + int(c));
+    if (s3.m() != 6)
+        abort();
+
+    // The same, in the condition of a for loop
+    for (S s4(T(a), int(c) + 0); s4.m() != 4; )
+        abort();
+
+    return 0;
+}
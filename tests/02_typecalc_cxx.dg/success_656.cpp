@@ -0,0 +1,75 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+/*
+<testinfo>
+test_generator=config/mercurium
+test_CXXFLAGS="--nodecl-builder-test"
+test_compile_output=("Built [1-9][0-9]* expressions again with Nodecl::Builder")
+</testinfo>
+*/
+
+// Nodecl::Builder must compute the same types as parsing. In C++ calls to
+// overloaded functions are resolved by the builder, and comparisons have
+// type bool
+
+struct A { int x; long y[4]; };
+
+int f(int);
+long f(long);
+double f(double);
+A& f(A&);
+
+char g(char c);
+
+void h(int i, unsigned u, long l, short s, char c, float fl, double d,
+        int *p, A *pa, A a, bool b)
+{
+    l = i + u;
+    d = fl - d;
+    b = i < l;
+    b = d == fl;
+    b = p != 0;
+    b = i && p;
+    l += s;
+    p = p + i;
+    l = p - p;
+    i = *p;
+    p = &i;
+    l = -s;
+    b = !d;
+    i = p[i];
+    l = pa->y[2];
+    l = a.y[s];
+    i = f(i);
+    l = f(l);
+    d = f(fl);
+    i = f(a).x;
+    c = g(i);
+    i = 1 + 2 * 3;
+}
@@ -0,0 +1,88 @@
+/*--------------------------------------------------------------------
+  (C) Copyright 2006-2012 Barcelona Supercomputing Center
+                          Centro Nacional de Supercomputacion
+  
+  This file is part of Mercurium C/C++ source-to-source compiler.
+  
+  See AUTHORS file in the top level directory for information
+  regarding developers and contributors.
+  
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 3 of the License, or (at your option) any later version.
+  
+  Mercurium C/C++ source-to-source compiler is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+  
+  You should have received a copy of the GNU Lesser General Public
+  License along with Mercurium C/C++ source-to-source compiler; if
+  not, write to the Free Software Foundation, Inc., 675 Mass Ave,
+  Cambridge, MA 02139, USA.
+--------------------------------------------------------------------*/
+
+
+
+
+/*
+<testinfo>
+test_generator="config/mercurium run"
+test_CXXFLAGS="--instantiate"
+</testinfo>
+*/
+
+// Functions requested many times are instantiated once, and functions first
+// requested while instantiating the pending ones are instantiated too
+
+template <typename T>
+T twice(T x)
+{
+    return x + x;
+}
+
+template <typename T>
+T four_times(T x)
+{
+    return twice(twice(x));
+}
+
+template <typename T>
+struct A
+{
+    T value;
+
+    T get() const
+    {
+        return four_times(value);
+    }
+
+    void add(T x)
+    {
+        value = value + twice(x);
+    }
+};
+
+extern "C" void abort(void);
+
+int main(int, char**)
+{
+    A<int> a = { 1 };
+    A<long> b = { 2 };
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        a.add(twice(1));
+        b.add(twice(1L));
+    }
+
+    if (a.get() != four_times(13)
+            || b.get() != four_times(14L)
+            || twice(a.value) != 26)
+        abort();
+
+    return 0;
+}